@@ -0,0 +1,12 @@
+SET(BENCHMARKS_HEADERS
+	bench.hpp
+	bench_resources.hpp
+)
+
+SET(BENCHMARKS_SOURCES
+	bench_main.cpp
+	bench_optimization.cpp
+	bench_reservoir.cpp
+	bench_runner.cpp
+	bench_simulation.cpp
+)
@@ -0,0 +1,172 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef FIELDOPT_BENCH_HPP
+#define FIELDOPT_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Benchmarks {
+
+/*!
+ * @brief Prevent the compiler from optimizing away a value computed in a benchmark loop.
+ */
+template<class T>
+inline void DoNotOptimize(T const &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*!
+ * @brief The State class drives the timed loop of one benchmark run.
+ *
+ * Usage:
+ * @code
+ *   void BM_Something(Benchmarks::State &state) {
+ *     // Untimed setup
+ *     while (state.KeepRunning()) {
+ *       // Timed work
+ *     }
+ *   }
+ * @endcode
+ *
+ * The loop runs until at least min_time seconds of timed work have passed. The
+ * clock is only read every few iterations, so very short loop bodies are not
+ * dominated by the timing itself.
+ */
+class State {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  State(double min_time, long long max_iterations = 1000000000LL)
+      : min_time_(min_time), max_iterations_(max_iterations) {}
+
+  bool KeepRunning() {
+      if (!started_) {
+          started_ = true;
+          start_ = Clock::now();
+          cpu_start_ = std::clock();
+          return true;
+      }
+      iterations_++;
+      if (iterations_ < next_check_) return true;
+      if (elapsed() >= min_time_ || iterations_ >= max_iterations_) {
+          stop();
+          return false;
+      }
+      next_check_ = iterations_ + std::max(1LL, iterations_ / 4);
+      return true;
+  }
+
+  /*!
+   * @brief Exclude the work between PauseTiming and ResumeTiming from the measurement.
+   */
+  void PauseTiming() {
+      paused_at_ = Clock::now();
+      cpu_paused_at_ = std::clock();
+  }
+  void ResumeTiming() {
+      paused_ += Clock::now() - paused_at_;
+      cpu_paused_ += std::clock() - cpu_paused_at_;
+  }
+
+  /*!
+   * @brief Report an extra value with the results, e.g. the number of cells in the grid.
+   */
+  void SetCounter(const std::string &name, double value) { counters_[name] = value; }
+
+  long long iterations() const { return iterations_; }
+  double real_seconds() const { return real_seconds_; }
+  double cpu_seconds() const { return cpu_seconds_; }
+  const std::map<std::string, double> &counters() const { return counters_; }
+
+ private:
+  double min_time_;
+  long long max_iterations_;
+  bool started_ = false;
+  long long iterations_ = 0;
+  long long next_check_ = 1;
+  Clock::time_point start_;
+  Clock::time_point paused_at_;
+  Clock::duration paused_ = Clock::duration::zero();
+  std::clock_t cpu_start_ = 0;
+  std::clock_t cpu_paused_at_ = 0;
+  std::clock_t cpu_paused_ = 0;
+  double real_seconds_ = 0;
+  double cpu_seconds_ = 0;
+  std::map<std::string, double> counters_;
+
+  double elapsed() const {
+      return std::chrono::duration<double>(Clock::now() - start_ - paused_).count();
+  }
+
+  void stop() {
+      real_seconds_ = elapsed();
+      cpu_seconds_ = double(std::clock() - cpu_start_ - cpu_paused_) / CLOCKS_PER_SEC;
+  }
+};
+
+/*!
+ * @brief A named benchmark. Parameterised benchmarks are registered once per
+ * parameter set, with the parameters as part of the name, e.g. ECLGrid/GetCell/synthetic_20.
+ */
+struct Benchmark {
+  std::string name;
+  std::function<void(State &)> function;
+};
+
+class Registry {
+ public:
+  void Add(const std::string &name, std::function<void(State &)> function) {
+      benchmarks_.push_back(Benchmark{name, function});
+  }
+  const std::vector<Benchmark> &benchmarks() const { return benchmarks_; }
+
+ private:
+  std::vector<Benchmark> benchmarks_;
+};
+
+/*!
+ * @brief Options shared by the benchmark groups.
+ */
+struct Options {
+  std::vector<int> grid_sizes; //!< Synthetic grids of n x n x n cells are generated for each n.
+  std::vector<int> case_counts; //!< Numbers of evaluated cases used for the bookkeeper benchmarks.
+  std::string work_dir; //!< Directory for generated grids and logs.
+};
+
+/*!
+ * @brief Write a rectangular n x n x n grid to the work directory, unless it already
+ * exists, and get its path. Implemented in bench_reservoir.cpp.
+ */
+std::string SyntheticGrid(const std::string &work_dir, int n);
+
+// Registration functions, one per group. Implemented in the bench_*.cpp files.
+void RegisterReservoirBenchmarks(Registry &registry, const Options &options);
+void RegisterOptimizationBenchmarks(Registry &registry, const Options &options);
+void RegisterRunnerBenchmarks(Registry &registry, const Options &options);
+void RegisterSimulationBenchmarks(Registry &registry, const Options &options);
+
+}
+
+#endif //FIELDOPT_BENCH_HPP
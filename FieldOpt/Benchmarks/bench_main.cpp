@@ -0,0 +1,185 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <thread>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <boost/program_options.hpp>
+#include "bench.hpp"
+#include "Utilities/filehandling.hpp"
+
+namespace po = boost::program_options;
+using namespace Benchmarks;
+
+namespace {
+
+struct Measurement {
+  std::string name;
+  long long iterations = 0;
+  std::vector<double> real_ns; //!< Real time per iteration for each repetition.
+  std::vector<double> cpu_ns; //!< CPU time per iteration for each repetition.
+  std::map<std::string, double> counters;
+};
+
+double mean(const std::vector<double> &v) {
+    double sum = 0;
+    for (double x : v) sum += x;
+    return v.empty() ? 0.0 : sum / v.size();
+}
+
+double stddev(const std::vector<double> &v) {
+    if (v.size() < 2) return 0.0;
+    double m = mean(v), sum = 0;
+    for (double x : v) sum += (x - m) * (x - m);
+    return std::sqrt(sum / (v.size() - 1));
+}
+
+/*!
+ * @brief Write the results in the JSON format of Google Benchmark (one entry per
+ * benchmark with the mean over the repetitions), so they can be tracked with the
+ * same tools. The minimum and standard deviation are added as extra fields.
+ */
+void writeJson(const std::string &path, const std::vector<Measurement> &measurements,
+               const std::string &executable) {
+    QJsonObject context;
+    context.insert("date", QDateTime::currentDateTime().toString(Qt::ISODate));
+    context.insert("host_name", QSysInfo::machineHostName());
+    context.insert("executable", QString::fromStdString(executable));
+    context.insert("num_cpus", (int)std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    context.insert("library_build_type", "release");
+#else
+    context.insert("library_build_type", "debug");
+#endif
+
+    QJsonArray benchmarks;
+    for (auto &m : measurements) {
+        QJsonObject benchmark;
+        benchmark.insert("name", QString::fromStdString(m.name));
+        benchmark.insert("run_name", QString::fromStdString(m.name));
+        benchmark.insert("run_type", "aggregate");
+        benchmark.insert("aggregate_name", "mean");
+        benchmark.insert("repetitions", (int)m.real_ns.size());
+        benchmark.insert("iterations", (double)m.iterations);
+        benchmark.insert("real_time", mean(m.real_ns));
+        benchmark.insert("cpu_time", mean(m.cpu_ns));
+        benchmark.insert("real_time_min", *std::min_element(m.real_ns.begin(), m.real_ns.end()));
+        benchmark.insert("real_time_stddev", stddev(m.real_ns));
+        benchmark.insert("time_unit", "ns");
+        for (auto &counter : m.counters) {
+            benchmark.insert(QString::fromStdString(counter.first), counter.second);
+        }
+        benchmarks.append(benchmark);
+    }
+
+    QJsonObject json;
+    json.insert("context", context);
+    json.insert("benchmarks", benchmarks);
+    QFile file(QString::fromStdString(path));
+    file.open(QFile::WriteOnly | QFile::Truncate);
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Indented));
+    file.close();
+}
+
+}
+
+int main(int argc, const char *argv[]) {
+    po::options_description desc("Micro-benchmarks for FieldOpt hot paths. Allowed options");
+    desc.add_options()
+        ("help,h", "print help message")
+        ("list,l", "list the benchmarks and exit")
+        ("filter", po::value<std::string>()->default_value(".*"),
+         "only run benchmarks with names matching this regular expression")
+        ("min-time", po::value<double>()->default_value(0.5),
+         "minimum timed seconds per repetition")
+        ("repetitions", po::value<int>()->default_value(3), "repetitions per benchmark")
+        ("grid-sizes", po::value<std::vector<int>>()->multitoken()->default_value({10, 20, 40}, "10 20 40"),
+         "generate synthetic n x n x n grids of these sizes")
+        ("case-counts", po::value<std::vector<int>>()->multitoken()->default_value({100, 1000, 10000}, "100 1000 10000"),
+         "numbers of evaluated cases for the bookkeeper benchmarks")
+        ("work-dir", po::value<std::string>()->default_value("/tmp/fieldopt-bench"),
+         "directory for generated grids and logs")
+        ("out,o", po::value<std::string>(), "write the results as JSON to this file")
+        ;
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+    if (vm.count("help")) {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    Options options;
+    options.grid_sizes = vm["grid-sizes"].as<std::vector<int>>();
+    options.case_counts = vm["case-counts"].as<std::vector<int>>();
+    options.work_dir = vm["work-dir"].as<std::string>();
+    Utilities::FileHandling::CreateDirectory(options.work_dir);
+
+    Registry registry;
+    RegisterReservoirBenchmarks(registry, options);
+    RegisterOptimizationBenchmarks(registry, options);
+    RegisterRunnerBenchmarks(registry, options);
+    RegisterSimulationBenchmarks(registry, options);
+
+    std::regex filter(vm["filter"].as<std::string>());
+    double min_time = vm["min-time"].as<double>();
+    int repetitions = std::max(1, vm["repetitions"].as<int>());
+
+    std::vector<Measurement> measurements;
+    if (!vm.count("list"))
+        std::cout << std::left << std::setw(56) << "Benchmark" << std::right
+                  << std::setw(16) << "Time [ns]" << std::setw(16) << "CPU [ns]"
+                  << std::setw(12) << "Stddev" << std::setw(14) << "Iterations" << std::endl;
+    for (auto &benchmark : registry.benchmarks()) {
+        if (!std::regex_search(benchmark.name, filter)) continue;
+        if (vm.count("list")) {
+            std::cout << benchmark.name << std::endl;
+            continue;
+        }
+        Measurement m;
+        m.name = benchmark.name;
+        for (int r = 0; r < repetitions; ++r) {
+            State state(min_time);
+            benchmark.function(state);
+            long long iterations = std::max(1LL, state.iterations());
+            m.iterations += state.iterations();
+            m.real_ns.push_back(1e9 * state.real_seconds() / iterations);
+            m.cpu_ns.push_back(1e9 * state.cpu_seconds() / iterations);
+            m.counters = state.counters();
+        }
+        std::cout << std::left << std::setw(56) << m.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(16) << mean(m.real_ns) << std::setw(16) << mean(m.cpu_ns)
+                  << std::setw(11) << (mean(m.real_ns) > 0 ? 100.0 * stddev(m.real_ns) / mean(m.real_ns) : 0.0) << "%"
+                  << std::setw(14) << m.iterations << std::endl;
+        measurements.push_back(m);
+    }
+
+    if (vm.count("out")) {
+        writeJson(vm["out"].as<std::string>(), measurements, argv[0]);
+    }
+    return 0;
+}
@@ -0,0 +1,293 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <sstream>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include "bench.hpp"
+#include "bench_resources.hpp"
+#include "Optimization/case_transfer_object.h"
+#include "Optimization/constraints/constraint_handler.h"
+#include "Optimization/constraints/reservoir_boundary.h"
+#include "Optimization/tests/test_resource_cases.h"
+#include "Optimization/objective/NPV.h"
+#include "ConstraintMath/well_constraint_projections/well_constraint_projections.h"
+#include "Reservoir/grid/eclgrid.h"
+#include "Simulation/results/synthetic_results.h"
+
+namespace Benchmarks {
+
+namespace {
+
+using Simulation::Results::Results;
+
+std::string serialize(Optimization::Case *c) {
+    auto cto = Optimization::CaseTransferObject(c);
+    std::ostringstream oss;
+    boost::archive::text_oarchive oa(oss);
+    oa << cto;
+    return oss.str();
+}
+
+void serializeCase(State &state) {
+    auto c = Resources::Get().base_case();
+    size_t bytes = 0;
+    while (state.KeepRunning()) {
+        auto s = serialize(c);
+        bytes = s.size();
+        DoNotOptimize(s);
+    }
+    state.SetCounter("bytes", bytes);
+    state.SetCounter("variables", c->GetRealVarVector().size());
+}
+
+void deserializeCase(State &state) {
+    std::string s = serialize(Resources::Get().base_case());
+    while (state.KeepRunning()) {
+        Optimization::CaseTransferObject cto;
+        std::istringstream iss(s);
+        boost::archive::text_iarchive ia(iss);
+        ia >> cto;
+        auto c = cto.CreateCase();
+        DoNotOptimize(c);
+        delete c;
+    }
+    state.SetCounter("bytes", s.size());
+}
+
+/*!
+ * @brief Snap perturbed copies of the base case to all constraints in the example
+ * driver file. Resetting the variable values of the case is included in the timing.
+ */
+void snapCaseToConstraints(State &state) {
+    auto &resources = Resources::Get();
+    Optimization::Constraints::ConstraintHandler handler(resources.settings_optimizer()->constraints(),
+                                                         resources.model()->variables(),
+                                                         resources.grid());
+    auto cases = resources.PerturbedCases(64, 0.1);
+    std::vector<Eigen::VectorXd> values;
+    for (auto perturbed : cases) {
+        values.push_back(perturbed->GetRealVarVector());
+    }
+    auto c = cases.first();
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        c->SetRealVarValues(values[i++ % values.size()]);
+        handler.SnapCaseToConstraints(c);
+    }
+    state.SetCounter("constraints", handler.constraints().size());
+    for (auto perturbed : cases) delete perturbed;
+}
+
+/*!
+ * @brief Evaluate NPV with oil, water and water injection components, discounted yearly,
+ * on synthetic results with quarterly report steps.
+ */
+void npvValue(State &state, int years) {
+    auto &resources = Resources::Get();
+    QJsonObject component {
+        {"Coefficient", 251.0}, {"Property", "CumulativeOilProduction"},
+        {"UseDiscountFactor", true}, {"DiscountFactor", 0.08}, {"Interval", "Yearly"}
+    };
+    QJsonArray components;
+    components.append(component);
+    component["Coefficient"] = -25.0;
+    component["Property"] = "CumulativeWaterProduction";
+    components.append(component);
+    component["Coefficient"] = -12.5;
+    component["Property"] = "CumulativeWaterInjection";
+    components.append(component);
+    Settings::Optimizer settings(QJsonObject{
+        {"Type", "Compass"},
+        {"Mode", "Maximize"},
+        {"Parameters", QJsonObject{{"MaxEvaluations", 10}, {"InitialStepLength", 1.0}, {"MinimumStepLength", 0.1}}},
+        {"Objective", QJsonObject{{"Type", "NPV"}, {"NPVComponents", components}}}
+    });
+
+    std::vector<double> time, fopt, fwpt, fwit;
+    for (int step = 0; step <= 4 * years; ++step) {
+        time.push_back(step * 365.0 / 4);
+        fopt.push_back(1000.0 * step);
+        fwpt.push_back(10.0 * step * step);
+        fwit.push_back(1200.0 * step);
+    }
+    Simulation::Results::SyntheticResults results;
+    results.SetValueVectors({
+        {Results::Time, time},
+        {Results::CumulativeOilProduction, fopt},
+        {Results::CumulativeWaterProduction, fwpt},
+        {Results::CumulativeWaterInjection, fwit}
+    });
+
+    Optimization::Objective::NPV npv(&settings, &results, resources.model());
+    while (state.KeepRunning()) {
+        double value = npv.value();
+        DoNotOptimize(value);
+    }
+    state.SetCounter("report_steps", time.size());
+}
+
+/*!
+ * @brief Find the shortest distance between n horizontal wells of 300 m on a lattice
+ * with 400 m spacing, some of them within the minimum distance of a neighbour,
+ * checking all pairs or only the pairs returned by the broad phase.
+ */
+void interwellShortestDistance(State &state, int n, bool broad_phase) {
+    double d = 150;
+    QList<QList<Eigen::Vector3d>> wells;
+    for (int w = 0; w < n; w++) {
+        int a = w / 5, b = w % 5;
+        Eigen::Vector3d heel(400.0 * a, 400.0 * b + (a % 3 == 0 ? 300.0 : 0.0), 1700.0 + 5.0 * b);
+        Eigen::Vector3d toe = heel + Eigen::Vector3d(300.0, 20.0 * (b - 2), 10.0);
+        wells.append(QList<Eigen::Vector3d>({heel, toe}));
+    }
+    while (state.KeepRunning()) {
+        double distance = broad_phase
+                          ? WellConstraintProjections::shortest_distance_n_wells_within(wells, d)
+                          : WellConstraintProjections::shortest_distance_n_wells(wells, wells.length());
+        DoNotOptimize(distance);
+    }
+    state.SetCounter("wells", n);
+    state.SetCounter("candidate_pairs", WellConstraintProjections::interwell_candidate_pairs(wells, d).length());
+}
+
+/*!
+ * @brief Check or snap a spline well against a reservoir boundary box, with the heel
+ * and the toe placed on a 4 x 4 x 4 lattice of points reaching 10 % outside the grid.
+ * The direct variant checks and projects onto every cell in the box, as was done
+ * before the box geometry was precomputed by the constraint.
+ */
+void reservoirBoundary(State &state, Reservoir::Grid::Grid *grid,
+                       int imin, int imax, int jmin, int jmax, int kmin, int kmax,
+                       bool snap, bool direct) {
+    TestResources::TestResourceCases resources;
+    Settings::Optimizer::Constraint settings;
+    settings.type = Settings::Optimizer::ConstraintType::ReservoirBoundary;
+    settings.well = "TESTW";
+    settings.box_imin = imin;
+    settings.box_imax = imax;
+    settings.box_jmin = jmin;
+    settings.box_jmax = jmax;
+    settings.box_kmin = kmin;
+    settings.box_kmax = kmax;
+    settings.penalty_weight = 0.0;
+    Optimization::Constraints::ReservoirBoundary boundary(settings, resources.varcont_prod_spline_, grid);
+
+    QList<int> index_list;
+    for (int i = imin; i <= imax; i++) {
+        for (int j = jmin; j <= jmax; j++) {
+            for (int k = kmin; k <= kmax; k++) {
+                index_list.append(grid->GetCell(i, j, k).global_index());
+            }
+        }
+    }
+
+    auto dims = grid->Dimensions();
+    Eigen::Vector3d first = grid->GetCell(0, 0, 0).center();
+    Eigen::Vector3d last = grid->GetCell(dims.nx - 1, dims.ny - 1, dims.nz - 1).center();
+    Eigen::Vector3d margin = 0.1 * (last - first).cwiseAbs();
+    Eigen::Vector3d lo = first.cwiseMin(last) - margin;
+    Eigen::Vector3d hi = first.cwiseMax(last) + margin;
+    std::vector<Eigen::Vector3d> points;
+    for (int a = 0; a < 4; ++a)
+        for (int b = 0; b < 4; ++b)
+            for (int c = 0; c < 4; ++c)
+                points.push_back(lo + Eigen::Vector3d(a, b, c).cwiseProduct(hi - lo) / 3.0);
+
+    auto c = resources.test_case_spline_;
+    QList<QUuid> heel_ids({resources.prod_heel_x_->id(), resources.prod_heel_y_->id(), resources.prod_heel_z_->id()});
+    QList<QUuid> toe_ids({resources.prod_toe_x_->id(), resources.prod_toe_y_->id(), resources.prod_toe_z_->id()});
+    auto set_point = [c](const QList<QUuid> &ids, const Eigen::Vector3d &p) {
+      for (int d = 0; d < 3; ++d) c->set_real_variable_value(ids[d], p(d));
+    };
+    auto get_point = [c](const QList<QUuid> &ids) {
+      return Eigen::Vector3d(c->real_variables()[ids[0]], c->real_variables()[ids[1]], c->real_variables()[ids[2]]);
+    };
+    auto in_box = [grid, &index_list](const Eigen::Vector3d &p) {
+      for (int index : index_list) {
+          if (grid->GetCell(index).EnvelopsPoint(p)) return true;
+      }
+      return false;
+    };
+
+    // Build the grid index outside the timed loop
+    boundary.CaseSatisfiesConstraint(c);
+    size_t i = 0;
+    int n_feasible = 0;
+    while (state.KeepRunning()) {
+        set_point(heel_ids, points[i % points.size()]);
+        set_point(toe_ids, points[(7 * i + 3) % points.size()]);
+        i++;
+        if (snap && direct) {
+            set_point(heel_ids, WellConstraintProjections::well_domain_constraint_indices(get_point(heel_ids), grid, index_list));
+            set_point(toe_ids, WellConstraintProjections::well_domain_constraint_indices(get_point(toe_ids), grid, index_list));
+        }
+        else if (snap) {
+            boundary.SnapCaseToConstraints(c);
+        }
+        else {
+            bool feasible = direct ? in_box(get_point(heel_ids)) && in_box(get_point(toe_ids))
+                                   : boundary.CaseSatisfiesConstraint(c);
+            if (feasible) n_feasible++;
+        }
+    }
+    state.SetCounter("box_cells", index_list.size());
+    if (!snap) state.SetCounter("feasible_fraction", (double)n_feasible / std::max<size_t>(1, i));
+}
+
+}
+
+void RegisterOptimizationBenchmarks(Registry &registry, const Options &options) {
+    registry.Add("CaseTransferObject/Serialize", serializeCase);
+    registry.Add("CaseTransferObject/Deserialize", deserializeCase);
+    registry.Add("ConstraintHandler/SnapCaseToConstraints", snapCaseToConstraints);
+
+    // ReservoirBoundary on the box from the example driver file, and on the center of synthetic grids
+    for (bool snap : {false, true}) {
+        for (bool direct : {true, false}) {
+            std::string name = std::string("ReservoirBoundary/") + (snap ? "Snap/" : "Feasibility/")
+                               + (direct ? "direct" : "precomputed");
+            registry.Add(name + "/5spot", [snap, direct](State &state) {
+              auto box = Resources::Get().settings_optimizer()->constraints()[5];
+              reservoirBoundary(state, Resources::Get().grid(), box.box_imin, box.box_imax,
+                                box.box_jmin, box.box_jmax, box.box_kmin, box.box_kmax, snap, direct);
+            });
+            for (int n : options.grid_sizes) {
+                std::string work_dir = options.work_dir;
+                registry.Add(name + "/synthetic_" + std::to_string(n), [work_dir, n, snap, direct](State &state) {
+                  Reservoir::Grid::ECLGrid grid(SyntheticGrid(work_dir, n));
+                  reservoirBoundary(state, &grid, n / 4, 3 * n / 4, n / 4, 3 * n / 4, n / 4, 3 * n / 4, snap, direct);
+                });
+            }
+        }
+    }
+    for (int years : {10, 50}) {
+        registry.Add("NPV/value/" + std::to_string(years) + "_years",
+                     [years](State &state) { npvValue(state, years); });
+    }
+    for (int n : {10, 50, 200}) {
+        registry.Add("InterwellDistance/ShortestDistance/all_pairs/" + std::to_string(n),
+                     [n](State &state) { interwellShortestDistance(state, n, false); });
+        registry.Add("InterwellDistance/ShortestDistance/broad_phase/" + std::to_string(n),
+                     [n](State &state) { interwellShortestDistance(state, n, true); });
+    }
+}
+
+}
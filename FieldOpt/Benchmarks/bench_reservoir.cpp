@@ -0,0 +1,152 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <ert/ecl/ecl_grid.h>
+#include "bench.hpp"
+#include "Reservoir/grid/eclgrid.h"
+#include "WellIndexCalculation/wicalc_rixx.h"
+#include "Settings/tests/test_resource_example_file_paths.hpp"
+#include "Utilities/filehandling.hpp"
+
+using namespace Reservoir::Grid;
+using namespace Reservoir::WellIndexCalculation;
+
+namespace Benchmarks {
+
+/*!
+ * @brief Write a rectangular n x n x n grid of 24 x 24 x 4 m cells to the work
+ * directory, unless it already exists, and get its path.
+ */
+std::string SyntheticGrid(const std::string &work_dir, int n) {
+    std::string path = work_dir + "/SYNTHETIC_" + std::to_string(n) + ".EGRID";
+    if (!Utilities::FileHandling::FileExists(path)) {
+        ecl_grid_type *grid = ecl_grid_alloc_rectangular(n, n, n, 24.0, 24.0, 4.0, nullptr);
+        ecl_grid_fwrite_EGRID2(grid, path.c_str(), ECL_METRIC_UNITS);
+        ecl_grid_free(grid);
+    }
+    return path;
+}
+
+namespace {
+
+struct GridSource {
+  std::string name;
+  std::string path;
+};
+
+std::vector<GridSource> gridSources(const Options &options) {
+    std::vector<GridSource> sources = {
+        {"5spot", TestResources::ExampleFilePaths::grid_5spot_},
+        {"horzwell", TestResources::ExampleFilePaths::grid_horzwel_},
+        {"norne", TestResources::ExampleFilePaths::norne_grid_}
+    };
+    for (int n : options.grid_sizes) {
+        sources.push_back({"synthetic_" + std::to_string(n), SyntheticGrid(options.work_dir, n)});
+    }
+    return sources;
+}
+
+/*!
+ * @brief Get the global indices of up to n randomly chosen active cells.
+ */
+std::vector<int> activeCells(ECLGrid &grid, int n) {
+    auto dims = grid.Dimensions();
+    int n_cells = dims.nx * dims.ny * dims.nz;
+    boost::random::mt19937 gen(42);
+    boost::random::uniform_int_distribution<> dist(0, n_cells - 1);
+    std::vector<int> indices;
+    for (int attempt = 0; attempt < 10 * n && indices.size() < n; ++attempt) {
+        int index = dist(gen);
+        if (grid.GetCell(index).is_active()) indices.push_back(index);
+    }
+    return indices;
+}
+
+void getCell(State &state, const std::string &path) {
+    ECLGrid grid(path);
+    auto dims = grid.Dimensions();
+    auto indices = activeCells(grid, 1024);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        auto cell = grid.GetCell(indices[i++ % indices.size()]);
+        DoNotOptimize(cell);
+    }
+    state.SetCounter("cells", dims.nx * dims.ny * dims.nz);
+}
+
+void getCellEnvelopingPoint(State &state, const std::string &path) {
+    ECLGrid grid(path);
+    auto dims = grid.Dimensions();
+    std::vector<Eigen::Vector3d> points;
+    for (int index : activeCells(grid, 256)) {
+        points.push_back(grid.GetCell(index).center());
+    }
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        auto cell = grid.GetCellEnvelopingPoint(points[i++ % points.size()]);
+        DoNotOptimize(cell);
+    }
+    state.SetCounter("cells", dims.nx * dims.ny * dims.nz);
+}
+
+/*!
+ * @brief Compute the well blocks of a horizontal well running diagonally through the
+ * middle layer of the grid, from the center of cell (0, 0) to that of cell (nx-1, ny-1).
+ */
+void computeWellBlocks(State &state, const std::string &path) {
+    ECLGrid grid(path);
+    auto dims = grid.Dimensions();
+    wicalc_rixx wic(&grid);
+
+    WellDefinition well;
+    well.wellname = "BENCH";
+    well.heels.push_back(grid.GetCell(0, 0, dims.nz / 2).center());
+    well.toes.push_back(grid.GetCell(dims.nx - 1, dims.ny - 1, dims.nz / 2).center());
+    well.radii.push_back(0.1905);
+    well.skins.push_back(0.0);
+    well.heel_md.push_back(0.0);
+    well.toe_md.push_back((well.toes[0] - well.heels[0]).norm());
+
+    size_t n_blocks = 0;
+    while (state.KeepRunning()) {
+        std::vector<IntersectedCell> cells;
+        wic.ComputeWellBlocks(cells, well);
+        n_blocks = cells.size();
+        DoNotOptimize(cells);
+    }
+    state.SetCounter("cells", dims.nx * dims.ny * dims.nz);
+    state.SetCounter("well_blocks", n_blocks);
+}
+
+}
+
+void RegisterReservoirBenchmarks(Registry &registry, const Options &options) {
+    for (auto source : gridSources(options)) {
+        std::string path = source.path;
+        registry.Add("ECLGrid/GetCell/" + source.name,
+                     [path](State &state) { getCell(state, path); });
+        registry.Add("ECLGrid/GetCellEnvelopingPoint/" + source.name,
+                     [path](State &state) { getCellEnvelopingPoint(state, path); });
+        registry.Add("wicalc_rixx/ComputeWellBlocks/" + source.name,
+                     [path](State &state) { computeWellBlocks(state, path); });
+    }
+}
+
+}
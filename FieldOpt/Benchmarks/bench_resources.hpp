@@ -0,0 +1,72 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef FIELDOPT_BENCH_RESOURCES_HPP
+#define FIELDOPT_BENCH_RESOURCES_HPP
+
+#include "Optimization/tests/test_resource_optimizer.h"
+#include "Reservoir/tests/test_resource_grids.h"
+
+namespace Benchmarks {
+
+/*!
+ * @brief Settings, model, grid and base case shared by the benchmarks, built from
+ * the same example files as the unit tests. They are created on first use, so
+ * only benchmarks that need them pay for loading them.
+ */
+class Resources : public TestResources::TestResourceOptimizer,
+                  public TestResources::TestResourceGrids {
+ public:
+  static Resources &Get() {
+      static Resources resources;
+      return resources;
+  }
+
+  Settings::Settings *settings() { return settings_full_; }
+  Logger *logger() { return logger_; }
+  Settings::Optimizer *settings_optimizer() { return settings_optimizer_; }
+  Model::Model *model() { return model_; }
+  Reservoir::Grid::Grid *grid() { return grid_5spot_; }
+  Runner::RuntimeSettings *runtime_settings() { return rts_; }
+  Optimization::Case *base_case() { return base_case_; }
+
+  /*!
+   * @brief Get n copies of the base case with deterministically perturbed real variables.
+   */
+  QList<Optimization::Case *> PerturbedCases(int n, double scale = 0.02) {
+      QList<Optimization::Case *> cases;
+      Eigen::VectorXd base = base_case_->GetRealVarVector();
+      for (int row = 0; row < n; ++row) {
+          Eigen::VectorXd x = base;
+          for (int j = 0; j < x.size(); ++j) {
+              x(j) += scale * ((row * 7 + j * 13) % 11 - 5 + row / 11.0) * (std::abs(x(j)) + 1.0);
+          }
+          auto c = new Optimization::Case(base_case_);
+          c->SetRealVarValues(x);
+          cases.append(c);
+      }
+      return cases;
+  }
+
+ private:
+  Resources() {}
+};
+
+}
+
+#endif //FIELDOPT_BENCH_RESOURCES_HPP
@@ -0,0 +1,88 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include "bench.hpp"
+#include "bench_resources.hpp"
+#include "Optimization/case_handler.h"
+#include "Runner/bookkeeper.h"
+#include "Runner/logger.h"
+#include "Runner/runtime_settings.h"
+#include "Utilities/filehandling.hpp"
+
+namespace Benchmarks {
+
+namespace {
+
+/*!
+ * @brief Look up a case in a case handler with n evaluated cases. A miss has to
+ * compare against all evaluated cases; a hit is an equal copy of the last one.
+ */
+void bookkeeperIsEvaluated(State &state, int n, bool hit) {
+    auto &resources = Resources::Get();
+    Optimization::CaseHandler case_handler;
+    auto cases = resources.PerturbedCases(n + 1);
+    for (int i = 0; i < n; ++i) {
+        cases[i]->set_objective_function_value(i);
+        case_handler.AddNewCase(cases[i]);
+        case_handler.GetNextCaseForEvaluation();
+        case_handler.SetCaseEvaluated(cases[i]->id());
+    }
+    Runner::Bookkeeper bookkeeper(resources.settings(), &case_handler);
+    auto probe = hit ? new Optimization::Case(cases[n - 1]) : cases[n];
+    while (state.KeepRunning()) {
+        bool evaluated = bookkeeper.IsEvaluated(probe);
+        DoNotOptimize(evaluated);
+    }
+    state.SetCounter("evaluated_cases", n);
+    if (hit) delete probe;
+}
+
+/*!
+ * @brief Write case log entries with a logger writing to the work directory.
+ */
+void loggerAddCaseEntry(State &state, const std::string &work_dir) {
+    std::string output_dir = work_dir + "/logger";
+    Utilities::FileHandling::CreateDirectory(output_dir);
+    std::string driver = TestResources::ExampleFilePaths::driver_5spot_;
+    const char *argv[] = {"FieldOpt", driver.c_str(), output_dir.c_str(), "-f", "-v", "0"};
+    Runner::RuntimeSettings rts(6, argv);
+    Logger logger(&rts, "", true);
+
+    auto c = Resources::Get().PerturbedCases(1).first();
+    c->set_objective_function_value(100.0);
+    while (state.KeepRunning()) {
+        logger.AddEntry(c);
+    }
+    delete c;
+}
+
+}
+
+void RegisterRunnerBenchmarks(Registry &registry, const Options &options) {
+    for (int n : options.case_counts) {
+        registry.Add("Bookkeeper/IsEvaluated/miss/" + std::to_string(n),
+                     [n](State &state) { bookkeeperIsEvaluated(state, n, false); });
+        registry.Add("Bookkeeper/IsEvaluated/hit/" + std::to_string(n),
+                     [n](State &state) { bookkeeperIsEvaluated(state, n, true); });
+    }
+    std::string work_dir = options.work_dir;
+    registry.Add("Logger/AddEntry/Case",
+                 [work_dir](State &state) { loggerAddCaseEntry(state, work_dir); });
+}
+
+}
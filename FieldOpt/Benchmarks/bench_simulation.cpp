@@ -0,0 +1,167 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include "bench.hpp"
+#include "bench_resources.hpp"
+#include "Simulation/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_section.h"
+#include "Simulation/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_fragment_cache.h"
+#include "Utilities/filehandling.hpp"
+
+using namespace Simulation::ECLDriverParts;
+
+namespace Benchmarks {
+
+namespace {
+
+/*!
+ * @brief Control times every ten days for the synthetic schedule model.
+ */
+QList<int> syntheticControlTimes(int n_times) {
+    QList<int> control_times;
+    for (int t = 0; t < n_times; ++t) {
+        control_times.append(10 * t);
+    }
+    return control_times;
+}
+
+/*!
+ * @brief Create a model with n_wells single-block BHP wells on the 5-spot grid, each
+ * with a control at every one of n_times control times. The driver file is a copy of
+ * the example driver with the wells and control times replaced, written to the work
+ * directory. The model shares the grid of the example model.
+ */
+Model::Model *syntheticScheduleModel(const std::string &work_dir, int n_wells, int n_times) {
+    auto &resources = Resources::Get();
+    QFile example(QString::fromStdString(TestResources::ExampleFilePaths::driver_example_));
+    example.open(QIODevice::ReadOnly);
+    QJsonObject json_driver = QJsonDocument::fromJson(example.readAll()).object();
+    example.close();
+
+    QJsonArray control_times;
+    for (int t : syntheticControlTimes(n_times)) {
+        control_times.append(t);
+    }
+    QJsonObject json_model = json_driver["Model"].toObject();
+    QJsonObject template_well = json_model["Wells"].toArray().first().toObject();
+    QJsonArray wells;
+    for (int w = 0; w < n_wells; ++w) {
+        QJsonObject well = template_well;
+        well["Name"] = QString("W%1").arg(w);
+        well["WellBlocks"] = QJsonArray{QJsonObject{
+            {"i", 1 + 3 * (w % 20)}, {"j", 1 + 3 * (w / 20)}, {"k", 1}, {"IsVariable", false},
+            {"Completion", QJsonObject{{"Type", "Perforation"}, {"TransmissibilityFactor", 1.0}, {"IsVariable", false}}}
+        }};
+        QJsonArray controls;
+        for (auto t : control_times) {
+            controls.append(QJsonObject{{"TimeStep", t}, {"State", "Open"}, {"Mode", "BHP"},
+                                        {"BHP", 100.0 + w % 7}, {"IsVariable", false}});
+        }
+        well["Controls"] = controls;
+        wells.append(well);
+    }
+    json_model["Wells"] = wells;
+    json_model["ControlTimes"] = control_times;
+    json_driver["Model"] = json_model;
+
+    // The example constraints refer to the example wells
+    QJsonObject json_optimizer = json_driver["Optimizer"].toObject();
+    json_optimizer["Constraints"] = QJsonArray();
+    json_driver["Optimizer"] = json_optimizer;
+
+    std::string output_dir = work_dir + "/schedule_" + std::to_string(n_wells) + "x" + std::to_string(n_times);
+    Utilities::FileHandling::CreateDirectory(output_dir);
+    QString driver_path = QString::fromStdString(output_dir + "/driver.json");
+    QFile driver(driver_path);
+    driver.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    driver.write(QJsonDocument(json_driver).toJson());
+    driver.close();
+
+    Paths paths;
+    paths.SetPath(Paths::DRIVER_FILE, driver_path.toStdString());
+    paths.SetPath(Paths::OUTPUT_DIR, output_dir);
+    paths.SetPath(Paths::GRID_FILE, TestResources::ExampleFilePaths::grid_5spot_);
+    Settings::Settings settings(paths);
+    return new Model::Model(settings, resources.logger(), resources.model());
+}
+
+/*!
+ * @brief Generate the schedule for a new case and write it to the work directory,
+ * the way the ECLIPSE driver file writer does. Each case changes the controls of
+ * one well; with a cache, only the fragments of that well are regenerated. The
+ * changed BHP values are restored afterwards.
+ */
+void scheduleWrite(State &state, Model::Model *model, QList<int> control_times,
+                   const std::string &work_dir, bool cached) {
+    auto wells = model->wells();
+    ScheduleInsets insets;
+    ScheduleFragmentCache cache;
+    QFile file(QString::fromStdString(work_dir + "/SCHEDULE.INC"));
+
+    int n = 0;
+    while (state.KeepRunning()) {
+        // Alternate between raising and lowering the BHP of each well
+        auto control = wells->at(n % wells->size())->controls()->first();
+        control->setBhp(control->bhp() + ((n / wells->size()) % 2 == 0 ? 1.0 : -1.0));
+        n++;
+
+        Schedule schedule = cached ? Schedule(wells, control_times, insets, cache)
+                                   : Schedule(wells, control_times, insets);
+        file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+        QTextStream out(&file);
+        schedule.Write(out);
+        out.flush();
+        file.close();
+    }
+    // Wells that were changed an odd number of times are left raised by one
+    for (int i = 0; i < wells->size(); ++i) {
+        int changes = n / wells->size() + (i < n % wells->size() ? 1 : 0);
+        if (changes % 2 == 1) {
+            auto control = wells->at(i)->controls()->first();
+            control->setBhp(control->bhp() - 1.0);
+        }
+    }
+    state.SetCounter("wells", wells->size());
+    state.SetCounter("control_times", control_times.size());
+    if (cached) {
+        state.SetCounter("fragment_hit_rate", (double)cache.hits() / std::max(1, cache.hits() + cache.misses()));
+    }
+}
+
+}
+
+void RegisterSimulationBenchmarks(Registry &registry, const Options &options) {
+    std::string work_dir = options.work_dir;
+    for (bool cached : {false, true}) {
+        std::string name = std::string("Schedule/Write/") + (cached ? "cached" : "uncached");
+        registry.Add(name + "/example", [work_dir, cached](State &state) {
+          auto &resources = Resources::Get();
+          scheduleWrite(state, resources.model(), resources.settings()->model()->control_times(), work_dir, cached);
+        });
+        registry.Add(name + "/200x100", [work_dir, cached](State &state) {
+          auto model = syntheticScheduleModel(work_dir, 200, 100);
+          scheduleWrite(state, model, syntheticControlTimes(100), work_dir, cached);
+        });
+    }
+}
+
+}
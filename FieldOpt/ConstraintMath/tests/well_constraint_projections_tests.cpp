@@ -287,4 +287,42 @@ namespace {
 
     }
 
+    TEST_F(WellConstraintProjectionsTests, interwell_broad_phase){
+
+        // 50 horizontal wells of 300 m on a 10 x 5 lattice with 400 m spacing,
+        // with some of them pushed within the minimum distance of a neighbour.
+        double d = 150;
+        QList<QList<Eigen::Vector3d>> wells;
+        for (int a = 0; a < 10; a++) {
+            for (int b = 0; b < 5; b++) {
+                Eigen::Vector3d heel(400.0 * a, 400.0 * b + (a % 3 == 0 ? 300.0 : 0.0), 1700.0 + 5.0 * b);
+                Eigen::Vector3d toe = heel + Eigen::Vector3d(300.0, 20.0 * (b - 2), 10.0);
+                wells.append(QList<Eigen::Vector3d>({heel, toe}));
+            }
+        }
+
+        // The broad phase must include every pair closer than d
+        auto pairs = WellConstraintProjections::interwell_candidate_pairs(wells, d);
+        for (int i = 0; i < wells.length(); i++) {
+            for (int j = i + 1; j < wells.length(); j++) {
+                double dist = WellConstraintProjections::shortest_distance(wells[i][0], wells[i][1],
+                                                                           wells[j][0], wells[j][1]);
+                if (dist < d) {
+                    EXPECT_TRUE(pairs.contains(qMakePair(i, j)));
+                }
+            }
+        }
+        EXPECT_LT(pairs.length(), wells.length() * (wells.length() - 1) / 2);
+
+        double all_pairs = WellConstraintProjections::shortest_distance_n_wells(wells, wells.length());
+        double pruned = WellConstraintProjections::shortest_distance_n_wells_within(wells, d);
+        ASSERT_LT(all_pairs, d);
+        EXPECT_DOUBLE_EQ(all_pairs, pruned);
+        EXPECT_FALSE(WellConstraintProjections::feasible_interwell_distance(wells, d, 1e-3));
+
+        // Projecting the wells only touches nearby pairs, and makes them feasible
+        auto moved = WellConstraintProjections::interwell_constraint_multiple_wells(wells, d, 1e-3);
+        EXPECT_TRUE(WellConstraintProjections::feasible_interwell_distance(moved, d, 1e-2));
+    }
+
 }
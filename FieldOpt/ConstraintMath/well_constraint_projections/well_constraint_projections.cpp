@@ -23,6 +23,8 @@
 ******************************************************************************/
 
 #include "well_constraint_projections.h"
+#include <algorithm>
+#include <vector>
 
 namespace WellConstraintProjections {
 using namespace Eigen;
@@ -261,17 +263,48 @@ double shortest_distance_n_wells(QList<QList<Vector3d>> wells, int n) {
     // for all pairs of wells (i,j) i != j
     for (int i = 0; i < n; i++) {
         for (int j = i + 1; j < n; j++) {
-            // Create QList with current pair of wells
-            QList<Vector3d> current_pair;
-            current_pair.append(wells[i][0]);
-            current_pair.append(wells[i][1]);
-            current_pair.append(wells[j][0]);
-            current_pair.append(wells[j][1]);
+            distance = std::min(distance, shortest_distance(wells[i][0], wells[i][1], wells[j][0], wells[j][1]));
+        }
+    }
+    return distance;
+}
 
-            if (shortest_distance(current_pair) < distance) {
-                distance = shortest_distance(current_pair);
+QList<QPair<int, int>> interwell_candidate_pairs(const QList<QList<Vector3d>> &wells, double d) {
+    int n = wells.length();
+    std::vector<Vector3d> lo(n), hi(n);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) {
+        // Expand by d/2 on each side, so that overlapping boxes are closer than d
+        lo[i] = wells[i][0].cwiseMin(wells[i][1]).array() - d / 2.0;
+        hi[i] = wells[i][0].cwiseMax(wells[i][1]).array() + d / 2.0;
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&lo](int a, int b) { return lo[a].x() < lo[b].x(); });
+
+    QList<QPair<int, int>> pairs;
+    std::vector<int> active;
+    for (int a : order) {
+        // Drop the boxes ending before this one starts
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](int b) { return hi[b].x() < lo[a].x(); }), active.end());
+        for (int b : active) {
+            if (lo[a].y() <= hi[b].y() && lo[b].y() <= hi[a].y() &&
+                lo[a].z() <= hi[b].z() && lo[b].z() <= hi[a].z()) {
+                pairs.append(qMakePair(std::min(a, b), std::max(a, b)));
             }
         }
+        active.push_back(a);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+double shortest_distance_n_wells_within(const QList<QList<Vector3d>> &wells, double d) {
+    double distance = INFINITY;
+    for (auto pair : interwell_candidate_pairs(wells, d)) {
+        double pair_distance = shortest_distance(wells[pair.first][0], wells[pair.first][1],
+                                                 wells[pair.second][0], wells[pair.second][1]);
+        distance = std::min(distance, pair_distance);
     }
     return distance;
 }
@@ -284,27 +317,29 @@ QList<QList<Vector3d>> interwell_constraint_multiple_wells(QList<QList<Vector3d>
     int max_iter = 10000;
     int iter = 0;
     while (shortest_distance < d - tol && iter < max_iter) {
-        // for all pairs of wells (i,j) i != j
-        for (int i = 0; i < wells.length(); i++) {
-            for (int j = i + 1; j < wells.length(); j++) {
-                // Create QList with current pair of wells
-                QList<Vector3d> current_pair;
-                current_pair.append(wells[i][0]);
-                current_pair.append(wells[i][1]);
-                current_pair.append(wells[j][0]);
-                current_pair.append(wells[j][1]);
-
-                // Project pair of wells
-                current_pair = interwell_constraint_projection(current_pair, d);
-
-                // Replace initial well pair with projected pair.
-                wells[i].replace(0, current_pair[0]);
-                wells[i].replace(1, current_pair[1]);
-                wells[j].replace(0, current_pair[2]);
-                wells[j].replace(1, current_pair[3]);
-            }
+        // Pairs of wells further than d apart are left unchanged by the projection,
+        // so only the nearby pairs (i,j) i < j are projected.
+        for (auto pair : interwell_candidate_pairs(wells, d)) {
+            int i = pair.first;
+            int j = pair.second;
+            // Create QList with current pair of wells
+            QList<Vector3d> current_pair;
+            current_pair.append(wells[i][0]);
+            current_pair.append(wells[i][1]);
+            current_pair.append(wells[j][0]);
+            current_pair.append(wells[j][1]);
+
+            // Project pair of wells
+            current_pair = interwell_constraint_projection(current_pair, d);
+            if (current_pair.length() == 0) continue; // No solution was found
+
+            // Replace initial well pair with projected pair.
+            wells[i].replace(0, current_pair[0]);
+            wells[i].replace(1, current_pair[1]);
+            wells[j].replace(0, current_pair[2]);
+            wells[j].replace(1, current_pair[3]);
         }
-        shortest_distance = shortest_distance_n_wells(wells, wells.length());
+        shortest_distance = shortest_distance_n_wells_within(wells, d);
         iter += 1;
     }
     if (iter == max_iter)
@@ -342,7 +377,7 @@ bool feasible_well_length(QList<QList<Vector3d>> wells, double max, double min,
 bool feasible_interwell_distance(QList<QList<Vector3d>> wells, double d, double tol) {
     // Number of wells
     bool is_feasible = true;
-    if (shortest_distance_n_wells(wells, wells.length()) < d - tol) {
+    if (shortest_distance_n_wells_within(wells, d) < d - tol) {
         is_feasible = false;
     }
     return is_feasible;
@@ -392,10 +427,12 @@ Vector3d well_domain_constraint_indices(Vector3d point, Reservoir::Grid::Grid *g
 }
 
 double shortest_distance(QList<Vector3d> coords) {
-    auto closest_p_q = closest_points_on_lines(coords[0], coords[1], coords[2], coords[3]);
-    Vector3d closest_distance_vec = closest_p_q.second - closest_p_q.first;
-    double distance = sqrt(closest_distance_vec.transpose() * closest_distance_vec);
-    return distance;
+    return shortest_distance(coords[0], coords[1], coords[2], coords[3]);
+}
+
+double shortest_distance(const Vector3d &P0, const Vector3d &P1, const Vector3d &Q0, const Vector3d &Q1) {
+    auto closest_p_q = closest_points_on_lines(P0, P1, Q0, Q1);
+    return (closest_p_q.second - closest_p_q.first).norm();
 }
 
 QList<Vector3d> well_length_projection(Vector3d heel, Vector3d toe, double max, double min, double epsilon) {
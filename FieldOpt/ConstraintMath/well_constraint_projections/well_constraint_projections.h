@@ -52,6 +52,25 @@ namespace WellConstraintProjections
     // Help functions. Moving ponts, shortest distance, costs, feasibillity etc.
     double shortest_distance_n_wells(QList<QList<Vector3d> > wells, int n);
     double shortest_distance(QList<Vector3d> coords);
+    double shortest_distance(const Vector3d &P0, const Vector3d &P1, const Vector3d &Q0, const Vector3d &Q1);
+
+    /*!
+     * \brief Broad phase for the interwell distance constraint. Finds the pairs of wells (i < j) whose
+     * bounding boxes, expanded by d, overlap. This is done by sweep-and-prune along the x-axis, followed
+     * by an overlap test in y and z. Pairs that are not returned are guaranteed to be at least a distance
+     * d apart, so only the returned pairs need the exact segment distance/projection.
+     * \param wells List of well heels and toes. ith element in outer QList corresponds to well i.
+     * \param d The minimum distance of interest.
+     * \return Candidate pairs, sorted by (i, j).
+     */
+    QList<QPair<int, int>> interwell_candidate_pairs(const QList<QList<Vector3d>> &wells, double d);
+
+    /*!
+     * \brief Shortest distance between any two wells closer than d (INFINITY if no wells are closer than d).
+     * Equivalent to shortest_distance_n_wells whenever the result is less than d, but only computes the
+     * exact distance for the candidate pairs from interwell_candidate_pairs.
+     */
+    double shortest_distance_n_wells_within(const QList<QList<Vector3d>> &wells, double d);
 
     Vector3d project_point_to_plane(Vector3d point, Vector3d normal_vector,
                                     Vector3d plane_point);
@@ -37,157 +37,167 @@ Hdf5SummaryReader::Hdf5SummaryReader(const std::string file_path,
   DATASET_NAME_PRESSURE("PTZ"),
   DATASET_NAME_SATURATION("GRIDPROPTIME")
 {
-    readTimeVector(file_path);
-    readWellStates(file_path);
     debug_ = debug;
+    cell_data_ = get_cell_data;
+    file_ = H5File(file_path, H5F_ACC_RDONLY);
+
+    readTimeVector();
+    readWellStateDims();
 
     /*!
      * These are only called if we want to extract cell data from
      * the h5 file for postprocessing/visualization purposes
      */
     if (get_cell_data){
-        readActiveCells(file_path);
-        readReservoirPressure(file_path);
-        readSaturation(file_path);
+        readActiveCells();
+        readReservoirPressure();
+        readSaturation();
     }
 }
 
-void Hdf5SummaryReader::readSaturation(std::string file_path) {
-
-    // Check file exists
-    H5File file(file_path, H5F_ACC_RDONLY);
-    Group group = Group(file.openGroup(GROUP_NAME_FLOW_TRANSPORT));
-    auto dataset_exists = H5Lexists(group.getId(), "GRIDPROPTIME", H5F_ACC_RDONLY);
-    std::vector<std::vector<double>> sgas, soil, swat;
-
-    if (dataset_exists) {
-
-        hsize_t SOIL, SWAT, SGAS;
-        if (number_of_phases() < 3){
-            SGAS = 0;
-            SOIL = 2; // col: 3
-            SWAT = 1; // col: 2
-        }else{
-            SGAS = 1; // col: 2
-            SOIL = 2; // col: 3
-            SWAT = 3; // col: 4
-        }
-
-        sgas_ = getSaturation(group, SGAS);
-        soil_ = getSaturation(group, SOIL);
-        swat_ = getSaturation(group, SWAT);
-
-    }else{
-
-        sgas_ = reservoir_pressure();
-        soil_ = reservoir_pressure();
-        swat_ = reservoir_pressure();
-    }
+void Hdf5SummaryReader::readSaturation() {
+    sgas_ = cell_data(SGAS);
+    soil_ = cell_data(SOIL);
+    swat_ = cell_data(SWAT);
 }
 
-std::vector<std::vector<double>> Hdf5SummaryReader::getSaturation(
-        Group group, hsize_t sat_type) {
-
-    // Read the file
-    DataSet dataset = DataSet(group.openDataSet(DATASET_NAME_SATURATION));
-    DataSpace dataspace = dataset.getSpace();
-    hsize_t dims[3];
-    dataspace.getSimpleExtentDims(dims, NULL);
-
-    std::vector<double> vector;
-    vector.resize(dims[0] * dims[2]);
-    std::vector<std::vector<double>>  sat_; //!< Temporary saturation vector.
+void Hdf5SummaryReader::readReservoirPressure() {
+    pressure_ = cell_data(PRESSURE);
+}
 
-    if (sat_type > 0){
-        // Define hyperslab
-        hsize_t count[3] = {dims[0], 1, dims[2]};
-        hsize_t offset[3] = {0, sat_type, 0};
-        dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+std::vector<double> Hdf5SummaryReader::cell_data(CellDataType type,
+                                                 const std::vector<int> &time_steps) const {
+    return cellData<double>(type, time_steps, PredType::NATIVE_DOUBLE);
+}
 
-        // Size of selected column + define memory space
-        hsize_t col_sz[2] = {dims[0], dims[2]};
-        DataSpace mspace(2, col_sz);
+std::vector<float> Hdf5SummaryReader::cell_data_f(CellDataType type,
+                                                  const std::vector<int> &time_steps) const {
+    return cellData<float>(type, time_steps, PredType::NATIVE_FLOAT);
+}
 
-        dataset.read(vector.data(), PredType::NATIVE_DOUBLE, mspace, dataspace);
-    }else{
-        vector.resize(dims[0] * dims[2],0);
+template<typename T>
+std::vector<T> Hdf5SummaryReader::cellData(CellDataType type,
+                                           const std::vector<int> &time_steps,
+                                           const PredType &mem_type) const {
+    if (type == PRESSURE) {
+        return readCellColumn<T>(DATASET_NAME_PRESSURE, 0, time_steps, mem_type);
     }
 
-    int ncells = (int)dims[0];
-    int ntime_steps = (int)dims[2];
+    // Saturations are read from GRIDPROPTIME if it exists; if it does
+    // not, the pressure is returned in its place.
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    if (!H5Lexists(group.getId(), DATASET_NAME_SATURATION.c_str(), H5P_DEFAULT)) {
+        return readCellColumn<T>(DATASET_NAME_PRESSURE, 0, time_steps, mem_type);
+    }
 
-    for (int tt = 0; tt < ntime_steps; ++tt) {
-        std::vector<double> sub;
-        for (int cc = 0; cc < ncells; ++cc) {
-            sub.push_back(vector[ cc * ntime_steps + tt ]);
+    hsize_t column;
+    if (number_of_phases() < 3) {
+        if (type == SGAS) { // Gas is not present in two-phase models
+            int nsteps = time_steps.empty() ? ntimes_ : (int)time_steps.size();
+            return std::vector<T>(nsteps * cell_data_num_cells(), 0);
         }
-        sat_.push_back(sub);
+        column = type == SOIL ? 2 : 1; // col: 3 / col: 2
+    } else {
+        column = type == SGAS ? 1 : type == SOIL ? 2 : 3; // col: 2 / 3 / 4
     }
-
-    return sat_;
+    return readCellColumn<T>(DATASET_NAME_SATURATION, column, time_steps, mem_type);
 }
 
-void Hdf5SummaryReader::readReservoirPressure(std::string file_path) {
-
-    // Read the file
-    H5File file(file_path, H5F_ACC_RDONLY);
-    Group group = Group(file.openGroup(GROUP_NAME_FLOW_TRANSPORT));
-    DataSet dataset = DataSet(group.openDataSet(DATASET_NAME_PRESSURE));
-
+template<typename T>
+std::vector<T> Hdf5SummaryReader::readCellColumn(const H5std_string &dataset_name,
+                                                 hsize_t column,
+                                                 const std::vector<int> &time_steps,
+                                                 const PredType &mem_type) const {
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    DataSet dataset = group.openDataSet(dataset_name);
     DataSpace dataspace = dataset.getSpace();
     hsize_t dims[3];
 
     auto rank = dataspace.getSimpleExtentDims(dims, NULL);
     if (debug_){
         std::cout << "[\033[1;33m" << BOOST_CURRENT_FUNCTION << ":\033[0m\n"
-                  << "dataset rank " << rank << ", dims "
+                  << dataset_name << " rank " << rank << ", dims "
                   << (unsigned long)(dims[0]) << " x "
                   << (unsigned long)(dims[1]) << " x "
                   << (unsigned long)(dims[2]) << std::endl;
     }
 
-    // Define hyperslab
-    hsize_t count[3] = {dims[0], 1, dims[2]};
-    hsize_t offset[3] = {0, 0, 0};
-    dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
-
-    // Size of selected column + define memory space
-    hsize_t col_sz[2] = {dims[0], dims[2]};
-    DataSpace mspace(2, col_sz);
-
-    std::vector<double> vector;
-    vector.resize(dims[0] * dims[2]);
-    dataset.read(vector.data(), PredType::NATIVE_DOUBLE, mspace, dataspace);
-
-    // Reorder pressure vector
-    // Note:
-    // Data/time component ordering inside data vector:
-    // Example: pressure vector with 5 cells over 8 time steps:
-    // size of vector = ncells (x ndata_cols=1) x ntime_steps
+    // Data/time component ordering inside the dataset:
+    // Example: pressure column with 5 cells over 8 time steps:
     //
     //        cell 1   cell 2   cell 3   cell 4   cell 5
     //time  |--------|--------|--------|--------|--------|
     //steps: 12345678 12345678 12345678 12345678 12345678
+    //
+    // The returned buffer is time-major: all cells for the first
+    // requested step, then all cells for the next, etc.
+    hsize_t ncells = dims[0];
+    hsize_t nsteps = dims[2];
+    std::vector<T> flat;
+
+    if (time_steps.empty()) {
+        // Read the whole column in one go, then transpose.
+        hsize_t count[3] = {ncells, 1, nsteps};
+        hsize_t offset[3] = {0, column, 0};
+        dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+        hsize_t col_sz[2] = {ncells, nsteps};
+        DataSpace mspace(2, col_sz);
 
-         int ncells = (int)dims[0];
-     int ndata_cols = (int)dims[1];
-    int ntime_steps = (int)dims[2];
+        std::vector<T> cell_major(ncells * nsteps);
+        dataset.read(cell_major.data(), mem_type, mspace, dataspace);
 
-    for (int tt = 0; tt < ntime_steps; ++tt) {
-        std::vector<double> sub;
-        for (int cc = 0; cc < ncells; ++cc) {
-            sub.push_back(vector[ cc * ntime_steps + tt ]);
+        flat.resize(ncells * nsteps);
+        for (hsize_t cc = 0; cc < ncells; ++cc) {
+            const T *src = &cell_major[cc * nsteps];
+            for (hsize_t tt = 0; tt < nsteps; ++tt) {
+                flat[tt * ncells + cc] = src[tt];
+            }
+        }
+    } else {
+        // Read one (strided) cell vector per requested time step,
+        // directly into its place in the output buffer.
+        flat.resize(ncells * time_steps.size());
+        hsize_t mem_sz[1] = {ncells};
+        DataSpace mspace(1, mem_sz);
+        for (int k = 0; k < time_steps.size(); ++k) {
+            if (time_steps[k] < 0 || time_steps[k] >= (int)nsteps) {
+                throw std::runtime_error("Hdf5SummaryReader: Time step index "
+                                             + boost::lexical_cast<std::string>(time_steps[k])
+                                             + " is out of range.");
+            }
+            hsize_t count[3] = {ncells, 1, 1};
+            hsize_t offset[3] = {0, column, (hsize_t)time_steps[k]};
+            dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+            dataset.read(&flat[k * ncells], mem_type, mspace, dataspace);
         }
-        pressure_.push_back(sub);
     }
+    return flat;
+}
+
+int Hdf5SummaryReader::cell_data_num_cells() const {
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    DataSet dataset = group.openDataSet(DATASET_NAME_PRESSURE);
+    hsize_t dims[3];
+    dataset.getSpace().getSimpleExtentDims(dims, NULL);
+    return (int)dims[0];
+}
+
+std::vector< std::vector<double> > Hdf5SummaryReader::unflatten(const std::vector<double> &flat) const {
+    std::vector< std::vector<double> > nested;
+    if (flat.empty()) return nested;
+    size_t ncells = flat.size() / ntimes_;
+    nested.reserve(ntimes_);
+    for (int tt = 0; tt < ntimes_; ++tt) {
+        nested.emplace_back(flat.begin() + tt * ncells, flat.begin() + (tt + 1) * ncells);
+    }
+    return nested;
 }
 
-void Hdf5SummaryReader::readActiveCells(std::string file_path) {
+void Hdf5SummaryReader::readActiveCells() {
 
     // Read the file
-    H5File file(file_path, H5F_ACC_RDONLY);
-    Group group = Group(file.openGroup(GROUP_NAME_FLOW_TRANSPORT));
-    DataSet dataset = DataSet(group.openDataSet(DATASET_NAME_ACTIVE_CELLS));
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    DataSet dataset = group.openDataSet(DATASET_NAME_ACTIVE_CELLS);
 
     DataSpace dataspace = dataset.getSpace();
     hsize_t dims[2];
@@ -211,19 +221,15 @@ void Hdf5SummaryReader::readActiveCells(std::string file_path) {
     DataSpace mspace( 1, col_sz );
 
     // Read and reorder vector
-    std::vector<int> vector;
-    vector.resize(dims[0]);
-    dataset.read(vector.data(), PredType::NATIVE_INT, mspace, dataspace);
-
-    cells_all_vector_ = vector;
+    cells_all_vector_.resize(dims[0]);
+    dataset.read(cells_all_vector_.data(), PredType::NATIVE_INT, mspace, dataspace);
     cells_find_statuses(cells_all_vector_);
 }
 
-void Hdf5SummaryReader::readTimeVector(std::string file_path) {
+void Hdf5SummaryReader::readTimeVector() {
     // Read the file
-    H5File file(file_path, H5F_ACC_RDONLY);
-    Group group = Group(file.openGroup(GROUP_NAME_RESTART));
-    DataSet dataset = DataSet(group.openDataSet(DATASET_NAME_TIMES));
+    Group group = file_.openGroup(GROUP_NAME_RESTART);
+    DataSet dataset = group.openDataSet(DATASET_NAME_TIMES);
 
     // Check that the type is correct
     H5T_class_t type_class = dataset.getTypeClass();
@@ -235,23 +241,19 @@ void Hdf5SummaryReader::readTimeVector(std::string file_path) {
     dataspace.getSimpleExtentDims(dims, NULL);
 
     // Check size of time vector is > 1, otherwise tricky errors
-    // occurs further downstream in readWellStates()
+    // occurs further downstream when parsing the well states
     if ( (int)dims[0] < 2) {
         throw std::runtime_error("TIME vector has only one component! "
                                  "Check your simulation H5 output.");
     }
 
-    std::vector<double> vector;
-    vector.resize(dims[0]);
-    dataset.read(vector.data(), PredType::NATIVE_DOUBLE);
-    times_ = vector;
+    times_.resize(dims[0]);
+    dataset.read(times_.data(), PredType::NATIVE_DOUBLE);
 }
 
-void Hdf5SummaryReader::readWellStates(std::string file_path) {
-    // Read the file
-    H5File file(file_path, H5F_ACC_RDONLY);
-    Group group = Group(file.openGroup(GROUP_NAME_FLOW_TRANSPORT));
-    DataSet dataset = DataSet(group.openDataSet(DATASET_NAME_WELL_STATES));
+void Hdf5SummaryReader::readWellStateDims() {
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    DataSet dataset = group.openDataSet(DATASET_NAME_WELL_STATES);
 
     DataSpace dataspace = dataset.getSpace();
     hsize_t dims[2];
@@ -259,6 +261,16 @@ void Hdf5SummaryReader::readWellStates(std::string file_path) {
 
     nwells_ = (int)dims[0];
     ntimes_ = (int)dims[1];
+    well_states_.resize(nwells_);
+    well_parsed_.assign(nwells_, false);
+
+    // The number of phases is the same for all wells; get it from the first.
+    nphases_ = nwells_ > 0 ? wellState(0).nphases : 0;
+}
+
+void Hdf5SummaryReader::readWellStateRow(int wnr, std::vector<wstype_t> &ws) const {
+    Group group = file_.openGroup(GROUP_NAME_FLOW_TRANSPORT);
+    DataSet dataset = group.openDataSet(DATASET_NAME_WELL_STATES);
 
     CompType ctype(sizeof(wstype_t));
     auto double_type = PredType::NATIVE_DOUBLE;
@@ -273,10 +285,17 @@ void Hdf5SummaryReader::readWellStates(std::string file_path) {
     ctype.insertMember("vIntData", HOFFSET(wstype_t, vIntData_handle), vint_type);
     ctype.insertMember("vDoubleData", HOFFSET(wstype_t, vDoubleData_handle), vdouble_type);
 
-    std::vector<wstype_t> data_vector;
-    data_vector.resize(dims[0] * dims[1]);
-    dataset.read(data_vector.data(), ctype);
-    for (wstype_t &m : data_vector) {
+    // Select the row for this well only
+    DataSpace dataspace = dataset.getSpace();
+    hsize_t count[2] = { 1, (hsize_t)ntimes_ };
+    hsize_t offset[2] = { (hsize_t)wnr, 0 };
+    dataspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    hsize_t row_sz[1] = { (hsize_t)ntimes_ };
+    DataSpace mspace(1, row_sz);
+
+    ws.resize(ntimes_);
+    dataset.read(ws.data(), ctype, mspace, dataspace);
+    for (wstype_t &m : ws) {
         m.vPressures.assign(static_cast<double*>(m.vPressures_handle.p),
                             static_cast<double*>(m.vPressures_handle.p) + m.vPressures_handle.len);
         m.vTemperatures.assign(static_cast<double*>(m.vTemperatures_handle.p),
@@ -292,91 +311,97 @@ void Hdf5SummaryReader::readWellStates(std::string file_path) {
         m.vDoubleData.assign(static_cast<double*>(m.vDoubleData_handle.p),
                              static_cast<double*>(m.vDoubleData_handle.p) + m.vDoubleData_handle.len);
     }
-    parseWsVector(data_vector);
 
+    // Release the variable length buffers allocated by HDF5
+    DataSet::vlenReclaim(ctype, mspace, DSetMemXferPropList::DEFAULT, ws.data());
 }
 
-void Hdf5SummaryReader::parseWsVector(std::vector<wstype_t> &wsvec) {
-    assert(wsvec.size() == nwells_*ntimes_);
-    well_states_.resize(nwells_);
-    for (int well = 0; well < nwells_; ++well) {
-        well_states_[well] = parseWellState(wsvec, well);
+const Hdf5SummaryReader::well_data &Hdf5SummaryReader::wellState(int wnr) const {
+    if (wnr < 0 || wnr >= nwells_) {
+        throw std::runtime_error("Hdf5SummaryReader: Well number "
+                                     + boost::lexical_cast<std::string>(wnr)
+                                     + " is out of range.");
+    }
+    if (!well_parsed_[wnr]) {
+        std::vector<wstype_t> ws;
+        readWellStateRow(wnr, ws);
+        well_states_[wnr] = parseWellState(ws, wnr);
+        well_parsed_[wnr] = true;
     }
-    nphases_ = well_states_[0].nphases;
+    return well_states_[wnr];
 }
 
-Hdf5SummaryReader::well_data Hdf5SummaryReader::parseWellState(std::vector<wstype_t> &ws, int wnr) {
-    int first = wnr*ntimes_;
-    int last = first + ntimes_;
-    int nperfs = (int)ws[first].vAverageDensity.size();
+Hdf5SummaryReader::well_data Hdf5SummaryReader::parseWellState(std::vector<wstype_t> &ws, int wnr) const {
+    assert(ws.size() == ntimes_);
+    int nperfs = (int)ws[0].vAverageDensity.size();
     auto state = Hdf5SummaryReader::well_data(ntimes_, nperfs);
-    state.nphases = (int)ws[first].vPhaseRates.size() / nperfs;
-    int t = 0;
-    for (int i = first; i < last; ++i) { // Well data at each time step
-        state.well_types[t] = ws[i].vIntData[0];
-        state.phase_status[t] = ws[i].vIntData[1];
-        state.well_controls[t] = ws[i].vIntData[2];
-        state.bottom_hole_pressures[t] = ws[i].vPressures[0];
+    state.nphases = (int)ws[0].vPhaseRates.size() / nperfs;
+    for (int p = 0; p < nperfs; ++p) {
+        state.perforation_states[p] = perforation_data(ntimes_);
+    }
+    for (int t = 0; t < ntimes_; ++t) { // Well data at each time step
+        state.well_types[t] = ws[t].vIntData[0];
+        state.phase_status[t] = ws[t].vIntData[1];
+        state.well_controls[t] = ws[t].vIntData[2];
+        state.bottom_hole_pressures[t] = ws[t].vPressures[0];
         if (state.nphases == 2) {
-            state.water_rates_sc[t] = ws[i].vPhaseRatesAtSC[0];
-            state.oil_rates_sc[t] = ws[i].vPhaseRatesAtSC[1];
-            state.gas_rates_sc = std::vector<double>(ntimes_, 0.0);
+            state.water_rates_sc[t] = ws[t].vPhaseRatesAtSC[0];
+            state.oil_rates_sc[t] = ws[t].vPhaseRatesAtSC[1];
+            state.gas_rates_sc[t] = 0.0;
         }
         else if (state.nphases == 3) {
-            state.gas_rates_sc[t] = ws[i].vPhaseRatesAtSC[0];
-            state.oil_rates_sc[t] = ws[i].vPhaseRatesAtSC[1];
-            state.water_rates_sc[t] = ws[i].vPhaseRatesAtSC[2];
+            state.gas_rates_sc[t] = ws[t].vPhaseRatesAtSC[0];
+            state.oil_rates_sc[t] = ws[t].vPhaseRatesAtSC[1];
+            state.water_rates_sc[t] = ws[t].vPhaseRatesAtSC[2];
         } else throw std::runtime_error("Can only handle models with 2 or 3 phases, found " + boost::lexical_cast<std::string>(state.nphases));
         for (int p = 0; p < nperfs; ++p) { // Perforation data at each time step
-            state.perforation_states[p] = perforation_data(ntimes_);
-            state.perforation_states[p].pressures[t] = ws[i].vPressures[p+1];
-            state.perforation_states[p].temperatures[t] = ws[i].vTemperatures[p];
-            state.perforation_states[p].average_densities[t] = ws[i].vAverageDensity[p];
+            state.perforation_states[p].pressures[t] = ws[t].vPressures[p+1];
+            state.perforation_states[p].temperatures[t] = ws[t].vTemperatures[p];
+            state.perforation_states[p].average_densities[t] = ws[t].vAverageDensity[p];
             if (state.nphases == 2) {
-                state.perforation_states[p].water_rates[t] = ws[i].vPhaseRates[p*2 + 0];
-                state.perforation_states[p].oil_rates[t] = ws[i].vPhaseRates[p*2 + 1];
+                state.perforation_states[p].water_rates[t] = ws[t].vPhaseRates[p*2 + 0];
+                state.perforation_states[p].oil_rates[t] = ws[t].vPhaseRates[p*2 + 1];
             }
             else if (state.nphases == 3) {
-                state.perforation_states[p].gas_rates[t] = ws[i].vPhaseRates[p*3 + 0];
-                state.perforation_states[p].oil_rates[t] = ws[i].vPhaseRates[p*3 + 1];
-                state.perforation_states[p].water_rates[t] = ws[i].vPhaseRates[p*3 + 2];
+                state.perforation_states[p].gas_rates[t] = ws[t].vPhaseRates[p*3 + 0];
+                state.perforation_states[p].oil_rates[t] = ws[t].vPhaseRates[p*3 + 1];
+                state.perforation_states[p].water_rates[t] = ws[t].vPhaseRates[p*3 + 2];
             } else throw std::runtime_error("Can only handle models with 2 or 3 phases.");
         }
-        ++t;
     }
     return state;
 }
 
 int Hdf5SummaryReader::well_type(const int well_number) const {
-    return well_states_[well_number].well_types[0];
+    return wellState(well_number).well_types[0];
 }
 
 bool Hdf5SummaryReader::is_injector(const int well_number) const {
-    return well_states_[well_number].is_injector();
+    return wellState(well_number).is_injector();
 }
 
 int Hdf5SummaryReader::number_of_perforations(const int well_number) const {
-    return well_states_[well_number].nperfs;
+    return wellState(well_number).nperfs;
 }
 
 int Hdf5SummaryReader::number_of_phases(const int well_number) const {
-    return well_states_[well_number].nphases;
+    return wellState(well_number).nphases;
 }
 
 const std::vector<double> &Hdf5SummaryReader::bottom_hole_pressures(const int well_number) const {
-    return well_states_[well_number].bottom_hole_pressures;
+    return wellState(well_number).bottom_hole_pressures;
 }
 
 const std::vector<double> &Hdf5SummaryReader::oil_rates_sc(const int well_number) const {
-    return well_states_[well_number].oil_rates_sc;
+    return wellState(well_number).oil_rates_sc;
 }
 
 const std::vector<double> &Hdf5SummaryReader::water_rates_sc(const int well_number) const {
-    return well_states_[well_number].water_rates_sc;
+    return wellState(well_number).water_rates_sc;
 }
 
 const std::vector<double> &Hdf5SummaryReader::gas_rates_sc(const int well_number) const {
-    return well_states_[well_number].gas_rates_sc;
+    return wellState(well_number).gas_rates_sc;
 }
 
 std::vector<double> Hdf5SummaryReader::calculate_cumulative(const std::vector<double> &rates) const {
@@ -403,7 +428,7 @@ std::vector<double> Hdf5SummaryReader::field_oil_rates_sc() const {
     std::vector<double> sum(ntimes_, 0.0);
     for (int w = 0; w < nwells_; ++w) {
         if (is_injector(w)) continue; // Skip injectors
-        auto well_rates = oil_rates_sc(w);
+        const auto &well_rates = oil_rates_sc(w);
         for (int t = 0; t < ntimes_; ++t) {
             sum[t] = sum[t] + well_rates[t];
         }
@@ -415,7 +440,7 @@ std::vector<double> Hdf5SummaryReader::field_water_rates_sc() const {
     std::vector<double> sum(ntimes_, 0.0);
     for (int w = 0; w < nwells_; ++w) {
         if (is_injector(w)) continue; // Skip injectors
-        auto well_rates = water_rates_sc(w);
+        const auto &well_rates = water_rates_sc(w);
         for (int t = 0; t < ntimes_; ++t) {
             sum[t] = sum[t] + well_rates[t];
         }
@@ -428,7 +453,7 @@ std::vector<double> Hdf5SummaryReader::field_gas_rates_sc() const {
     std::vector<double> sum(ntimes_, 0.0);
     for (int w = 0; w < nwells_; ++w) {
         if (is_injector(w)) continue; // Skip injectors
-        auto well_rates = gas_rates_sc(w);
+        const auto &well_rates = gas_rates_sc(w);
         for (int t = 0; t < ntimes_; ++t) {
             sum[t] = sum[t] + well_rates[t];
         }
@@ -455,6 +480,7 @@ int Hdf5SummaryReader::cells_find_statuses(std::vector<int> &cells_all_vector_)
        cells_total_num_ = (int)cells_all_vector_.size();
       cells_num_active_ = (int)cells_active_.size();
     cells_num_inactive_ = (int)cells_inactive_.size();
+    return cells_num_active_;
 }
 
 std::vector<double> Hdf5SummaryReader::field_cumulative_oil_production_sc() const {
@@ -525,7 +551,7 @@ std::vector<double> Hdf5SummaryReader::field_water_injection_rates_sc() const {
     std::vector<double> sum(ntimes_, 0.0);
     for (int w = 0; w < nwells_; ++w) {
         if (!is_injector(w)) continue; // Skip producers
-        auto well_rates = water_injection_rates_sc(w);
+        const auto &well_rates = water_injection_rates_sc(w);
         for (int t = 0; t < ntimes_; ++t) {
             sum[t] = sum[t] + well_rates[t];
         }
@@ -537,7 +563,7 @@ std::vector<double> Hdf5SummaryReader::field_gas_injection_rates_sc() const {
     std::vector<double> sum(ntimes_, 0.0);
     for (int w = 0; w < nwells_; ++w) {
         if (!is_injector(w)) continue; // Skip producers
-        auto well_rates = gas_injection_rates_sc(w);
+        const auto &well_rates = gas_injection_rates_sc(w);
         for (int t = 0; t < ntimes_; ++t) {
             sum[t] = sum[t] + well_rates[t];
         }
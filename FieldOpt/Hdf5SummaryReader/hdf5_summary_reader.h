@@ -30,12 +30,17 @@
  * \todo This must also be tested for a 3 phase black oil model,
  * it has only been tested for 2 phase dead oil.
  *
- * \todo Overall, Hdf5SummaryReader::readSaturation needs a better 
- * implementation that reads soil and sgas at the same time/as a 
- * single chunck from the H5 group, instead of reading from H5 one 
- * vector at a time (the thinking is that the former is probably
- * more efficient that the latter).
- * In either case, the reading functionality needs to be flexible/
+ * The summary file is opened once, in the constructor, and kept
+ * open for the lifetime of the reader. Only the time vector and the
+ * dimensions of the well state dataset are read up front; the states
+ * of a well are read (as a single row hyperslab) and parsed the first
+ * time any of its data is requested. Cell data is read on demand with
+ * cell_data(), which only reads the requested property column and
+ * time steps, and returns them in a flat, time-major buffer.
+ * Because of the lazy parsing, a reader object should not be shared
+ * between threads.
+ *
+ * \todo The saturation reading functionality needs to be flexible/
  * /robust with respect to the different phase combinations that 
  * might exist in the H5 group (currently GRIDPROPTIME), e.g., 
  * soil/sgas, soil/sgas/swat, soil/swat, etc.
@@ -58,6 +63,11 @@
  */
 class Hdf5SummaryReader {
 public:
+    /*!
+     * Cell properties that can be read with cell_data().
+     */
+    enum CellDataType { PRESSURE, SGAS, SOIL, SWAT };
+
     /*!
      * Read the HDF5 summary file written 
      * by AD-GPRS at the specified path.
@@ -82,24 +92,52 @@ public:
     const std::vector<double> &times_steps() const { return times_; }
 
     /*!
-     * Get reservoir pressure vector.
+     * Get reservoir pressure vector (time x cells). Only available
+     * if the reader was constructed with get_cell_data = true.
+     */
+    std::vector< std::vector<double> > reservoir_pressure() const { return unflatten(pressure_); }
+
+    /*!
+     * Get sgas vector (time x cells).
+     */
+    std::vector< std::vector<double> > sgas() const { return unflatten(sgas_); }
+
+    /*!
+     * Get soil vector (time x cells).
      */
-    std::vector< std::vector<double> > reservoir_pressure() const { return pressure_; }
+    std::vector< std::vector<double> > soil() const { return unflatten(soil_); }
 
     /*!
-     * Get sgas vector.
+     * Get swat vector (time x cells).
      */
-    std::vector< std::vector<double> > sgas() const { return sgas_; }
+    std::vector< std::vector<double> > swat() const { return unflatten(swat_); }
 
     /*!
-     * Get soil vector.
+     * Read a cell property directly from the summary file.
+     *
+     * Only the column holding the property is read, and only for
+     * the requested time steps.
+     * @param type Property to read.
+     * @param time_steps Indices of the time steps to read. All time
+     * steps are read if this is empty.
+     * @return Flat, time-major buffer with cell_data_num_cells()
+     * values per requested time step, i.e. the value for cell c at
+     * the k'th requested time step is found at [k*ncells + c].
      */
-    std::vector< std::vector<double> > soil() const { return soil_; }
+    std::vector<double> cell_data(CellDataType type,
+                                  const std::vector<int> &time_steps = std::vector<int>()) const;
 
     /*!
-     * Get swat vector.
+     * Same as cell_data(), but converted to single precision by
+     * HDF5 while reading, halving the memory footprint.
      */
-    std::vector< std::vector<double> > swat() const { return swat_; }
+    std::vector<float> cell_data_f(CellDataType type,
+                                   const std::vector<int> &time_steps = std::vector<int>()) const;
+
+    /*!
+     * Get the number of cells in the cell datasets.
+     */
+    int cell_data_num_cells() const;
 
     /*!
      * Return vector of active grid cells.
@@ -334,14 +372,36 @@ private:
         bool is_injector() const { return well_types[0] == 1; }
     };
 
-    void readTimeVector(std::string file_path); //!< Read the time vector from the HDF5 summary file.
-    void readWellStates(std::string file_path); //!< Read all well state information from the HDF5 summary file.
-    void parseWsVector(std::vector<wstype_t> &wsvec); //!< Populate well_states_ by creating well_data and perforation_data objects from the wstype_t vector.
-    well_data parseWellState(std::vector<wstype_t> &ws, int wnr); //!< Parse the states for a single well and create a well_data object.
+    H5::H5File file_; //!< The summary file. Opened in the constructor and kept open.
+
+    void readTimeVector(); //!< Read the time vector from the HDF5 summary file.
+    void readWellStateDims(); //!< Read the dimensions of the well states dataset and the number of phases.
+    void readWellStateRow(int wnr, std::vector<wstype_t> &ws) const; //!< Read the states for a single well at all time steps.
+    well_data parseWellState(std::vector<wstype_t> &ws, int wnr) const; //!< Parse the states for a single well and create a well_data object.
+    const well_data &wellState(int wnr) const; //!< Get the states for a well, reading and parsing them if necessary.
 
-    void readActiveCells(std::string file_path); //!< Read vector defining which cells are active from the HDF5 summary file.
-    void readReservoirPressure(std::string file_path); //!< Read reservoir cell pressures for each time step.
-    void readSaturation(std::string file_path); //!< Read cell saturations for each time step.
+    void readActiveCells(); //!< Read vector defining which cells are active from the HDF5 summary file.
+    void readReservoirPressure(); //!< Read reservoir cell pressures for each time step.
+    void readSaturation(); //!< Read cell saturations for each time step.
+
+    /*!
+     * Read a column of a cells x columns x time steps dataset in the
+     * FLOW_TRANSPORT group into a flat time-major buffer.
+     * @param mem_type HDF5 memory type matching T.
+     */
+    template<typename T>
+    std::vector<T> readCellColumn(const H5std_string &dataset_name, hsize_t column,
+                                  const std::vector<int> &time_steps,
+                                  const H5::PredType &mem_type) const;
+
+    template<typename T>
+    std::vector<T> cellData(CellDataType type, const std::vector<int> &time_steps,
+                            const H5::PredType &mem_type) const;
+
+    /*!
+     * Split a flat time-major buffer into a vector per time step.
+     */
+    std::vector< std::vector<double> > unflatten(const std::vector<double> &flat) const;
 
     /*!
      * Variables containing information about the reservoir cell ensemble,
@@ -363,12 +423,10 @@ private:
     bool cell_data_; //!< Flag for whether to read cell data from h5 file
 
     std::vector<double> times_; //!< Vector containing all time steps.
-    std::vector< std::vector<double> > pressure_; //!< Vector containing reservoir pressures.
-    std::vector< std::vector<double> > soil_; //!< Vector containing oil saturation.
-    std::vector< std::vector<double> > sgas_; //!< Vector containing gas saturation.
-    std::vector< std::vector<double> > swat_; //!< Vector containing water saturation.
-
-    std::vector<std::vector<double>> getSaturation(H5::Group dataset, hsize_t sat_type);
+    std::vector<double> pressure_; //!< Reservoir pressures (flat, time-major).
+    std::vector<double> soil_; //!< Oil saturation (flat, time-major).
+    std::vector<double> sgas_; //!< Gas saturation (flat, time-major).
+    std::vector<double> swat_; //!< Water saturation (flat, time-major).
 
     /*!
      * debug_ Flag used by tests (only) to get additional info from
@@ -402,7 +460,8 @@ private:
      */
     std::vector<double> calculate_cumulative(const std::vector<double> &rates) const;
 
-    std::vector<well_data> well_states_; //!< Vector containing all information from the well states dataset.
+    mutable std::vector<well_data> well_states_; //!< Parsed well states. Populated lazily by wellState().
+    mutable std::vector<bool> well_parsed_; //!< Whether the states for a well have been parsed.
 };
 
 
@@ -93,6 +93,34 @@ namespace {
         // }
     }
 
+    TEST_F(Hdf5SummaryReaderTest, SelectiveCellData) {
+        auto reader = Hdf5SummaryReader(file_path);
+        int ncells = reader.cell_data_num_cells();
+        EXPECT_EQ(3600, ncells);
+
+        // Full read is flat and time-major
+        auto pressure = reader.cell_data(Hdf5SummaryReader::PRESSURE);
+        ASSERT_EQ(8 * ncells, pressure.size());
+        EXPECT_DOUBLE_EQ(370.555603, pressure[0]);
+        EXPECT_DOUBLE_EQ(151.17045510746573, pressure[7 * ncells]);
+
+        // Selected time steps match the corresponding slices of the full read
+        std::vector<int> steps = {7, 2};
+        auto selected = reader.cell_data(Hdf5SummaryReader::PRESSURE, steps);
+        ASSERT_EQ(2 * ncells, selected.size());
+        for (int c = 0; c < ncells; ++c) {
+            EXPECT_DOUBLE_EQ(pressure[7 * ncells + c], selected[c]);
+            EXPECT_DOUBLE_EQ(pressure[2 * ncells + c], selected[ncells + c]);
+        }
+
+        // Single precision read
+        auto pressure_f = reader.cell_data_f(Hdf5SummaryReader::PRESSURE, {3});
+        ASSERT_EQ(ncells, pressure_f.size());
+        EXPECT_FLOAT_EQ(281.07546615360917f, pressure_f[0]);
+
+        EXPECT_THROW(reader.cell_data(Hdf5SummaryReader::PRESSURE, {8}), std::runtime_error);
+    }
+
     TEST_F(Hdf5SummaryReaderTest, IntegerData) {
         auto reader = Hdf5SummaryReader(file_path);
         int expected_types[5] = {1, -1, -1, -1, -1};
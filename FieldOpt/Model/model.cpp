@@ -18,9 +18,15 @@
 ******************************************************************************/
 
 #include "model.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 #include <boost/lexical_cast.hpp>
 #include "Utilities/verbosity.h"
 #include "Utilities/printer.hpp"
+#include "Utilities/time.hpp"
+#include "Utilities/trace.hpp"
 
 namespace Model {
 
@@ -34,7 +40,20 @@ Model::Model(Settings::Settings settings, Logger *logger)
         grid_ = 0;
         wic_ = nullptr;
     }
+    initialize(settings, logger);
+}
+
+Model::Model(Settings::Settings settings, Logger *logger, Model *shared_grid_model)
+{
+    grid_ = shared_grid_model->grid_;
+    wic_ = shared_grid_model->wic_;
+    initialize(settings, logger);
+}
+
+void Model::initialize(Settings::Settings &settings, Logger *logger)
+{
     current_case_ = nullptr;
+    wic_threads_ = settings.model()->wic_threads();
 
     variable_container_ = new Properties::VariablePropertyContainer();
 
@@ -60,6 +79,7 @@ void Model::Finalize() {
 
 void Model::ApplyCase(Optimization::Case *c)
 {
+    Utilities::Trace::Span span("model.apply_case");
 
     // Notify the logger to log previous case.
     if (current_case_ != nullptr && current_case_->state.eval != Optimization::Case::CaseState::EvalStatus::E_PENDING) {
@@ -80,17 +100,22 @@ void Model::ApplyCase(Optimization::Case *c)
     for (QUuid key : c->real_variables().keys()) {
         variable_container_->SetContinousVariableValue(key, c->real_variables()[key]);
     }
-    int cumulative_wic_time = 0;
+    auto wic_start = QDateTime::currentDateTime();
+    Utilities::Trace::Span wells_span("model.update_wells");
+    updateWells();
+    wells_span.End();
+    auto wic_end = QDateTime::currentDateTime();
+
     bool wic_used = false;
+    well_wic_msecs_.clear();
     for (Wells::Well *w : *wells_) {
-        w->Update();
-        if (w->trajectory()->GetDefinitionType() == Settings::Model::WellDefinitionType::WellSpline) {
-            cumulative_wic_time += w->GetTimeSpentInWIC();
+        if (w->trajectory()->GetWellSpline() != 0) {
+            well_wic_msecs_[w->name().toStdString()] = w->GetMsecsSpentInWIC();
             wic_used = true;
         }
     }
-    if (wic_used) {
-        c->SetWICTime(cumulative_wic_time);
+    if (wic_used) { // Wall time; the wells may have been computed concurrently.
+        c->SetWICTime(time_span_seconds(wic_start, wic_end));
     }
     else {
         c->SetWICTime(0);
@@ -102,6 +127,56 @@ void Model::ApplyCase(Optimization::Case *c)
 //    results_.clear();
 }
 
+void Model::updateWells()
+{
+    QList<Wells::Well *> spline_wells;
+    for (Wells::Well *w : *wells_) {
+        if (w->trajectory()->GetWellSpline() != 0) {
+            spline_wells.append(w);
+        }
+        else {
+            w->Update();
+        }
+    }
+
+    int n_threads = wic_threads_ > 0 ? wic_threads_ : (int)std::thread::hardware_concurrency();
+    n_threads = std::max(1, std::min(n_threads, spline_wells.size()));
+    if (n_threads == 1) {
+        for (Wells::Well *w : spline_wells) {
+            w->Update();
+        }
+        return;
+    }
+
+    if (VERB_MOD >= 2) {
+        Printer::ext_info("Updating " + Printer::num2str(spline_wells.size()) + " spline wells using "
+                              + Printer::num2str(n_threads) + " threads.", "Model", "Model");
+    }
+    std::atomic<int> next_well(0);
+    std::vector<std::exception_ptr> errors(n_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&spline_wells, &next_well, &errors, t]() {
+            try {
+                for (int i = next_well++; i < spline_wells.size(); i = next_well++) {
+                    spline_wells.at(i)->Update();
+                }
+            }
+            catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 void Model::verify()
 {
     verifyWells();
@@ -196,6 +271,9 @@ map<string, vector<double>> Model::GetValues() {
     for (auto const var : variable_container_->GetBinaryVariables()->values()) {
         valmap["Var#"+var->name().toStdString()] = vector<double>{var->value()};
     }
+    for (auto const item : well_wic_msecs_) {
+        valmap["Wic#"+item.first] = vector<double>{(double)item.second};
+    }
     if (realization_ofv_map_.keys().size() > 0) {
         for (auto const key : realization_ofv_map_.keys()) {
             valmap["Rea#"+key.toStdString()] = vector<double>{realization_ofv_map_[key]};
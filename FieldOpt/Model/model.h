@@ -47,6 +47,15 @@ class Model : public Loggable
  public:
   Model(::Settings::Settings settings, Logger *logger);
 
+  /*!
+   * \brief Create a model that uses the grid and well index calculator of another model
+   * instead of loading its own, so that several models (e.g. one per concurrently evaluated
+   * case) can share them. The wells and variables are created from the settings as usual.
+   *
+   * The grid must not be switched (set_grid_path) while models sharing it are in use.
+   */
+  Model(::Settings::Settings settings, Logger *logger, Model *shared_grid_model);
+
   LogTarget GetLogTarget() override;
   map<string, string> GetState() override;
   QUuid GetId() override;
@@ -97,12 +106,26 @@ class Model : public Loggable
   Properties::VariablePropertyContainer *variable_container_;
   QList<Wells::Well *> *wells_;
   void verify(); //!< Verify the model. Throws an exception if it is not.
+  void initialize(::Settings::Settings &settings, Logger *logger); //!< Create the wells and variables. grid_ and wic_ must be set.
 
   void verifyWells();
   void verifyWellTrajectory(Wells::Well *w);
   void verifyWellBlock(Wells::Wellbore::WellBlock *wb);
   void verifyWellCompartments(Wells::Well *w);
 
+  /*!
+   * @brief Update all wells from the current variable values.
+   *
+   * Spline-defined wells (which require a well index calculation) are
+   * updated concurrently using up to wic_threads_ threads; they share the
+   * grid and WIC search tree, while all scratch data is private to each
+   * well. Other wells are updated serially. Exceptions thrown while
+   * updating a well are rethrown after all threads have finished.
+   */
+  void updateWells();
+  int wic_threads_; //!< Max number of threads used in updateWells (0: hardware concurrency).
+  std::map<std::string, int> well_wic_msecs_; //!< Milliseconds spent in the WIC for each spline well for the current case.
+
   Logger *logger_;
   QUuid current_case_id_;
   Optimization::Case *current_case_; //!< Pointer to current case. Kept for logging purposes.
@@ -23,6 +23,16 @@ TEST_F(ModelTest, ChildObjects) {
     EXPECT_GE(model_->variables()->ContinousVariableSize(), 5);
 }
 
+TEST_F(ModelTest, SharedGrid) {
+    auto model = new Model::Model(*settings_full_, logger_, model_);
+    EXPECT_EQ(model_->grid(), model->grid());
+    EXPECT_EQ(model_->wells()->size(), model->wells()->size());
+    EXPECT_EQ(model_->variables()->ContinousVariableSize(), model->variables()->ContinousVariableSize());
+    EXPECT_EQ(model_->variables()->DiscreteVariableSize(), model->variables()->DiscreteVariableSize());
+    EXPECT_EQ(model_->wells()->first()->trajectory()->GetWellBlocks()->size(),
+              model->wells()->first()->trajectory()->GetWellBlocks()->size());
+}
+
 TEST_F(ModelTest, Variables) {
     // As of 2015.11.10, the variables are:
     // 3 Continous variables (bhp at three time steps for the producer)
@@ -93,5 +93,45 @@ TEST_F(TrajectoryTest, MultisplineWell) {
 }
 
 
+TEST_F(TrajectoryTest, MdQueries) {
+    Paths paths;
+    paths.SetPath(Paths::GRID_FILE, TestResources::ExampleFilePaths::grid_5spot_);
+    auto settings = Settings::Model(TestResources::TestResourceModelSettingSnippets::model_adtl_pts(), paths);
+    auto wsettings = settings.wells()[0];
+    auto varcont = new Model::Properties::VariablePropertyContainer();
+    Model::Wells::Wellbore::Trajectory trajectory(wsettings, varcont, TestResources::TestResourceGrids::grid_5spot_, nullptr);
+    auto well_blocks = trajectory.GetWellBlocks();
+    double length = trajectory.GetLength();
+
+    // Compare with a linear scan over the blocks
+    for (double md = 0.0; md <= length; md += length / 97.0) {
+        Model::Wells::Wellbore::WellBlock *expected = nullptr;
+        for (auto wb : *well_blocks) {
+            if (md >= wb->getEntryMd() && md <= wb->getExitMd()) {
+                expected = wb;
+                break;
+            }
+        }
+        ASSERT_NE(nullptr, expected);
+        EXPECT_EQ(expected, trajectory.GetWellBlockByMd(md));
+    }
+    EXPECT_EQ(well_blocks->last(), trajectory.GetWellBlockByMd(length));
+    EXPECT_THROW(trajectory.GetWellBlockByMd(length + 1.0), std::runtime_error);
+
+    double start_md = well_blocks->at(3)->getEntryMd() + 0.1;
+    double end_md = well_blocks->at(9)->getExitMd() - 0.1;
+    auto range = trajectory.GetWellBlocksByMdRange(start_md, end_md);
+    ASSERT_EQ(7, range.size());
+    for (int b = 0; b < range.size(); ++b) {
+        EXPECT_EQ(well_blocks->at(3 + b), range[b]);
+    }
+    EXPECT_EQ(well_blocks->size(), trajectory.GetWellBlocksByMdRange(0.0, length).size());
+
+    // The index is rebuilt from the current blocks after an update
+    trajectory.UpdateWellBlocks();
+    well_blocks = trajectory.GetWellBlocks();
+    EXPECT_EQ(well_blocks->last(), trajectory.GetWellBlockByMd(trajectory.GetLength()));
+    EXPECT_EQ(well_blocks->first(), trajectory.GetWellBlockByMd(0.0));
 }
 
+}
@@ -76,6 +76,7 @@ class Well
   int heel_k() const { return heel_.k; }
   void Update();
   int GetTimeSpentInWIC() const { return trajectory_->GetTimeSpentInWic(); }
+  int GetMsecsSpentInWIC() const { return trajectory_->GetMsecsSpentInWic(); }
 
   bool HasSimpleICVs() const { return icds_.size() > 0; }
   vector<Wellbore::Completions::ICD> GetSimpleICDs() const { return icds_; }
@@ -18,6 +18,7 @@
    along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 ******************************************************************************/
 #include <iostream>
+#include <stdexcept>
 #include "pseudo_cont_vert.h"
 
 namespace Model {
@@ -42,7 +43,6 @@ PseudoContVert::PseudoContVert(Settings::Model::Well well_settings,
                   << ". Initial cell is outside grid" << std::endl;
         exit(1);
     }
-    z_pos_ = init_cell.center().z();
     x_pos_ = new Properties::ContinousProperty(init_cell.center().x());
     y_pos_ = new Properties::ContinousProperty(init_cell.center().y());
 
@@ -54,10 +54,14 @@ PseudoContVert::PseudoContVert(Settings::Model::Well well_settings,
     }
 }
 WellBlock * PseudoContVert::GetWellBlock() {
-    auto block = grid_->GetCellEnvelopingPoint(x_pos_->value(), y_pos_->value(), z_pos_);
-    auto wb = new WellBlock(block.ijk_index().i()+1,
-                            block.ijk_index().j()+1,
-                            block.ijk_index().k()+1);
+    int i, j;
+    if (!grid_->Columns().FindColumn(x_pos_->value(), y_pos_->value(), i, j)) {
+        throw std::runtime_error("PseudoContVert::GetWellBlock: The point is outside the grid ("
+                                     + std::to_string(x_pos_->value()) + ", "
+                                     + std::to_string(y_pos_->value()) + ")");
+    }
+    // Only the topmost block is penetrated
+    auto wb = new WellBlock(i+1, j+1, 1);
     auto comp = new Completions::Perforation();
     comp->setTransmissibility_factor(-1.0);
     wb->AddCompletion(comp);
@@ -42,9 +42,8 @@ namespace Wellbore {
  * one block (the topmost) is penetrated in the vertical direction. This means that
  * it's best suited for 2D reservoirs.
  *
- * Note that this class uses the depth of cell 1,1,1 as the z-coordinate when getting
- * the cell containing the xy-point, so reservoirs that don't have a flat top layer
- * will be problematic.
+ * The block is found with the grid's areal column locator (Grid::Columns()), which
+ * uses the footprints of the top layer cells, so only the xy-position is considered.
  */
 class PseudoContVert {
  public:
@@ -59,7 +58,6 @@ class PseudoContVert {
 
  private:
   Reservoir::Grid::Grid *grid_;
-  double z_pos_;
   Properties::ContinousProperty *x_pos_;
   Properties::ContinousProperty *y_pos_;
 };
@@ -78,6 +78,13 @@ int Trajectory::GetTimeSpentInWic() const {
     else return 0;
 }
 
+int Trajectory::GetMsecsSpentInWic() const {
+    if (well_spline_ != 0) {
+        return well_spline_->GetMsecsSpentInWIC();
+    }
+    else return 0;
+}
+
 WellBlock *Trajectory::GetWellBlock(int i, int j, int k)
 {
     for (int idx = 0; idx < well_blocks_->size(); ++idx) {
@@ -110,6 +117,7 @@ void Trajectory::UpdateWellBlocks()
         well_blocks_->append(pseudo_cont_vert_->GetWellBlock());
     }
     calculateDirectionOfPenetration();
+    well_blocks_version_++;
 }
 
 double Trajectory::GetLength() const {
@@ -243,14 +251,41 @@ void Trajectory::convertWellBlocksToWellSpline(Settings::Model::Well &well_setti
     well_settings.spline_points = points;
     std::cout << "Done Converting well " << well_settings.name.toStdString() << " to spline." << std::endl;
 }
+const Trajectory::MdIndex &Trajectory::mdIndex() const {
+    if (md_index_.version == well_blocks_version_) {
+        return md_index_;
+    }
+    md_index_.version = well_blocks_version_;
+    md_index_.blocks = std::vector<WellBlock *>(well_blocks_->begin(), well_blocks_->end());
+    std::stable_sort(md_index_.blocks.begin(), md_index_.blocks.end(),
+                     [](const WellBlock *a, const WellBlock *b) { return a->getEntryMd() < b->getEntryMd(); });
+
+    int n = md_index_.blocks.size();
+    md_index_.entry_md.resize(n);
+    md_index_.exit_md.resize(n);
+    md_index_.max_exit_md.resize(n);
+    for (int b = 0; b < n; ++b) {
+        md_index_.entry_md[b] = md_index_.blocks[b]->getEntryMd();
+        md_index_.exit_md[b] = md_index_.blocks[b]->getExitMd();
+        md_index_.max_exit_md[b] = b == 0 ? md_index_.exit_md[b]
+                                          : std::max(md_index_.max_exit_md[b-1], md_index_.exit_md[b]);
+    }
+    return md_index_;
+}
+int Trajectory::firstBlockReachingMd(double md) const {
+    auto &index = mdIndex();
+    // No block before this one has an exit MD >= md
+    return std::lower_bound(index.max_exit_md.begin(), index.max_exit_md.end(), md) - index.max_exit_md.begin();
+}
 WellBlock *Trajectory::GetWellBlockByMd(double md) const {
     assert(well_blocks_->size() > 0);
     if (md > GetLength()) {
         throw std::runtime_error("Attempting to get well block at MD grater than well length.");
     }
-    for (auto block : *well_blocks_) {
-        if (md <= block->getExitMd() && md >= block->getEntryMd()) {
-            return block;
+    auto &index = mdIndex();
+    for (int b = firstBlockReachingMd(md); b < index.blocks.size() && index.entry_md[b] <= md; ++b) {
+        if (md <= index.exit_md[b]) {
+            return index.blocks[b];
         }
     }
     throw std::runtime_error("Unable to get well block by MD.");
@@ -279,11 +314,12 @@ double Trajectory::GetSplineLength() const {
 }
 std::vector<WellBlock *> Trajectory::GetWellBlocksByMdRange(double start_md, double end_md) const {
     std::vector<WellBlock *> affected_blocks;
-    for (auto wb : *well_blocks_) {
-        if (( start_md >= wb->getEntryMd() && start_md <= wb->getExitMd() ) || // Start md inside block
-            (   end_md >= wb->getEntryMd() &&   end_md <= wb->getExitMd() ) || // End md inside block
-            ( start_md <= wb->getEntryMd() &&   end_md >= wb->getExitMd() )) { // Block between start and end blocks
-            affected_blocks.push_back(wb);
+    auto &index = mdIndex();
+    for (int b = firstBlockReachingMd(start_md); b < index.blocks.size() && index.entry_md[b] <= end_md; ++b) {
+        if (( start_md >= index.entry_md[b] && start_md <= index.exit_md[b] ) || // Start md inside block
+            (   end_md >= index.entry_md[b] &&   end_md <= index.exit_md[b] ) || // End md inside block
+            ( start_md <= index.entry_md[b] &&   end_md >= index.exit_md[b] )) { // Block between start and end blocks
+            affected_blocks.push_back(index.blocks[b]);
         }
     }
     return affected_blocks;
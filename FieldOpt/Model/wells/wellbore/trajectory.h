@@ -61,10 +61,11 @@ class Trajectory
   QList<WellBlock *> *GetWellBlocks(); //!< Get a list containing all well blocks.
   void UpdateWellBlocks(); //!< Update the well blocks, in particular the ones defined by a spline.
   int GetTimeSpentInWic() const;
+  int GetMsecsSpentInWic() const; //!< Milliseconds spent in the last well index calculation (0 if not spline-defined).
   Settings::Model::WellDefinitionType GetDefinitionType();
   double GetLength() const; //!< Get the length of the wellbore (measured depth from the heel to the toe)
   WellBlock *GetWellBlockByMd(double md) const; //!< Get the wellblock surrounding the given MD.
-  std::vector<WellBlock *> GetWellBlocksByMdRange(double start_md, double end_md) const;
+  std::vector<WellBlock *> GetWellBlocksByMdRange(double start_md, double end_md) const; //!< Get the well blocks overlapping the MD range, in MD order.
   double GetEntryMd(const WellBlock *wb) const; //!< Get the measured depth for the entry point to the block.
   double GetExitMd(const WellBlock *wb) const; //!< Get the measured depth for the exit point from the block.
   double GetSplineLength() const; //!< Get the length of the well trajectory (summed distance between defining points).
@@ -96,6 +97,25 @@ class Trajectory
 
   bool is_2d_; //!< Indicates if the well should only be able to vary in the x-y plane (z variables will not be created).
 
+  /*!
+   * MD index over the well blocks, used for binary search in the MD queries.
+   * The blocks are sorted by entry MD and their entry/exit MDs are stored in
+   * contiguous arrays, together with the running maximum of the exit MDs (which
+   * is non-decreasing even if blocks overlap). The index is rebuilt when its
+   * version differs from well_blocks_version_.
+   */
+  struct MdIndex {
+    int version = -1;
+    std::vector<WellBlock *> blocks;
+    std::vector<double> entry_md;
+    std::vector<double> exit_md;
+    std::vector<double> max_exit_md;
+  };
+  int well_blocks_version_ = 0; //!< Incremented by UpdateWellBlocks, which may replace or modify the well blocks.
+  mutable MdIndex md_index_;
+  const MdIndex &mdIndex() const;
+  int firstBlockReachingMd(double md) const; //!< Index (in md_index_) of the first block that may contain md.
+
   void printWellBlocks();
 
 };
@@ -89,12 +89,13 @@ WellSpline::WellSpline(Settings::Model::Well well_settings,
         }
         spline_points_.push_back(pt);
     }
-    seconds_spent_in_compute_wellblocks_ = 0;
+    msecs_spent_in_compute_wellblocks_ = 0;
 
     last_computed_grid_ = "";
     last_computed_spline_ = std::vector<Eigen::Vector3d>();
 }
 WellSpline::WellSpline() {
+    msecs_spent_in_compute_wellblocks_ = 0;
     last_computed_grid_ = "";
     last_computed_spline_ = std::vector<Eigen::Vector3d>();
 }
@@ -185,7 +186,7 @@ QList<WellBlock *> *WellSpline::computeWellBlocks() {
         }
     }
     auto end = QDateTime::currentDateTime();
-    seconds_spent_in_compute_wellblocks_ = time_span_seconds(start, end);
+    msecs_spent_in_compute_wellblocks_ = start.msecsTo(end);
 
     QList<WellBlock *> *blocks = new QList<WellBlock *>();
     for (int i = 0; i < block_data.size(); ++i) {
@@ -199,7 +200,7 @@ QList<WellBlock *> *WellSpline::computeWellBlocks() {
         throw WellBlocksNotDefined("WIC could not compute.");
     }
     if (VERB_MOD >= 2) {
-        Printer::info("Done computing WIs after " + boost::lexical_cast<std::string>(seconds_spent_in_compute_wellblocks_) + " seconds");
+        Printer::info("Done computing WIs after " + boost::lexical_cast<std::string>(msecs_spent_in_compute_wellblocks_) + " ms");
     }
     if (VERB_MOD >=2) {
         Printer::ext_info("Computed " + Printer::num2str(blocks->size()) + " well blocks from "
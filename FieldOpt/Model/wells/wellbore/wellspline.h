@@ -52,7 +52,8 @@ class WellSpline
    * \return
    */
   virtual QList<WellBlock *> *GetWellBlocks();
-  int GetTimeSpentInWIC() const { return seconds_spent_in_compute_wellblocks_; }
+  int GetTimeSpentInWIC() const { return msecs_spent_in_compute_wellblocks_ / 1000; }
+  int GetMsecsSpentInWIC() const { return msecs_spent_in_compute_wellblocks_; }
 
   struct SplinePoint {
     ContinousProperty *x;
@@ -75,7 +76,7 @@ class WellSpline
   Reservoir::Grid::Grid *grid_;
   Reservoir::WellIndexCalculation::wicalc_rixx *wic_;
   Settings::Model::Well well_settings_;
-  int seconds_spent_in_compute_wellblocks_; //!< Number of seconds spent in the ComputeWellBlocks() method.
+  int msecs_spent_in_compute_wellblocks_; //!< Number of milliseconds spent in the ComputeWellBlocks() method.
   bool is_variable_;
   bool use_bezier_spline_;
 
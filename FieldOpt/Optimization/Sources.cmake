@@ -45,6 +45,7 @@ SET(OPTIMIZATION_HEADERS
 	optimizers/bayesian_optimization/af_optimizers/AFPSO.h
 	optimizers/compass_search.h
 	optimizers/gss_patterns.hpp
+	surrogate_screening.h
 )
 
 SET(OPTIMIZATION_SOURCES
@@ -92,11 +93,13 @@ SET(OPTIMIZATION_SOURCES
 	optimizers/bayesian_optimization/af_optimizers/AFOptimizer.cpp
 	optimizers/bayesian_optimization/af_optimizers/AFPSO.cpp
 	optimizers/compass_search.cpp
+	surrogate_screening.cpp
 )
 
 SET(OPTIMIZATION_TESTS
 	tests/test_resource_cases.h
 	tests/test_resource_optimizer.h
+	tests/test_resource_simulated_workers.h
 	tests/test_resource_test_functions.h
 	tests/constraints/test_bhp_constraint.cpp
 	tests/constraints/test_constraint_handler.cpp
@@ -105,6 +108,7 @@ SET(OPTIMIZATION_TESTS
 	tests/constraints/test_rate_constraint.cpp
 	tests/constraints/test_reservoir_boundary.cpp
 	tests/constraints/test_spline_well_length.cpp
+	tests/objective/test_npv.cpp
 	tests/objective/test_weightedsum.cpp
 	tests/optimizers/test_apps.cpp
 	tests/optimizers/test_compass_search.cpp
@@ -117,5 +121,7 @@ SET(OPTIMIZATION_TESTS
 	tests/test_case.cpp
 	tests/test_case_handler.cpp
 	tests/test_case_transfer_object.cpp
+	tests/test_multi_fidelity.cpp
 	tests/test_normalizer.cpp
+	tests/test_surrogate_screening.cpp
 )
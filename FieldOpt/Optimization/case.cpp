@@ -38,6 +38,10 @@ Case::Case() {
     wic_time_sec_ = 0;
     ensemble_realization_ = "";
     ensemble_ofvs_ = QHash<QString, double>();
+    fidelity_ = FID_HIGH;
+    low_fidelity_ofv_ = std::numeric_limits<double>::max();
+    termination_target_ = std::numeric_limits<double>::max();
+    sim_timeout_sec_ = 0;
 }
 
 Case::Case(const QHash<QUuid, bool> &binary_variables, const QHash<QUuid, int> &integer_variables, const QHash<QUuid, double> &real_variables)
@@ -54,6 +58,10 @@ Case::Case(const QHash<QUuid, bool> &binary_variables, const QHash<QUuid, int> &
     wic_time_sec_ = 0;
     ensemble_realization_ = "";
     ensemble_ofvs_ = QHash<QString, double>();
+    fidelity_ = FID_HIGH;
+    low_fidelity_ofv_ = std::numeric_limits<double>::max();
+    termination_target_ = std::numeric_limits<double>::max();
+    sim_timeout_sec_ = 0;
 }
 
 Case::Case(const Case *c)
@@ -70,6 +78,10 @@ Case::Case(const Case *c)
     wic_time_sec_ = 0;
     ensemble_realization_ = "";
     ensemble_ofvs_ = c->ensemble_ofvs_;
+    fidelity_ = FID_HIGH;
+    low_fidelity_ofv_ = std::numeric_limits<double>::max();
+    termination_target_ = std::numeric_limits<double>::max();
+    sim_timeout_sec_ = 0;
 }
 
 bool Case::Equals(const Case *other, double tolerance) const
@@ -198,6 +210,9 @@ map <string, string> Case::GetState() {
         case CaseState::EvalStatus::E_CURRENT: statemap["EvalSt"] = "CRNT"; break;
         case CaseState::EvalStatus::E_DONE: statemap["EvalSt"] = "OKAY"; break;
         case CaseState::EvalStatus::E_BOOKKEEPED: statemap["EvalSt"] = "BKPD"; break;
+        case CaseState::EvalStatus::E_SCREENED: statemap["EvalSt"] = "SCRN"; break;
+        case CaseState::EvalStatus::E_CANCELLED: statemap["EvalSt"] = "CNCL"; break;
+        case CaseState::EvalStatus::E_TERMINATED: statemap["EvalSt"] = "TERM"; break;
     }
     switch (state.cons) {
         case CaseState::ConsStatus::C_PROJ_FAILED: statemap["ConsSt"] = "PNFL"; break;
@@ -227,6 +242,9 @@ map <string, vector<double>> Case::GetValues() {
     if (ensemble_ofvs_.size() > 1) {
         valmap["OFvSTD"] = vector<double>{GetEnsembleExpectedOfv().second};
     }
+    if (low_fidelity_ofv_ != std::numeric_limits<double>::max()) {
+        valmap["LFOFnV"] = vector<double>{low_fidelity_ofv_};
+    }
     return valmap;
 }
 string Case::StringRepresentation(Model::Properties::VariablePropertyContainer *varcont) {
@@ -21,6 +21,7 @@
 
 #include <QHash>
 #include <QUuid>
+#include <limits>
 #include <Utilities/math.hpp>
 #include <Eigen/Core>
 #include <QtCore/QDateTime>
@@ -57,10 +58,10 @@ class Case : public Loggable
    */
   struct CaseState {
     enum EvalStatus : int {
-      E_FAILED=-2, E_TIMEOUT=-1,
+      E_TERMINATED=-4, E_CANCELLED=-3, E_FAILED=-2, E_TIMEOUT=-1,
       E_PENDING=0,
       E_CURRENT=1, E_DONE=2,
-      E_BOOKKEEPED=3
+      E_BOOKKEEPED=3, E_SCREENED=4
     };
     enum ConsStatus : int {
       C_PROJ_FAILED=-2, C_INFEASIBLE=-1,
@@ -244,6 +245,36 @@ class Case : public Loggable
   QPair<double, double> GetEnsembleExpectedOfv() const;
   QHash<QString, double> GetRealizationOFVMap() const { return ensemble_ofvs_; }
 
+  // Multi-fidelity support
+  enum Fidelity : int { FID_LOW=0, FID_HIGH=1 };
+  void SetFidelity(const Fidelity fidelity) { fidelity_ = fidelity; }
+  Fidelity GetFidelity() const { return fidelity_; }
+
+  /*!
+   * @brief Set the objective function value obtained on the low-fidelity deck for
+   * a case that has been promoted to high fidelity.
+   */
+  void SetLowFidelityOfv(const double ofv) { low_fidelity_ofv_ = ofv; }
+  double GetLowFidelityOfv() const { return low_fidelity_ofv_; }
+
+  /*!
+   * @brief Set the objective function value the case has to beat to be of use to the
+   * optimizer (normally the tentative best case). When set, the runner may terminate the
+   * simulation as soon as the case provably cannot reach it (see the EarlyTermination
+   * simulator setting); the case is then marked E_TERMINATED.
+   */
+  void SetTerminationTarget(const double ofv) { termination_target_ = ofv; }
+  double GetTerminationTarget() const { return termination_target_; }
+  bool HasTerminationTarget() const { return termination_target_ != std::numeric_limits<double>::max(); }
+
+  /*!
+   * @brief Set the timeout (seconds) for the simulation of this case, overriding the
+   * runner's global timeout. Set by the runner from the predicted runtime of the case;
+   * 0 (the default) means the global timeout is used.
+   */
+  void SetSimTimeout(const int sec) { sim_timeout_sec_ = sec; }
+  int GetSimTimeout() const { return sim_timeout_sec_; }
+
  private:
   QUuid id_; //!< Unique ID for the case.
   int sim_time_sec_;
@@ -264,6 +295,12 @@ class Case : public Loggable
   // Multiple realizations-support
   QString ensemble_realization_; //!< The realization to evaluate next. Used by workers when in parallel mode.
   QHash<QString, double> ensemble_ofvs_; //!< Map of objective function values from realization alias - value.
+
+  // Multi-fidelity support
+  Fidelity fidelity_; //!< The fidelity the case is to be, or has been, evaluated at. High unless tagged otherwise by the optimizer.
+  double low_fidelity_ofv_; //!< Low-fidelity objective function value of a promoted case.
+  double termination_target_; //!< Value the case must be able to beat for its simulation to be completed.
+  int sim_timeout_sec_; //!< Timeout for the simulation of this case. 0 if the global timeout should be used.
 };
 
 }
@@ -19,6 +19,7 @@
 
 #include "case_handler.h"
 #include <iostream>
+#include <algorithm>
 
 namespace Optimization {
 
@@ -36,6 +37,10 @@ CaseHandler::CaseHandler()
     nr_timo_ = 0;
     nr_invl_ = 0;
     nr_fail_ = 0;
+    nr_scrn_ = 0;
+    nr_lowf_ = 0;
+    nr_cncl_ = 0;
+    nr_term_ = 0;
 }
 
 CaseHandler::CaseHandler(Case *base_case)
@@ -81,10 +86,15 @@ void CaseHandler::SetCaseEvaluated(const QUuid id)
     evaluated_recently_.append(id);
 
     switch (cases_[id]->state.eval) {
-        case Case::CaseState::EvalStatus::E_DONE: nr_eval_++; break;
+        case Case::CaseState::EvalStatus::E_DONE:
+            if (cases_[id]->GetFidelity() == Case::FID_LOW) nr_lowf_++;
+            else nr_eval_++;
+            break;
         case Case::CaseState::EvalStatus::E_BOOKKEEPED: nr_bkpd_++; break;
         case Case::CaseState::EvalStatus::E_TIMEOUT: nr_timo_++; break;
         case Case::CaseState::EvalStatus::E_FAILED: nr_fail_++; break;
+        case Case::CaseState::EvalStatus::E_CANCELLED: nr_cncl_++; break;
+        case Case::CaseState::EvalStatus::E_TERMINATED: nr_term_++; break;
     }
     if (cases_[id]->state.err_msg != Case::CaseState::ErrorMessage::ERR_OK){
         nr_invl_++;
@@ -148,6 +158,39 @@ void CaseHandler::DequeueCase(QUuid id) {
     cases_[id]->state.queue = Case::CaseState::QueueStatus::Q_DISCARDED;
     evaluation_queue_.removeOne(id);
 }
+void CaseHandler::SetCaseScreened(const QUuid id) {
+    if (!evaluation_queue_.contains(id))
+        throw CaseHandlerException(
+            "The case id is not found in the evaluation queue.");
+    evaluation_queue_.removeOne(id);
+    cases_[id]->state.queue = Case::CaseState::QueueStatus::Q_DEQUEUED;
+    cases_[id]->state.eval = Case::CaseState::EvalStatus::E_SCREENED;
+    evaluated_.append(id);
+    evaluated_recently_.append(id);
+    nr_scrn_++;
+}
+void CaseHandler::RequeueCase(const QUuid id) {
+    if (!evaluated_.contains(id))
+        throw CaseHandlerException(
+            "The case id is not found in the list of evaluated cases.");
+    evaluated_.removeAll(id);
+    evaluated_recently_.removeAll(id);
+    cases_[id]->state.eval = Case::CaseState::EvalStatus::E_PENDING;
+    cases_[id]->state.queue = Case::CaseState::QueueStatus::Q_QUEUED;
+    evaluation_queue_.enqueue(id);
+}
+void CaseHandler::PrioritizeQueue(std::function<double(Case *)> priority) {
+    QList<QPair<double, QUuid>> keyed;
+    for (QUuid id : evaluation_queue_) {
+        keyed.append(qMakePair(priority(cases_[id]), id));
+    }
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const QPair<double, QUuid> &a, const QPair<double, QUuid> &b) { return a.first > b.first; });
+    evaluation_queue_.clear();
+    for (auto &entry : keyed) {
+        evaluation_queue_.enqueue(entry.second);
+    }
+}
 Case *CaseHandler::GetCase(const QUuid id) const {
     return cases_[id];
 }
@@ -22,6 +22,7 @@
 
 #include "case.h"
 #include <QQueue>
+#include <functional>
 
 namespace Optimization {
 
@@ -122,12 +123,40 @@ class CaseHandler
    */
   void DequeueCase(QUuid id);
 
+  /*!
+   * @brief Take a queued case out of the queue without simulating it, because a surrogate
+   * model predicts that it is not worth evaluating. The case is marked as screened
+   * (E_SCREENED) and moved directly to the list of evaluated cases; its objective function
+   * value should already have been set to the predicted value.
+   * @param id UUID of the case to be screened out.
+   */
+  void SetCaseScreened(const QUuid id);
+
+  /*!
+   * @brief Put an evaluated case back in the evaluation queue, e.g. to evaluate a case
+   * that has been evaluated at low fidelity at high fidelity.
+   * @param id UUID of the evaluated case to requeue.
+   */
+  void RequeueCase(const QUuid id);
+
+  /*!
+   * @brief Reorder the evaluation queue by descending priority, e.g. so that the cases
+   * predicted to take the longest to simulate are dispatched first. Cases with equal
+   * priority keep their relative order.
+   * @param priority Function giving the priority of a queued case.
+   */
+  void PrioritizeQueue(std::function<double(Case *)> priority);
+
   int NumberTotal() const { return nr_totl_; }
   int NumberSimulated() const { return nr_eval_; }
   int NumberBookkeeped() const { return nr_bkpd_; }
   int NumberTimeout() const { return  nr_timo_; }
   int NumberInvalid() const { return nr_invl_; }
   int NumberFailed() const { return nr_fail_; }
+  int NumberScreened() const { return nr_scrn_; }
+  int NumberLowFidelity() const { return nr_lowf_; }
+  int NumberCancelled() const { return nr_cncl_; }
+  int NumberTerminated() const { return nr_term_; }
 
  private:
   QQueue<QUuid> evaluation_queue_; //!< Queue of the next keys to be evaluated.
@@ -142,6 +171,10 @@ class CaseHandler
   int nr_timo_; //!< Number of cases interrupted because of timeout.
   int nr_invl_; //!< Number of invalid cases (failed while being applied to model).
   int nr_fail_; //!< Number of cases that have failed for some reason.
+  int nr_scrn_; //!< Number of cases screened out by a surrogate model instead of being simulated.
+  int nr_lowf_; //!< Number of cases that have been simulated on the low-fidelity deck.
+  int nr_cncl_; //!< Number of cases whose simulation was cancelled by the runner.
+  int nr_term_; //!< Number of cases whose simulation was terminated early because they could not beat the incumbent.
 };
 
 }
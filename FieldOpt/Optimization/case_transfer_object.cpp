@@ -34,7 +34,10 @@ CaseTransferObject::CaseTransferObject(Optimization::Case *c) {
     real_variables_ = qHashToStdMap(c->real_variables_);
     wic_time_secs_ = c->GetWICTime();
     sim_time_secs_ = c->GetSimTime();
+    sim_timeout_secs_ = c->GetSimTimeout();
     ensemble_realization_ = c->GetEnsembleRealization().toStdString();
+    fidelity_ = c->GetFidelity();
+    termination_target_ = c->GetTerminationTarget();
 
     status_eval_ = c->state.eval;
     status_cons_ = c->state.cons;
@@ -51,7 +54,10 @@ Case *CaseTransferObject::CreateCase() {
     c->objective_function_value_ = objective_function_value_;
     c->SetWICTime(wic_time_secs_);
     c->SetSimTime(sim_time_secs_);
+    c->SetSimTimeout(sim_timeout_secs_);
     c->SetEnsembleRealization(QString::fromStdString(ensemble_realization_));
+    c->SetFidelity(static_cast<Case::Fidelity>(fidelity_));
+    c->SetTerminationTarget(termination_target_);
     c->state.eval = static_cast<Case::CaseState::EvalStatus>(status_eval_);
     c->state.cons = static_cast<Case::CaseState::ConsStatus>(status_cons_);
     c->state.queue = static_cast<Case::CaseState::QueueStatus>(status_queue_);
@@ -50,8 +50,11 @@ class CaseTransferObject {
       ar & integer_variables_;
       ar & real_variables_;
       ar & ensemble_realization_;
+      ar & fidelity_;
+      ar & termination_target_;
       ar & wic_time_secs_;
       ar & sim_time_secs_;
+      ar & sim_timeout_secs_;
       ar & status_eval_;
       ar & status_cons_;
       ar & status_queue_;
@@ -84,20 +87,26 @@ class CaseTransferObject {
   map<uuid, double> real_variables() const { return real_variables_; }
   int wic_time_secs() { return wic_time_secs_; }
   int sim_time_secs() { return sim_time_secs_; }
+  int sim_timeout_secs() const { return sim_timeout_secs_; }
 
   QString ensemble_realization() const { return QString::fromStdString(ensemble_realization_); }
   string  ensemble_realization_stdstr() const { return ensemble_realization_; }
+  int fidelity() const { return fidelity_; }
+  double termination_target() const { return termination_target_; }
 
  private:
   uuid id_;
   double objective_function_value_;
   int wic_time_secs_;
   int sim_time_secs_;
+  int sim_timeout_secs_;
   map<uuid, bool> binary_variables_;
   map<uuid, int> integer_variables_;
   map<uuid, double> real_variables_;
 
   string ensemble_realization_;
+  int fidelity_;
+  double termination_target_;
 
   int status_eval_;
   int status_cons_;
@@ -69,6 +69,21 @@ Eigen::VectorXd BhpConstraint::GetUpperBounds(QList<QUuid> id_vector) const {
     return ubounds;
 }
 
+std::vector<int> BhpConstraint::populationColumns(Case *prototype) const {
+    std::vector<int> columns;
+    for (auto var : affected_real_variables_) {
+        columns.push_back(populationColumn(prototype->GetRealVarIdVector(), var->id()));
+    }
+    return columns;
+}
+Eigen::VectorXi BhpConstraint::PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                             Case *prototype, int n_threads) {
+    return columnsWithinBounds(population, populationColumns(prototype), min_, max_);
+}
+void BhpConstraint::SnapPopulationToConstraint(Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    clampColumns(population, populationColumns(prototype), min_, max_);
+}
+
 void BhpConstraint::SnapCaseToConstraints(Case *c)
 {
     for (auto var : affected_real_variables_) {
@@ -42,6 +42,11 @@ class BhpConstraint : public Constraint
  public:
   bool CaseSatisfiesConstraint(Case *c);
   void SnapCaseToConstraints(Case *c);
+  Eigen::VectorXi PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                Case *prototype, int n_threads = 1) override;
+  void SnapPopulationToConstraint(Eigen::MatrixXd &population,
+                                  Case *prototype, int n_threads = 1) override;
+  bool IsReentrant() const override { return true; }
   bool IsBoundConstraint() const override;
   Eigen::VectorXd GetLowerBounds(QList<QUuid> id_vector) const override;
   Eigen::VectorXd GetUpperBounds(QList<QUuid> id_vector) const override;
@@ -51,6 +56,7 @@ class BhpConstraint : public Constraint
   double max_;
   QStringList affected_well_names_;
   QList<Model::Properties::ContinousProperty *> affected_real_variables_;
+  std::vector<int> populationColumns(Case *prototype) const; //!< Columns of the affected variables in a population.
 };
 
 }
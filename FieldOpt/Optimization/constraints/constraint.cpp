@@ -17,6 +17,7 @@
    along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 ******************************************************************************/
 #include <iostream>
+#include <thread>
 #include "constraint.h"
 
 namespace Optimization {
@@ -48,6 +49,75 @@ long double Constraint::PenaltyNormalized(Case *c)
 {
     return normalizer_.normalize(Penalty(c));
 }
+int Constraint::populationColumn(const QList<QUuid> &id_vector, const QUuid &id) {
+    int col = id_vector.indexOf(id);
+    if (col < 0) {
+        throw std::runtime_error("Constraint variable not found in population.");
+    }
+    return col;
+}
+Eigen::VectorXi Constraint::columnsWithinBounds(const Eigen::MatrixXd &population, const std::vector<int> &columns,
+                                               double min, double max) {
+    Eigen::Array<bool, Eigen::Dynamic, 1> within = Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(population.rows(), true);
+    for (int col : columns) {
+        within = within && population.col(col).array() >= min && population.col(col).array() <= max;
+    }
+    return within.cast<int>().matrix();
+}
+void Constraint::clampColumns(Eigen::MatrixXd &population, const std::vector<int> &columns, double min, double max) {
+    for (int col : columns) {
+        population.col(col) = population.col(col).cwiseMax(min).cwiseMin(max);
+    }
+}
+void Constraint::forEachPopulationMember(const Eigen::MatrixXd &population, Case *prototype, int n_threads,
+                                         const std::function<void(Case *, int)> &f) {
+    int n_rows = population.rows();
+    if (!IsReentrant() || n_threads < 2 || n_rows < 2) {
+        Case scratch(prototype);
+        for (int row = 0; row < n_rows; ++row) {
+            scratch.SetRealVarValues(population.row(row).transpose());
+            f(&scratch, row);
+        }
+        return;
+    }
+    n_threads = std::min(n_threads, n_rows);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t) {
+        threads.push_back(std::thread([&, t]() {
+            Case scratch(prototype);
+            for (int row = t; row < n_rows; row += n_threads) {
+                scratch.SetRealVarValues(population.row(row).transpose());
+                f(&scratch, row);
+            }
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+Eigen::VectorXi Constraint::PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                          Case *prototype, int n_threads) {
+    Eigen::VectorXi feasible(population.rows());
+    forEachPopulationMember(population, prototype, n_threads, [&](Case *c, int row) {
+        feasible(row) = CaseSatisfiesConstraint(c) ? 1 : 0;
+    });
+    return feasible;
+}
+void Constraint::SnapPopulationToConstraint(Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    // Each row is only written by the thread that reads it
+    forEachPopulationMember(population, prototype, n_threads, [&](Case *c, int row) {
+        SnapCaseToConstraints(c);
+        population.row(row) = c->GetRealVarVector().transpose();
+    });
+}
+Eigen::Matrix<long double, Eigen::Dynamic, 1> Constraint::PopulationPenaltyNormalized(
+    const Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    Eigen::Matrix<long double, Eigen::Dynamic, 1> penalties(population.rows());
+    forEachPopulationMember(population, prototype, n_threads, [&](Case *c, int row) {
+        penalties(row) = PenaltyNormalized(c);
+    });
+    return penalties;
+}
 void Constraint::InitializeNormalizer(QList<Case *> cases) {
     if (!normalizer_.is_ready()) {
         cout << "WARNING: using default normalization parameter values" << endl;
@@ -23,6 +23,7 @@
 #include "Optimization/case.h"
 #include "Settings/optimizer.h"
 #include "Model/properties/variable_property_container.h"
+#include <functional>
 
 namespace Optimization {
 namespace Constraints {
@@ -127,6 +128,72 @@ class Constraint
 
   long double GetPenaltyWeight() { return penalty_weight_; }
 
+  /*!
+   * @brief Check which members of a population satisfy the constraint.
+   *
+   * The population is a dense matrix with one row per case and one column
+   * per real variable, ordered as prototype->GetRealVarIdVector().
+   *
+   * The default implementation writes each row into a copy of the prototype
+   * and calls CaseSatisfiesConstraint. Constraints that only need a few
+   * columns should override this with a kernel operating on whole columns.
+   *
+   * @param population Population matrix (cases x variables).
+   * @param prototype A case with the same variables as the population members.
+   * @param n_threads Number of threads to use in the default implementation
+   * (only used if IsReentrant() returns true).
+   * @return One entry per row: 1 if the row satisfies the constraint; otherwise 0.
+   */
+  virtual Eigen::VectorXi PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                        Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Snap all rows of a population to the constraint, in place.
+   * @see PopulationSatisfiesConstraint
+   */
+  virtual void SnapPopulationToConstraint(Eigen::MatrixXd &population,
+                                          Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Get the normalized penalty for all rows of a population.
+   * @see PopulationSatisfiesConstraint
+   */
+  virtual Eigen::Matrix<long double, Eigen::Dynamic, 1> PopulationPenaltyNormalized(
+      const Eigen::MatrixXd &population, Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Indicates whether the per-case methods (CaseSatisfiesConstraint,
+   * SnapCaseToConstraints and PenaltyNormalized) may be called concurrently
+   * for different cases. Used by the default population implementations.
+   */
+  virtual bool IsReentrant() const { return false; }
+
+ protected:
+  /*!
+   * @brief Get the column of the variable with the given id in a population
+   * matrix with columns ordered as id_vector.
+   */
+  static int populationColumn(const QList<QUuid> &id_vector, const QUuid &id);
+
+  /*!
+   * @brief Population kernels for constraints imposing [min, max] bounds on a
+   * set of columns: check that all the columns are within the bounds (per row),
+   * and clamp the columns to the bounds.
+   */
+  static Eigen::VectorXi columnsWithinBounds(const Eigen::MatrixXd &population, const std::vector<int> &columns,
+                                             double min, double max);
+  static void clampColumns(Eigen::MatrixXd &population, const std::vector<int> &columns,
+                           double min, double max);
+
+  /*!
+   * @brief Call f(scratch_case, row) for every row in the population, where
+   * scratch_case is a copy of the prototype holding the values of the row.
+   * The rows are split among n_threads threads (each with its own scratch
+   * case) if the constraint is reentrant.
+   */
+  void forEachPopulationMember(const Eigen::MatrixXd &population, Case *prototype, int n_threads,
+                               const std::function<void(Case *, int)> &f);
+
  protected:
   bool logging_enabled_;
   int verbosity_level_;
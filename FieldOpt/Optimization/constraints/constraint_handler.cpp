@@ -181,6 +181,70 @@ void ConstraintHandler::SnapCaseToConstraints(Case *c)
     }
 
 }
+Eigen::VectorXi ConstraintHandler::PopulationSatisfiesConstraints(const Eigen::MatrixXd &population,
+                                                                  Case *prototype, int n_threads) {
+    Eigen::VectorXi feasible = Eigen::VectorXi::Ones(population.rows());
+    for (Constraint *constraint : constraints_) {
+        feasible = feasible.cwiseMin(constraint->PopulationSatisfiesConstraint(population, prototype, n_threads));
+        if (feasible.maxCoeff() == 0) break; // No feasible rows left
+    }
+    return feasible;
+}
+void ConstraintHandler::SnapPopulationToConstraints(Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    for (Constraint *constraint : constraints_) {
+        constraint->SnapPopulationToConstraint(population, prototype, n_threads);
+    }
+}
+Eigen::Matrix<long double, Eigen::Dynamic, 1> ConstraintHandler::GetWeightedNormalizedPenalties(
+    const Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    Eigen::Matrix<long double, Eigen::Dynamic, 1> wnp =
+        Eigen::Matrix<long double, Eigen::Dynamic, 1>::Zero(population.rows());
+    for (auto con : constraints_) {
+        wnp += con->PopulationPenaltyNormalized(population, prototype, n_threads) * con->GetPenaltyWeight();
+    }
+    return wnp;
+}
+Eigen::MatrixXd ConstraintHandler::populationMatrix(QList<Case *> cases) const {
+    // Columns are ordered as the variables in the first case
+    QList<QUuid> ids = cases.isEmpty() ? QList<QUuid>() : cases.first()->GetRealVarIdVector();
+    Eigen::MatrixXd population(cases.size(), ids.size());
+    for (int row = 0; row < cases.size(); ++row) {
+        auto values = cases[row]->real_variables();
+        for (int col = 0; col < ids.size(); ++col) {
+            population(row, col) = values[ids[col]];
+        }
+    }
+    return population;
+}
+QList<bool> ConstraintHandler::CasesSatisfyConstraints(QList<Case *> cases, int n_threads) {
+    QList<bool> feasible;
+    if (cases.isEmpty()) return feasible;
+    auto result = PopulationSatisfiesConstraints(populationMatrix(cases), cases.first(), n_threads);
+    for (int row = 0; row < cases.size(); ++row) {
+        feasible.append(result(row) == 1);
+        cases[row]->state.cons = feasible.last() ? Case::CaseState::ConsStatus::C_FEASIBLE
+                                                 : Case::CaseState::ConsStatus::C_INFEASIBLE;
+    }
+    return feasible;
+}
+void ConstraintHandler::SnapCasesToConstraints(QList<Case *> cases, int n_threads) {
+    if (cases.isEmpty()) return;
+    Eigen::MatrixXd before = populationMatrix(cases);
+    Eigen::MatrixXd population = before;
+    SnapPopulationToConstraints(population, cases.first(), n_threads);
+    for (int row = 0; row < cases.size(); ++row) {
+        if (population.row(row) != before.row(row)) {
+            auto ids = cases.first()->GetRealVarIdVector();
+            for (int col = 0; col < ids.size(); ++col) {
+                cases[row]->set_real_variable_value(ids[col], population(row, col));
+            }
+            cases[row]->state.cons = Case::CaseState::ConsStatus::C_PROJECTED;
+        }
+        else {
+            cases[row]->state.cons = Case::CaseState::ConsStatus::C_FEASIBLE;
+        }
+    }
+}
 bool ConstraintHandler::HasBoundaryConstraints() const {
     for (int i = 0; i < constraints_.size(); ++i) {
         if (constraints_[i]->IsBoundConstraint()) {
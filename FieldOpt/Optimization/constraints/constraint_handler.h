@@ -80,11 +80,51 @@ class ConstraintHandler
    */
   long double GetWeightedNormalizedPenalties(Case *c);
 
+  /*!
+   * @brief Batch version of CaseSatisfiesConstraints for a population.
+   *
+   * The population is a dense matrix with one row per case and one column
+   * per real variable, ordered as prototype->GetRealVarIdVector(). Each
+   * constraint evaluates all rows at once.
+   * @param n_threads Threads to use for constraints without a vectorised
+   * population implementation (if they are reentrant).
+   * @return One entry per row: 1 if the row satisfies _all_ constraints; otherwise 0.
+   */
+  Eigen::VectorXi PopulationSatisfiesConstraints(const Eigen::MatrixXd &population,
+                                                 Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Batch version of SnapCaseToConstraints: snap all rows of the
+   * population to _all_ constraints, in place.
+   */
+  void SnapPopulationToConstraints(Eigen::MatrixXd &population, Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Batch version of GetWeightedNormalizedPenalties.
+   */
+  Eigen::Matrix<long double, Eigen::Dynamic, 1> GetWeightedNormalizedPenalties(
+      const Eigen::MatrixXd &population, Case *prototype, int n_threads = 1);
+
+  /*!
+   * @brief Check a list of cases using the batch API, setting the
+   * constraint status of each case.
+   * @return One entry per case: true if it satisfies _all_ constraints.
+   */
+  QList<bool> CasesSatisfyConstraints(QList<Case *> cases, int n_threads = 1);
+
+  /*!
+   * @brief Snap a list of cases to _all_ constraints using the batch API,
+   * writing the results back and setting the constraint status of each case.
+   */
+  void SnapCasesToConstraints(QList<Case *> cases, int n_threads = 1);
+
   Eigen::VectorXd GetLowerBounds(QList<QUuid> id_vector) const;
   Eigen::VectorXd GetUpperBounds(QList<QUuid> id_vector) const;
 
  private:
   QList<Constraint *> constraints_;
+
+  Eigen::MatrixXd populationMatrix(QList<Case *> cases) const; //!< Stack the real variable values of the cases as rows (columns ordered as in the first case).
 };
 
 }
@@ -36,83 +36,75 @@ InterwellDistance::InterwellDistance(Settings::Optimizer::Constraint settings,
     for (QString name : settings.wells) {
         affected_wells_.append(initializeWell(variables->GetWellSplineVariables(name)));
     }
-    if (affected_wells_.length() != 2) {
-        throw std::runtime_error("Currently, the Interwell Distance constraint must be applied to exactly two wells. Found " + boost::lexical_cast<std::string>(affected_wells_.length()));
+    if (affected_wells_.length() < 2) {
+        throw std::runtime_error("The Interwell Distance constraint must be applied to at least two wells. Found " + boost::lexical_cast<std::string>(affected_wells_.length()));
     }
 }
 
-bool InterwellDistance::CaseSatisfiesConstraint(Case *c)
-{
-    QList<Eigen::Vector3d> points;
+QList<QList<Eigen::Vector3d>> InterwellDistance::wellEndpoints(Case *c) {
+    QList<QList<Eigen::Vector3d>> wells;
     for (Well well : affected_wells_) {
-        double heel_x_val = c->real_variables()[well.heel.x];
-        double heel_y_val = c->real_variables()[well.heel.y];
-        double heel_z_val = c->real_variables()[well.heel.z];
-
-        double toe_x_val = c->real_variables()[well.toe.x];
-        double toe_y_val = c->real_variables()[well.toe.y];
-        double toe_z_val = c->real_variables()[well.toe.z];
-
-        Eigen::Vector3d heel_vals;
-        Eigen::Vector3d toe_vals;
-        heel_vals << heel_x_val, heel_y_val, heel_z_val;
-        toe_vals << toe_x_val, toe_y_val, toe_z_val;
-        points.append(heel_vals);
-        points.append(toe_vals);
+        auto endpoints = GetEndpointValueVectors(c, well);
+        wells.append(QList<Eigen::Vector3d>({endpoints.first, endpoints.second}));
     }
-    // Get the projection
-    QList<Eigen::Vector3d> projection = WellConstraintProjections::interwell_constraint_projection(
-        points, distance_);
+    return wells;
+}
+
+bool InterwellDistance::CaseSatisfiesConstraint(Case *c)
+{
+    QList<QList<Eigen::Vector3d>> wells = wellEndpoints(c);
+
+    // Only pairs of wells closer than distance_ can violate the constraint
+    for (auto pair : WellConstraintProjections::interwell_candidate_pairs(wells, distance_)) {
+        QList<Eigen::Vector3d> points = wells[pair.first] + wells[pair.second];
+
+        // Get the projection
+        QList<Eigen::Vector3d> projection = WellConstraintProjections::interwell_constraint_projection(
+            points, distance_);
 
-    if (projection.length() == 0) return false; // No solution was found
+        if (projection.length() == 0) return false; // No solution was found
 
-    // Check if the projection is (approximately) equal to the input case
-    for (int i = 0; i < projection.length(); ++i) {
-        if (!points[i].isApprox(projection[i], 0.01))
-            return false;
+        // Check if the projection is (approximately) equal to the input case
+        for (int i = 0; i < projection.length(); ++i) {
+            if (!points[i].isApprox(projection[i], 0.01))
+                return false;
+        }
     }
     return true;
 }
 
 void InterwellDistance::SnapCaseToConstraints(Case *c)
 {
-    QList<Eigen::Vector3d> points;
-    for (Well well : affected_wells_) {
-        double heel_x_val = c->real_variables()[well.heel.x];
-        double heel_y_val = c->real_variables()[well.heel.y];
-        double heel_z_val = c->real_variables()[well.heel.z];
-
-        double toe_x_val = c->real_variables()[well.toe.x];
-        double toe_y_val = c->real_variables()[well.toe.y];
-        double toe_z_val = c->real_variables()[well.toe.z];
-
-        Eigen::Vector3d heel_vals;
-        Eigen::Vector3d toe_vals;
-        heel_vals << heel_x_val, heel_y_val, heel_z_val;
-        toe_vals << toe_x_val, toe_y_val, toe_z_val;
-        points.append(heel_vals);
-        points.append(toe_vals);
+    QList<QList<Eigen::Vector3d>> wells = wellEndpoints(c);
+    QList<QList<Eigen::Vector3d>> projection;
+
+    if (wells.length() == 2) {
+        QList<Eigen::Vector3d> pair_projection = WellConstraintProjections::interwell_constraint_projection(
+            wells[0] + wells[1], distance_);
+        if (pair_projection.length() == 0) return; // No solution was found
+        projection.append(pair_projection.mid(0, 2));
+        projection.append(pair_projection.mid(2, 2));
+    }
+    else {
+        // Project the nearby pairs until all wells are (approximately) distance_ apart
+        projection = WellConstraintProjections::interwell_constraint_multiple_wells(
+            wells, distance_, 0.01 * distance_);
     }
-    // Get the projection
-    QList<Eigen::Vector3d> projection = WellConstraintProjections::interwell_constraint_projection(
-        points, distance_);
-
-    if (projection.length() == 0) return; // No solution was found
 
     for (int i = 0; i < affected_wells_.length(); ++i) {
-        c->set_real_variable_value(affected_wells_[i].heel.x, projection[i*2](0));
-        c->set_real_variable_value(affected_wells_[i].heel.y, projection[i*2](1));
-        c->set_real_variable_value(affected_wells_[i].heel.z, projection[i*2](2));
+        c->set_real_variable_value(affected_wells_[i].heel.x, projection[i][0](0));
+        c->set_real_variable_value(affected_wells_[i].heel.y, projection[i][0](1));
+        c->set_real_variable_value(affected_wells_[i].heel.z, projection[i][0](2));
 
-        c->set_real_variable_value(affected_wells_[i].toe.x, projection[i*2+1](0));
-        c->set_real_variable_value(affected_wells_[i].toe.y, projection[i*2+1](1));
-        c->set_real_variable_value(affected_wells_[i].toe.z, projection[i*2+1](2));
+        c->set_real_variable_value(affected_wells_[i].toe.x, projection[i][1](0));
+        c->set_real_variable_value(affected_wells_[i].toe.y, projection[i][1](1));
+        c->set_real_variable_value(affected_wells_[i].toe.z, projection[i][1](2));
     }
 }
 void InterwellDistance::InitializeNormalizer(QList<Case *> cases) {
     long double minimum_distance = 1e20;
     for (auto c : cases) {
-        vector<double> endp_dist = endpointDistances(c);
+        vector<double> endp_dist = endpointDistances(c, false);
         for (double dist : endp_dist) {
             if (abs(dist) < minimum_distance)
                 minimum_distance = abs(dist);
@@ -123,7 +115,7 @@ void InterwellDistance::InitializeNormalizer(QList<Case *> cases) {
     normalizer_.set_midpoint(minimum_distance/2.0L);
 }
 double InterwellDistance::Penalty(Case *c) {
-    vector<double> endpoint_distances = endpointDistances(c);
+    vector<double> endpoint_distances = endpointDistances(c, true);
     double violation = 0.0;
     for (auto distance : endpoint_distances) {
         if (distance < distance_) {
@@ -137,19 +129,26 @@ double InterwellDistance::Penalty(Case *c) {
     return violation;
 }
 
-vector<double> InterwellDistance::endpointDistances(Case *c) {
+vector<double> InterwellDistance::endpointDistances(Case *c, bool nearby_only) {
+    QList<QList<Eigen::Vector3d>> wells = wellEndpoints(c);
+    QList<QPair<int, int>> pairs;
+    if (nearby_only) {
+        pairs = WellConstraintProjections::interwell_candidate_pairs(wells, distance_);
+    }
+    else {
+        for (int i = 0; i < wells.length(); ++i)
+            for (int j = i + 1; j < wells.length(); ++j)
+                pairs.append(qMakePair(i, j));
+    }
+
     vector<double> endpoint_distances;
-    for (int i = 0; i < affected_wells_.size(); i += 2) { // Even numbers
-        if (i >= affected_wells_.size()) break;
-        for (int j = 1; j < affected_wells_.size(); j += 2) { // Odd numbers
-            if (j >= affected_wells_.size()) break;
-            QPair<Eigen::Vector3d, Eigen::Vector3d> well_i = GetEndpointValueVectors(c, affected_wells_[i]);
-            QPair<Eigen::Vector3d, Eigen::Vector3d> well_j = GetEndpointValueVectors(c, affected_wells_[j]);
-            endpoint_distances.push_back( (well_i.first  - well_j.first).norm()  ); // heel_i -> heel_j
-            endpoint_distances.push_back( (well_i.second - well_j.second).norm() ); //  toe_i ->  toe_j
-            endpoint_distances.push_back( (well_i.first  - well_j.second).norm() ); // heel_i ->  toe_j
-            endpoint_distances.push_back( (well_i.second - well_j.first).norm()  ); //  toe_i -> heel_j
-        }
+    for (auto pair : pairs) {
+        const QList<Eigen::Vector3d> &well_i = wells[pair.first];
+        const QList<Eigen::Vector3d> &well_j = wells[pair.second];
+        endpoint_distances.push_back( (well_i[0] - well_j[0]).norm() ); // heel_i -> heel_j
+        endpoint_distances.push_back( (well_i[1] - well_j[1]).norm() ); //  toe_i ->  toe_j
+        endpoint_distances.push_back( (well_i[0] - well_j[1]).norm() ); // heel_i ->  toe_j
+        endpoint_distances.push_back( (well_i[1] - well_j[0]).norm() ); //  toe_i -> heel_j
     }
     return endpoint_distances;
 }
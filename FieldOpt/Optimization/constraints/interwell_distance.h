@@ -27,6 +27,16 @@
 namespace Optimization {
 namespace Constraints {
 
+/*!
+ * \brief The InterwellDistance class ensures that the distance between the
+ * heel-toe segments of any pair of the affected wells is at least the
+ * specified minimum.
+ *
+ * Any number (at least two) of wells may be listed. Pairs of wells are
+ * first filtered by a broad phase on their (expanded) bounding boxes, so
+ * the exact segment distance and projection are only computed for pairs
+ * that may be closer than the minimum distance.
+ */
 class InterwellDistance : public Constraint, WellSplineConstraint
 {
  public:
@@ -51,13 +61,21 @@ class InterwellDistance : public Constraint, WellSplineConstraint
   void InitializeNormalizer(QList<Case *> cases) override;
   double Penalty(Case *c) override;
   long double PenaltyNormalized(Case *c) override;
+  bool IsReentrant() const override { return true; }
 
  private:
   double distance_;
   QList<Well> affected_wells_;
 
-  //! Calculate the distances between the endpoints for two wells
-  vector<double> endpointDistances(Case *c);
+  //! Get the heel and toe of each of the affected wells.
+  QList<QList<Eigen::Vector3d>> wellEndpoints(Case *c);
+
+  /*!
+   * Calculate the distances between the endpoints for pairs of wells.
+   * @param nearby_only Only include the pairs of wells that may be closer than
+   * the minimum distance (the others can not contribute to the penalty).
+   */
+  vector<double> endpointDistances(Case *c, bool nearby_only);
 
 };
 
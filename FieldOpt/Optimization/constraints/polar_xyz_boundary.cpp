@@ -43,6 +43,11 @@ PolarXYZBoundary::PolarXYZBoundary(const Settings::Optimizer::Constraint &settin
     else
         affected_well_ = initializeWell(variables->GetPolarSplineVariables(settings.well));
 
+    // Cells with center inside the box
+    for (int idx : grid_->Index().CellsInBox(Eigen::Vector3d(xmin_, ymin_, zmin_),
+                                             Eigen::Vector3d(xmax_, ymax_, zmax_))) {
+        index_list_.append(idx);
+    }
 }
 
 bool PolarXYZBoundary::CaseSatisfiesConstraint(Case *c) {
@@ -51,14 +56,17 @@ bool PolarXYZBoundary::CaseSatisfiesConstraint(Case *c) {
     double midpoint_y_val = c->real_variables()[affected_well_.midpoint.y];
     double midpoint_z_val = c->real_variables()[affected_well_.midpoint.z];
 
-    bool midpoint_feasible = false;
-
-    for (int ii = 0; ii < index_list_.length(); ii++) {
-        if (grid_->GetCell(index_list_[ii]).EnvelopsPoint(
-            Eigen::Vector3d(midpoint_x_val, midpoint_y_val, midpoint_z_val))) {
-            midpoint_feasible = true;
-        }
-    }
+    // The midpoint is feasible if it is enveloped by a cell with center inside the box
+    auto &index = grid_->Index();
+    Reservoir::Grid::CellFilter in_box;
+    in_box.predicate = [&](int gi) {
+        auto center = index.center(gi);
+        return center.x() >= xmin_ && center.x() <= xmax_
+            && center.y() >= ymin_ && center.y() <= ymax_
+            && center.z() >= zmin_ && center.z() <= zmax_;
+    };
+    bool midpoint_feasible = index.FindCellEnvelopingPoint(
+        Eigen::Vector3d(midpoint_x_val, midpoint_y_val, midpoint_z_val), in_box) >= 0;
 
     return midpoint_feasible;
 }
@@ -50,10 +50,15 @@ PseudoContBoundary2D::PseudoContBoundary2D(const Settings::Optimizer::Constraint
         if (abs(min_block.center().z() - max_block.center().z()) > numeric_limits<float>::epsilon())
             throw runtime_error("Reservoir is non-flat.");
 
-        x_min_ = min(min_block.center().x(), max_block.center().x());
-        x_max_ = max(min_block.center().x(), max_block.center().x());
-        y_min_ = min(min_block.center().y(), max_block.center().y());
-        y_max_ = max(min_block.center().y(), max_block.center().y());
+        auto &index = grid->Index();
+        auto layer_cells = index.CellsMatching(
+            Reservoir::Grid::CellFilter::Box(i_min_, i_max_, j_min_, j_max_, 0, 0));
+        Eigen::Vector3d lo, hi;
+        index.CenterBounds(layer_cells, lo, hi);
+        x_min_ = lo.x();
+        x_max_ = hi.x();
+        y_min_ = lo.y();
+        y_max_ = hi.y();
         assert(x_min_ != x_max_ && y_min_ != y_max_);
 
         auto affected_vars = variables->GetPseudoContVertVariables(well_name_);
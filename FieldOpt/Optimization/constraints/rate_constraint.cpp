@@ -52,6 +52,20 @@ namespace Optimization {
     bool RateConstraint::IsBoundConstraint() const {
         return true;
     }
+    std::vector<int> RateConstraint::populationColumns(Case *prototype) const {
+        std::vector<int> columns;
+        for (auto var : affected_real_variables_) {
+            columns.push_back(populationColumn(prototype->GetRealVarIdVector(), var->id()));
+        }
+        return columns;
+    }
+    Eigen::VectorXi RateConstraint::PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                                  Case *prototype, int n_threads) {
+        return columnsWithinBounds(population, populationColumns(prototype), min_, max_);
+    }
+    void RateConstraint::SnapPopulationToConstraint(Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+        clampColumns(population, populationColumns(prototype), min_, max_);
+    }
 
     }
 }
@@ -38,12 +38,18 @@ class RateConstraint : public Constraint {
  public:
   bool CaseSatisfiesConstraint(Case *c);
   void SnapCaseToConstraints(Case *c);
+  Eigen::VectorXi PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                Case *prototype, int n_threads = 1) override;
+  void SnapPopulationToConstraint(Eigen::MatrixXd &population,
+                                  Case *prototype, int n_threads = 1) override;
+  bool IsReentrant() const override { return true; }
 
  private:
   double min_;
   double max_;
   QStringList affected_well_names_;
   QList<Model::Properties::ContinousProperty *> affected_real_variables_;
+  std::vector<int> populationColumns(Case *prototype) const; //!< Columns of the affected variables in a population.
 };
 }
 }
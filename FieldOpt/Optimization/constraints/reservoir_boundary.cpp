@@ -19,6 +19,8 @@
 #include "reservoir_boundary.h"
 #include "ConstraintMath/well_constraint_projections/well_constraint_projections.h"
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 #include "Utilities/math.hpp"
 #include "Utilities/verbosity.h"
 #include "Utilities/printer.hpp"
@@ -38,6 +40,8 @@ ReservoirBoundary::ReservoirBoundary(
     kmin_ = settings.box_kmin;
     kmax_ = settings.box_kmax;
     grid_ = grid;
+    nx_ = grid->Dimensions().nx;
+    ny_ = grid->Dimensions().ny;
     penalty_weight_ = settings.penalty_weight;
 
     index_list_ = getListOfCellIndices();
@@ -49,6 +53,84 @@ ReservoirBoundary::ReservoirBoundary(
     // QList with indices of box edge cells
     index_list_edge_ = getIndicesOfEdgeCells();
 
+    precomputeBoxGeometry();
+}
+
+int ReservoirBoundary::globalIndex(int i, int j, int k) const {
+    // ECLIPSE (ERT) ordering: i runs fastest, then j, then k
+    return i + nx_ * (j + ny_ * k);
+}
+
+void ReservoirBoundary::precomputeBoxGeometry() {
+    cell_min_ = grid_->GetCell(imin_, jmin_, kmin_);
+    cell_max_ = grid_->GetCell(imax_, jmax_, kmax_);
+
+    // The nearest point in the box for a point outside it lies on one
+    // of the cells on the outer faces of the box, so those are the
+    // only cells needed for projections.
+    const double inf = std::numeric_limits<double>::infinity();
+    box_lo_ = Eigen::Vector3d(inf, inf, inf);
+    box_hi_ = -box_lo_;
+    shell_cells_.clear();
+    for (int k = kmin_; k <= kmax_; k++) {
+        for (int j = jmin_; j <= jmax_; j++) {
+            for (int i = imin_; i <= imax_; i++) {
+                if (i != imin_ && i != imax_ && j != jmin_ && j != jmax_ && k != kmin_ && k != kmax_)
+                    continue;
+                auto cell = grid_->GetCell(globalIndex(i, j, k));
+                Eigen::Vector3d lo = cell.corners()[0], hi = cell.corners()[0];
+                for (auto &corner : cell.corners()) {
+                    lo = lo.cwiseMin(corner);
+                    hi = hi.cwiseMax(corner);
+                }
+                shell_cells_.push_back(cell);
+                shell_lo_.push_back(lo);
+                shell_hi_.push_back(hi);
+                box_lo_ = box_lo_.cwiseMin(lo);
+                box_hi_ = box_hi_.cwiseMax(hi);
+            }
+        }
+    }
+}
+
+bool ReservoirBoundary::pointInBox(const Eigen::Vector3d &point) const {
+    for (int a = 0; a < 3; ++a) {
+        if (point(a) < box_lo_(a) || point(a) > box_hi_(a))
+            return false;
+    }
+    // A point is feasible if it is enveloped by one of the cells in the box
+    auto box = Reservoir::Grid::CellFilter::Box(imin_, imax_, jmin_, jmax_, kmin_, kmax_);
+    return grid_->Index().FindCellEnvelopingPoint(point, box) >= 0;
+}
+
+Eigen::Vector3d ReservoirBoundary::projectToBox(const Eigen::Vector3d &point) const {
+    if (pointInBox(point))
+        return point;
+
+    // Visit the shell cells in order of the distance from the point to
+    // their bounding box (a lower bound on the distance to the cell), and
+    // stop once that bound exceeds the best distance found.
+    std::vector<std::pair<double, int>> order(shell_cells_.size());
+    for (int c = 0; c < shell_cells_.size(); ++c) {
+        Eigen::Vector3d d = (shell_lo_[c] - point).cwiseMax(point - shell_hi_[c]).cwiseMax(0.0);
+        order[c] = std::make_pair(d.norm(), c);
+    }
+    std::sort(order.begin(), order.end());
+
+    double minimum = INFINITY;
+    Eigen::Vector3d best_point = point;
+    for (auto &candidate : order) {
+        if (candidate.first >= minimum)
+            break;
+        Eigen::Vector3d projected = WellConstraintProjections::point_to_cell_shortest(
+            shell_cells_[candidate.second], point);
+        double distance = (point - projected).norm();
+        if (distance < minimum) {
+            minimum = distance;
+            best_point = projected;
+        }
+    }
+    return best_point;
 }
 
 
@@ -73,6 +155,16 @@ void ReservoirBoundary::findCornerCells() {
     // TODO:
     // move the output messages from here to the unit test of this function.
 
+    // Fetch the corners of the eight box corner cells once
+    const std::vector<Eigen::Vector3d> corners_minminmin = grid_->GetCell(imin_, jmin_, kmin_).corners();
+    const std::vector<Eigen::Vector3d> corners_minminmax = grid_->GetCell(imin_, jmin_, kmax_).corners();
+    const std::vector<Eigen::Vector3d> corners_minmaxmin = grid_->GetCell(imin_, jmax_, kmin_).corners();
+    const std::vector<Eigen::Vector3d> corners_minmaxmax = grid_->GetCell(imin_, jmax_, kmax_).corners();
+    const std::vector<Eigen::Vector3d> corners_maxminmin = grid_->GetCell(imax_, jmin_, kmin_).corners();
+    const std::vector<Eigen::Vector3d> corners_maxminmax = grid_->GetCell(imax_, jmin_, kmax_).corners();
+    const std::vector<Eigen::Vector3d> corners_maxmaxmin = grid_->GetCell(imax_, jmax_, kmin_).corners();
+    const std::vector<Eigen::Vector3d> corners_maxmaxmax = grid_->GetCell(imax_, jmax_, kmax_).corners();
+
     // ===============
     // UPPER BOX PLANE
     // ===============
@@ -85,8 +177,8 @@ void ReservoirBoundary::findCornerCells() {
     //        0   1
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> upper_plane_left_bottom_cell_xyz = grid_->GetCell(imin_, jmin_, kmax_).corners();
-    std::vector<Eigen::Vector3d> upper_plane_left_top_cell_xyz = grid_->GetCell(imin_, jmax_, kmax_).corners();
+    std::vector<Eigen::Vector3d> upper_plane_left_bottom_cell_xyz = corners_minminmax;
+    std::vector<Eigen::Vector3d> upper_plane_left_top_cell_xyz = corners_minmaxmax;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d upper_plane_left_bottom_corner_xyz = upper_plane_left_bottom_cell_xyz[0];
     Eigen::Vector3d upper_plane_left_top_corner_xyz = upper_plane_left_top_cell_xyz[2];
@@ -102,8 +194,8 @@ void ReservoirBoundary::findCornerCells() {
     //        0   1
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> upper_plane_right_bottom_cell_xyz = grid_->GetCell(imax_, jmin_, kmax_).corners();
-    std::vector<Eigen::Vector3d> upper_plane_right_top_cell_xyz = grid_->GetCell(imax_, jmax_, kmax_).corners();
+    std::vector<Eigen::Vector3d> upper_plane_right_bottom_cell_xyz = corners_maxminmax;
+    std::vector<Eigen::Vector3d> upper_plane_right_top_cell_xyz = corners_maxmaxmax;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d upper_plane_right_bottom_corner_xyz = upper_plane_right_bottom_cell_xyz[1];
     Eigen::Vector3d upper_plane_right_top_corner_xyz = upper_plane_right_top_cell_xyz[3];
@@ -122,8 +214,8 @@ void ReservoirBoundary::findCornerCells() {
     //         | |
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> upper_plane_bottom_left_cell_xyz = grid_->GetCell(imin_, jmin_, kmax_).corners();
-    std::vector<Eigen::Vector3d> upper_plane_bottom_right_cell_xyz = grid_->GetCell(imax_, jmin_, kmax_).corners();
+    std::vector<Eigen::Vector3d> upper_plane_bottom_left_cell_xyz = corners_minminmax;
+    std::vector<Eigen::Vector3d> upper_plane_bottom_right_cell_xyz = corners_maxminmax;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d upper_plane_bottom_left_corner_xyz = upper_plane_bottom_left_cell_xyz[0];
     Eigen::Vector3d upper_plane_bottom_right_corner_xyz = upper_plane_bottom_right_cell_xyz[1];
@@ -142,8 +234,8 @@ void ReservoirBoundary::findCornerCells() {
     //        0   1
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> upper_plane_top_left_cell_xyz = grid_->GetCell(imin_, jmax_, kmax_).corners();
-    std::vector<Eigen::Vector3d> upper_plane_top_right_cell_xyz = grid_->GetCell(imax_, jmax_, kmax_).corners();
+    std::vector<Eigen::Vector3d> upper_plane_top_left_cell_xyz = corners_minmaxmax;
+    std::vector<Eigen::Vector3d> upper_plane_top_right_cell_xyz = corners_maxmaxmax;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d upper_plane_top_left_corner_xyz = upper_plane_top_left_cell_xyz[2];
     Eigen::Vector3d upper_plane_top_right_corner_xyz = upper_plane_top_right_cell_xyz[3];
@@ -163,8 +255,8 @@ void ReservoirBoundary::findCornerCells() {
     //        4   5
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> lower_plane_left_bottom_cell_xyz = grid_->GetCell(imin_, jmin_, kmin_).corners();
-    std::vector<Eigen::Vector3d> lower_plane_left_top_cell_xyz = grid_->GetCell(imin_, jmax_, kmin_).corners();
+    std::vector<Eigen::Vector3d> lower_plane_left_bottom_cell_xyz = corners_minminmin;
+    std::vector<Eigen::Vector3d> lower_plane_left_top_cell_xyz = corners_minmaxmin;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d lower_plane_left_bottom_corner_xyz = lower_plane_left_bottom_cell_xyz[4];
     Eigen::Vector3d lower_plane_left_top_corner_xyz = lower_plane_left_top_cell_xyz[6];
@@ -180,8 +272,8 @@ void ReservoirBoundary::findCornerCells() {
     //        4   5
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> lower_plane_right_bottom_cell_xyz = grid_->GetCell(imax_, jmin_, kmin_).corners();
-    std::vector<Eigen::Vector3d> lower_plane_right_top_cell_xyz = grid_->GetCell(imax_, jmax_, kmin_).corners();
+    std::vector<Eigen::Vector3d> lower_plane_right_bottom_cell_xyz = corners_maxminmin;
+    std::vector<Eigen::Vector3d> lower_plane_right_top_cell_xyz = corners_maxmaxmin;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d lower_plane_right_bottom_corner_xyz = lower_plane_right_bottom_cell_xyz[5];
     Eigen::Vector3d lower_plane_right_top_corner_xyz = lower_plane_right_top_cell_xyz[7];
@@ -200,8 +292,8 @@ void ReservoirBoundary::findCornerCells() {
     //         | |
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> lower_plane_bottom_left_cell_xyz = grid_->GetCell(imin_, jmin_, kmin_).corners();
-    std::vector<Eigen::Vector3d> lower_plane_bottom_right_cell_xyz = grid_->GetCell(imax_, jmin_, kmin_).corners();
+    std::vector<Eigen::Vector3d> lower_plane_bottom_left_cell_xyz = corners_minminmin;
+    std::vector<Eigen::Vector3d> lower_plane_bottom_right_cell_xyz = corners_maxminmin;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d lower_plane_bottom_left_corner_xyz = lower_plane_bottom_left_cell_xyz[4];
     Eigen::Vector3d lower_plane_bottom_right_corner_xyz = lower_plane_bottom_right_cell_xyz[5];
@@ -220,8 +312,8 @@ void ReservoirBoundary::findCornerCells() {
     //        4   5
 
     // Get corner cells of box
-    std::vector<Eigen::Vector3d> lower_plane_top_left_cell_xyz = grid_->GetCell(imin_, jmax_, kmin_).corners();
-    std::vector<Eigen::Vector3d> lower_plane_top_right_cell_xyz = grid_->GetCell(imax_, jmax_, kmin_).corners();
+    std::vector<Eigen::Vector3d> lower_plane_top_left_cell_xyz = corners_minmaxmin;
+    std::vector<Eigen::Vector3d> lower_plane_top_right_cell_xyz = corners_maxmaxmin;
     // Get cell vertex amounting to true box corner
     Eigen::Vector3d lower_plane_top_left_corner_xyz = lower_plane_top_left_cell_xyz[6];
     Eigen::Vector3d lower_plane_top_right_corner_xyz = lower_plane_top_right_cell_xyz[7];
@@ -262,7 +354,7 @@ QList<int> ReservoirBoundary::getIndicesOfEdgeCells() {
 
     // UPPER CELL FACE: LEFT EDGE
     for (int j = jmin_; j <= jmax_; j++) {
-        upper_face_left_edge_.append(grid_->GetCell(imin_, j, kmax_).global_index());
+        upper_face_left_edge_.append(globalIndex(imin_, j, kmax_));
 //        upper_face_left_edge_xyz.append(grid_->GetCell(imin_, j, kmax_).corners());
         // Testing
         // upper_face_left_edge_xyz.push_back(grid_->GetCell(imin_, j, kmax_).corners());
@@ -270,17 +362,17 @@ QList<int> ReservoirBoundary::getIndicesOfEdgeCells() {
 
     // UPPER CELL FACE: BOTTOM EDGE
     for (int i = imin_; i <= imax_; i++) {
-        upper_face_bottom_edge_.append(grid_->GetCell(i, jmin_, kmax_).global_index());
+        upper_face_bottom_edge_.append(globalIndex(i, jmin_, kmax_));
     }
 
     // UPPER CELL FACE: RIGHT EDGE
     for (int j = jmin_; j <= jmax_; j++) {
-        upper_face_right_edge_.append(grid_->GetCell(imax_, j, kmax_).global_index());
+        upper_face_right_edge_.append(globalIndex(imax_, j, kmax_));
     }
 
     // UPPER CELL FACE: TOP EDGE
     for (int i = imin_; i <= imax_; i++) {
-        upper_face_top_edge_.append(grid_->GetCell(i, jmax_, kmax_).global_index());
+        upper_face_top_edge_.append(globalIndex(i, jmax_, kmax_));
     }
 
     // APPEND UPPER EDGE CELLS TO box_edge_cells_ LIST
@@ -296,22 +388,22 @@ QList<int> ReservoirBoundary::getIndicesOfEdgeCells() {
 
     // LOWER CELL FACE: LEFT EDGE
     for (int j = jmin_; j <= jmax_; j++) {
-        lower_face_left_edge_.append(grid_->GetCell(imin_, j, kmin_).global_index());
+        lower_face_left_edge_.append(globalIndex(imin_, j, kmin_));
     }
 
     // LOWER CELL FACE: BOTTOM EDGE
     for (int i = imin_; i <= imax_; i++) {
-        lower_face_bottom_edge_.append(grid_->GetCell(i, jmin_, kmin_).global_index());
+        lower_face_bottom_edge_.append(globalIndex(i, jmin_, kmin_));
     }
 
     // LOWER CELL FACE: RIGHT EDGE
     for (int j = jmin_; j <= jmax_; j++) {
-        lower_face_right_edge_.append(grid_->GetCell(imax_, j, kmin_).global_index());
+        lower_face_right_edge_.append(globalIndex(imax_, j, kmin_));
     }
 
     // LOWER CELL FACE: TOP EDGE
     for (int i = imin_; i <= imax_; i++) {
-        lower_face_top_edge_.append(grid_->GetCell(i, jmax_, kmin_).global_index());
+        lower_face_top_edge_.append(globalIndex(i, jmax_, kmin_));
     }
 
     // APPEND LOWER EDGE CELLS TO box_edge_cells_ LIST
@@ -333,19 +425,8 @@ bool ReservoirBoundary::CaseSatisfiesConstraint(Case *c) {
     double toe_y_val = c->real_variables()[affected_well_.toe.y];
     double toe_z_val = c->real_variables()[affected_well_.toe.z];
 
-    bool heel_feasible = false;
-    bool toe_feasible = false;
-
-    for (int ii=0; ii<index_list_.length(); ii++){
-        if (grid_->GetCell(index_list_[ii]).EnvelopsPoint(
-            Eigen::Vector3d(heel_x_val, heel_y_val, heel_z_val))) {
-            heel_feasible = true;
-        }
-        if (grid_->GetCell(index_list_[ii]).EnvelopsPoint(
-            Eigen::Vector3d(toe_x_val, toe_y_val, toe_z_val))) {
-            toe_feasible = true;
-        }
-    }
+    bool heel_feasible = pointInBox(Eigen::Vector3d(heel_x_val, heel_y_val, heel_z_val));
+    bool toe_feasible = pointInBox(Eigen::Vector3d(toe_x_val, toe_y_val, toe_z_val));
 
     return heel_feasible && toe_feasible;
 }
@@ -361,17 +442,9 @@ void ReservoirBoundary::SnapCaseToConstraints(Case *c) {
     double toe_z_val = c->real_variables()[affected_well_.toe.z];
 
     Eigen::Vector3d projected_heel =
-        WellConstraintProjections::well_domain_constraint_indices(
-            Eigen::Vector3d(heel_x_val, heel_y_val, heel_z_val),
-            grid_,
-            index_list_
-        );
+        projectToBox(Eigen::Vector3d(heel_x_val, heel_y_val, heel_z_val));
     Eigen::Vector3d projected_toe =
-        WellConstraintProjections::well_domain_constraint_indices(
-            Eigen::Vector3d(toe_x_val, toe_y_val, toe_z_val),
-            grid_,
-            index_list_
-        );
+        projectToBox(Eigen::Vector3d(toe_x_val, toe_y_val, toe_z_val));
 
     c->set_real_variable_value(affected_well_.heel.x, projected_heel(0));
     c->set_real_variable_value(affected_well_.heel.y, projected_heel(1));
@@ -388,15 +461,15 @@ QList<int> ReservoirBoundary::getListOfCellIndices() {
     for (int i = imin_; i <= imax_; i++){
         for (int j = jmin_; j <= jmax_; j++){
             for (int k = kmin_; k <= kmax_; k++){
-                index_list.append(grid_->GetCell(i, j, k).global_index());
+                index_list.append(globalIndex(i, j, k));
             }
         }
     }
     return index_list;
 }
 Eigen::VectorXd ReservoirBoundary::GetLowerBounds(QList<QUuid> id_vector) const {
-    auto cell_min = grid_->GetCell(imin_, jmin_, kmin_);
-    auto cell_max = grid_->GetCell(imax_, jmax_, kmax_);
+    const auto &cell_min = cell_min_;
+    const auto &cell_max = cell_max_;
     double xmin, ymin, zmin;
     xmin = std::min(cell_max.center().x(), cell_min.center().x());
     ymin = std::min(cell_max.center().y(), cell_min.center().y());
@@ -423,8 +496,8 @@ Eigen::VectorXd ReservoirBoundary::GetLowerBounds(QList<QUuid> id_vector) const
     return lbounds;
 }
 Eigen::VectorXd ReservoirBoundary::GetUpperBounds(QList<QUuid> id_vector) const {
-    auto cell_min = grid_->GetCell(imin_, jmin_, kmin_);
-    auto cell_max = grid_->GetCell(imax_, jmax_, kmax_);
+    const auto &cell_min = cell_min_;
+    const auto &cell_max = cell_max_;
     double xmax, ymax, zmax;
     xmax = std::max(cell_max.center().x(), cell_min.center().x());
     ymax = std::max(cell_max.center().y(), cell_min.center().y());
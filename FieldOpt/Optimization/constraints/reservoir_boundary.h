@@ -74,6 +74,7 @@ class ReservoirBoundary : public Constraint, WellSplineConstraint
   bool CaseSatisfiesConstraint(Case *c);
   void SnapCaseToConstraints(Case *c);
   bool IsBoundConstraint() const override { return true; }
+  bool IsReentrant() const override { return true; }
 
   /*!
    * @brief Initialize the normalizer parameters.
@@ -128,6 +129,7 @@ class ReservoirBoundary : public Constraint, WellSplineConstraint
 
  protected:
   int imin_, imax_, jmin_, jmax_, kmin_, kmax_;
+  int nx_, ny_; //!< Grid dimensions, used to compute global indices.
   QList<int> index_list_;
   Reservoir::Grid::Grid *grid_;
   Well affected_well_;
@@ -137,6 +139,39 @@ class ReservoirBoundary : public Constraint, WellSplineConstraint
   QList<int> index_list_edge_;
 
   void printCornerXYZ(std::string str_out, Eigen::Vector3d vector_xyz);
+
+  /*!
+   * @brief Global index of cell (i,j,k), computed without reading the cell.
+   */
+  int globalIndex(int i, int j, int k) const;
+
+  /*!
+   * @brief Read the geometry needed by the feasibility checks and
+   * projections once: the cells on the outer faces of the box (with
+   * their bounding boxes), the bounding box of the entire box, and the
+   * min/max corner cells used for the variable bounds.
+   */
+  void precomputeBoxGeometry();
+
+  /*!
+   * @brief Check if a point is inside the box. Points outside the box'
+   * bounding box are rejected directly; otherwise the grid index is
+   * used to find an enveloping cell within the box.
+   */
+  bool pointInBox(const Eigen::Vector3d &point) const;
+
+  /*!
+   * @brief Project a point onto the box. Equivalent to
+   * WellConstraintProjections::well_domain_constraint_indices over all
+   * cells in the box, but only evaluates the shell cells that can be
+   * closer than the best projection found so far.
+   */
+  Eigen::Vector3d projectToBox(const Eigen::Vector3d &point) const;
+
+  std::vector<Reservoir::Grid::Cell> shell_cells_; //!< Cells on the outer faces of the box.
+  std::vector<Eigen::Vector3d> shell_lo_, shell_hi_; //!< Bounding boxes of the shell cells.
+  Eigen::Vector3d box_lo_, box_hi_; //!< Bounding box of the entire box.
+  Reservoir::Grid::Cell cell_min_, cell_max_; //!< Cells (imin,jmin,kmin) and (imax,jmax,kmax).
 };
 }
 }
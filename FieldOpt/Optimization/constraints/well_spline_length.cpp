@@ -91,6 +91,84 @@ void WellSplineLength::SnapCaseToConstraints(Case *c)
     c->set_real_variable_value(affected_well_.toe.y, projection.last()(1));
     c->set_real_variable_value(affected_well_.toe.z, projection.last()(2));
 }
+void WellSplineLength::populationEndpoints(const Eigen::MatrixXd &population, Case *prototype,
+                                           Eigen::MatrixX3d &heels, Eigen::MatrixX3d &toes,
+                                           int heel_cols[3], int toe_cols[3]) const {
+    auto ids = prototype->GetRealVarIdVector();
+    heel_cols[0] = populationColumn(ids, affected_well_.heel.x);
+    heel_cols[1] = populationColumn(ids, affected_well_.heel.y);
+    heel_cols[2] = populationColumn(ids, affected_well_.heel.z);
+    toe_cols[0] = populationColumn(ids, affected_well_.toe.x);
+    toe_cols[1] = populationColumn(ids, affected_well_.toe.y);
+    toe_cols[2] = populationColumn(ids, affected_well_.toe.z);
+    heels.resize(population.rows(), 3);
+    toes.resize(population.rows(), 3);
+    for (int a = 0; a < 3; ++a) {
+        heels.col(a) = population.col(heel_cols[a]);
+        toes.col(a) = population.col(toe_cols[a]);
+    }
+}
+void WellSplineLength::projectPopulation(const Eigen::MatrixX3d &heels, const Eigen::MatrixX3d &toes,
+                                         Eigen::MatrixX3d &projected_heels, Eigen::MatrixX3d &projected_toes) const {
+    const double epsilon = 0.001; // Same as in CaseSatisfiesConstraint/SnapCaseToConstraints
+    Eigen::MatrixX3d heel_to_toe = toes - heels;
+    Eigen::ArrayXd d = heel_to_toe.rowwise().norm().array();
+
+    // Distance each endpoint is moved along the (normalized) heel-toe vector
+    Eigen::ArrayXd move = (d > max_length_).select(0.5 * (d - max_length_ + (epsilon / 2)),
+                          (d < min_length_).select(0.5 * (d - min_length_ - (epsilon / 2)), 0.0));
+    Eigen::ArrayXd scale = (d > 0).select(move / d, 0.0);
+    projected_heels = heels + (heel_to_toe.array().colwise() * scale).matrix();
+    projected_toes = toes - (heel_to_toe.array().colwise() * scale).matrix();
+
+    // If heel and toe are the same point, all directions are equally good.
+    for (int row = 0; row < d.size(); ++row) {
+        if (d(row) == 0) {
+            projected_heels.row(row) = heels.row(row) + Eigen::RowVector3d(min_length_ / 2, 0, 0);
+            projected_toes.row(row) = heels.row(row) - Eigen::RowVector3d(min_length_ / 2, 0, 0);
+        }
+    }
+}
+Eigen::VectorXi WellSplineLength::PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                                Case *prototype, int n_threads) {
+    Eigen::MatrixX3d heels, toes, projected_heels, projected_toes;
+    int heel_cols[3], toe_cols[3];
+    populationEndpoints(population, prototype, heels, toes, heel_cols, toe_cols);
+    projectPopulation(heels, toes, projected_heels, projected_toes);
+
+    // Row-wise equivalent of a.isApprox(b, 0.01): |a - b| <= 0.01 * min(|a|, |b|)
+    auto approx = [](const Eigen::MatrixX3d &a, const Eigen::MatrixX3d &b) -> Eigen::Array<bool, Eigen::Dynamic, 1> {
+        return (a - b).rowwise().norm().array()
+            <= 0.01 * a.rowwise().norm().array().min(b.rowwise().norm().array());
+    };
+    Eigen::Array<bool, Eigen::Dynamic, 1> feasible = approx(heels, projected_heels) && approx(toes, projected_toes);
+    return feasible.cast<int>().matrix();
+}
+void WellSplineLength::SnapPopulationToConstraint(Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    Eigen::MatrixX3d heels, toes, projected_heels, projected_toes;
+    int heel_cols[3], toe_cols[3];
+    populationEndpoints(population, prototype, heels, toes, heel_cols, toe_cols);
+    projectPopulation(heels, toes, projected_heels, projected_toes);
+    for (int a = 0; a < 3; ++a) {
+        population.col(heel_cols[a]) = projected_heels.col(a);
+        population.col(toe_cols[a]) = projected_toes.col(a);
+    }
+}
+Eigen::Matrix<long double, Eigen::Dynamic, 1> WellSplineLength::PopulationPenaltyNormalized(
+    const Eigen::MatrixXd &population, Case *prototype, int n_threads) {
+    Eigen::MatrixX3d heels, toes;
+    int heel_cols[3], toe_cols[3];
+    populationEndpoints(population, prototype, heels, toes, heel_cols, toe_cols);
+    Eigen::ArrayXd length = (heels - toes).rowwise().norm().array();
+    Eigen::ArrayXd violation = (length > max_length_).select(length - max_length_,
+                               (length < min_length_).select(min_length_ - length, 0.0));
+
+    Eigen::Matrix<long double, Eigen::Dynamic, 1> penalties(population.rows());
+    for (int row = 0; row < population.rows(); ++row) {
+        penalties(row) = normalizer_.normalize(violation(row));
+    }
+    return penalties;
+}
 void WellSplineLength::InitializeNormalizer(QList<Case *> cases) {
     vector<double> well_lengths;
     for (auto c : cases) {
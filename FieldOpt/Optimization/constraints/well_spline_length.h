@@ -44,11 +44,27 @@ class WellSplineLength : public Constraint, WellSplineConstraint
   double Penalty(Case *c) override;
   long double PenaltyNormalized(Case *c) override;
 
+  Eigen::VectorXi PopulationSatisfiesConstraint(const Eigen::MatrixXd &population,
+                                                Case *prototype, int n_threads = 1) override;
+  void SnapPopulationToConstraint(Eigen::MatrixXd &population,
+                                  Case *prototype, int n_threads = 1) override;
+  Eigen::Matrix<long double, Eigen::Dynamic, 1> PopulationPenaltyNormalized(
+      const Eigen::MatrixXd &population, Case *prototype, int n_threads = 1) override;
+
  private:
   double min_length_;
   double max_length_;
   Well affected_well_;
 
+  //! Extract the heel and toe coordinates of all population members (one row per member).
+  void populationEndpoints(const Eigen::MatrixXd &population, Case *prototype,
+                           Eigen::MatrixX3d &heels, Eigen::MatrixX3d &toes,
+                           int heel_cols[3], int toe_cols[3]) const;
+
+  //! Row-wise version of WellConstraintProjections::well_length_projection.
+  void projectPopulation(const Eigen::MatrixX3d &heels, const Eigen::MatrixX3d &toes,
+                         Eigen::MatrixX3d &projected_heels, Eigen::MatrixX3d &projected_toes) const;
+
 };
 
 }
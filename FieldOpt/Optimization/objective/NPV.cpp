@@ -23,6 +23,8 @@ along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 #include "weightedsum.h"
 #include <stdlib.h>
 #include <cmath>
+#include <algorithm>
+#include <limits>
 #include "Model/model.h"
 #include "Model/wells/well.h"
 #include <Utilities/printer.hpp>
@@ -73,6 +75,15 @@ NPV::NPV(Settings::Optimizer *settings,
 
 double NPV::value() const {
   try {
+    return computeValue();
+  }
+  catch (...) {
+    Printer::error("Failed to compute NPV. Returning 0.0");
+    return 0.0;
+  }
+}
+
+double NPV::computeValue() const {
   double value = 0;
 
   auto report_times = results_->GetValueVector(results_->Time);
@@ -155,10 +166,46 @@ double NPV::value() const {
       }
     }
     return value;
+}
+
+double NPV::OptimisticValue(double end_time, double rate_cap_factor) const {
+  for (auto comp : *components_) {
+    if (comp->is_json_component && comp->coefficient > 0) {
+      return std::numeric_limits<double>::infinity();
+    }
+  }
+  if (!results_->isAvailable()) {
+    return std::numeric_limits<double>::infinity();
+  }
+  try {
+    auto report_times = results_->GetValueVector(results_->Time);
+    if (report_times.size() < 2) {
+      return std::numeric_limits<double>::infinity();
+    }
+    double remaining_time = std::max(0.0, end_time - report_times.back());
+    double bound = computeValue();
+    for (auto comp : *components_) {
+      if (comp->is_json_component || comp->coefficient <= 0) {
+        continue;
+      }
+      auto cumulative = results_->GetValueVector(comp->property);
+      if (cumulative.size() != report_times.size()) {
+        return std::numeric_limits<double>::infinity();
+      }
+      double max_rate = 0;
+      for (int i = 1; i < cumulative.size(); ++i) {
+        double dt = report_times[i] - report_times[i-1];
+        if (dt > 0) {
+          max_rate = std::max(max_rate, (cumulative[i] - cumulative[i-1]) / dt);
+        }
+      }
+      bound += comp->coefficient * rate_cap_factor * max_rate * remaining_time;
+    }
+    return bound;
   }
   catch (...) {
-    Printer::error("Failed to compute NPV. Returning 0.0");
-    return 0.0;
+    // Failed evaluations can not be bounded; they must not be terminated early
+    return std::numeric_limits<double>::infinity();
   }
 }
 
@@ -40,7 +40,23 @@ class NPV : public Objective {
 
   double value() const;
 
+  /*!
+   * \brief OptimisticValue The NPV so far, plus the remaining revenue of each component
+   * with a positive coefficient at rate_cap_factor times the highest rate seen so far,
+   * undiscounted. Components with negative coefficients (costs) are assumed to stop.
+   *
+   * Returns infinity if there is a positive external (EXT-) component, as these are
+   * only available after the simulation, or if the results are missing or incomplete.
+   */
+  double OptimisticValue(double end_time, double rate_cap_factor) const override;
+
  private:
+  /*!
+   * \brief computeValue Compute the NPV. Unlike value(), this throws if the results
+   * can not be read.
+   */
+  double computeValue() const;
+
 /*!
  * \brief The Component class is used for internal representation of the components of
  * NPV.
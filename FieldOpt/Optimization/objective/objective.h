@@ -28,6 +28,7 @@
 
 #include <QPair>
 #include <QList>
+#include <limits>
 #include "Settings/model.h"
 #include "Model/model.h"
 
@@ -46,6 +47,20 @@ public:
      */
     virtual double value() const = 0;
 
+    /*!
+     * \brief OptimisticValue Get an upper bound on the value the objective function can
+     * reach when the simulation the current results were read from is run to completion.
+     * Used to terminate simulations of cases that cannot beat the tentative best case.
+     *
+     * The default implementation cannot bound the value and returns infinity.
+     * \param end_time The time (days) at which the simulation ends.
+     * \param rate_cap_factor Multiplier on the highest rate seen so far, used to cap the
+     * rates for the remainder of the simulation.
+     */
+    virtual double OptimisticValue(double end_time, double rate_cap_factor) const {
+        return std::numeric_limits<double>::infinity();
+    }
+
 protected:
     Objective();
 
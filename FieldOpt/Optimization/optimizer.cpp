@@ -17,9 +17,11 @@
    along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 ******************************************************************************/
 #include <Utilities/time.hpp>
+#include <Utilities/trace.hpp>
 #include "optimizer.h"
 #include <time.h>
 #include <cmath>
+#include <algorithm>
 
 namespace Optimization {
 
@@ -66,6 +68,18 @@ Optimizer::Optimizer(Settings::Optimizer *settings, Case *base_case,
     verbosity_level_ = 0;
     penalize_ = settings->objective().use_penalty_function;
 
+    screening_ = nullptr;
+    if (settings->parameters().surrogate_screening) {
+        screening_ = new SurrogateScreening(settings->parameters(), mode_,
+                                            variables->ContinousVariableSize());
+    }
+    multi_fidelity_ = settings->parameters().multi_fidelity;
+    mf_promotion_ = settings->parameters().multi_fidelity_promotion;
+    mf_pending_ = 0;
+    nr_abandoned_ = 0;
+    nr_cancel_requests_ = 0;
+    seconds_saved_ = 0.0;
+
     if (penalize_) {
         if (!normalizer_ofv_.is_ready()) {
             if (VERB_OPT >=1) {
@@ -91,16 +105,156 @@ Case *Optimizer::GetCaseForEvaluation()
     if (case_handler_->QueuedCases().size() == 0) {
         time_t start, end;
         time(&start);
+        Utilities::Trace::Span span("opt.iterate");
         iterate();
+        span.End();
         time(&end);
         seconds_spent_in_iterate_ = difftime(end, start);
+        if (screening_ != nullptr && case_handler_->QueuedCases().size() > 1) {
+            screenQueuedCases();
+        }
+        if (multi_fidelity_ && case_handler_->QueuedCases().size() > 1) {
+            for (auto c : case_handler_->QueuedCases()) {
+                c->SetFidelity(Case::FID_LOW);
+                mf_batch_.append(c);
+            }
+            mf_pending_ = mf_batch_.size();
+        }
+        if (dispatch_priority_ && case_handler_->QueuedCases().size() > 1) {
+            case_handler_->PrioritizeQueue(dispatch_priority_);
+        }
     }
     return case_handler_->GetNextCaseForEvaluation();
 }
 
+void Optimizer::screenQueuedCases() {
+    QList<Case *> training;
+    for (auto c : case_handler_->EvaluatedCases()) {
+        if (c->state.eval == Case::CaseState::EvalStatus::E_SCREENED
+            || c->state.eval == Case::CaseState::EvalStatus::E_FAILED
+            || c->state.eval == Case::CaseState::EvalStatus::E_TIMEOUT
+            || c->state.eval == Case::CaseState::EvalStatus::E_CANCELLED
+            || c->state.eval == Case::CaseState::EvalStatus::E_TERMINATED
+            || c->GetFidelity() == Case::FID_LOW)
+            continue;
+        training.append(c);
+    }
+    if (!screening_->Fit(training)) {
+        return;
+    }
+
+    QList<Case *> rejected;
+    screening_->Select(case_handler_->QueuedCases(), rejected);
+    for (auto c : rejected) {
+        c->set_objective_function_value(nonImprovingValue(screening_->Predict(c)));
+        case_handler_->SetCaseScreened(c->id());
+        handleEvaluatedCase(c);
+        if (enable_logging_) {
+            logger_->AddEntry(c);
+        }
+    }
+    if (VERB_OPT >= 2) {
+        Printer::ext_info("Screened " + Printer::num2str(rejected.size()) + " of "
+                              + Printer::num2str(rejected.size() + case_handler_->QueuedCases().size())
+                              + " generated cases.", "Optimization", "Optimizer");
+    }
+}
+
+double Optimizer::nonImprovingValue(double ofv) const {
+    double best = tentative_best_case_->objective_function_value();
+    if (mode_ == Settings::Optimizer::OptimizerMode::Maximize)
+        return std::min(ofv, best);
+    else
+        return std::max(ofv, best);
+}
+
+void Optimizer::promoteLowFidelityCases() {
+    QList<Case *> ranked;
+    QList<Case *> failed;
+    for (auto c : mf_batch_) {
+        if (c->state.eval == Case::CaseState::EvalStatus::E_DONE
+            || c->state.eval == Case::CaseState::EvalStatus::E_BOOKKEEPED)
+            ranked.append(c);
+        else
+            failed.append(c);
+    }
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [this](const Case *a, const Case *b) { return isBetter(a, b); });
+    int n_promote = ranked.size() == 0 ? 0 : std::max(1, (int)std::ceil(mf_promotion_ * ranked.size()));
+
+    // Requeue the promoted cases first, so that the optimizer does not consider
+    // the batch finished while handling the cases that were not promoted.
+    for (int i = 0; i < n_promote; ++i) {
+        ranked[i]->SetLowFidelityOfv(ranked[i]->objective_function_value());
+        ranked[i]->SetFidelity(Case::FID_HIGH);
+        case_handler_->RequeueCase(ranked[i]->id());
+    }
+    for (int i = n_promote; i < ranked.size(); ++i) {
+        ranked[i]->set_objective_function_value(nonImprovingValue(ranked[i]->objective_function_value()));
+        failed.append(ranked[i]);
+    }
+    for (auto c : failed) {
+        handleEvaluatedCase(c);
+        if (enable_logging_) {
+            logger_->AddEntry(c);
+        }
+    }
+    if (VERB_OPT >= 2) {
+        Printer::ext_info("Promoted " + Printer::num2str(n_promote) + " of "
+                              + Printer::num2str(mf_batch_.size())
+                              + " low-fidelity cases.", "Optimization", "Optimizer");
+    }
+    mf_batch_.clear();
+}
+
+void Optimizer::abandonQueuedCase(Case *c) {
+    case_handler_->DequeueCase(c->id());
+    nr_abandoned_++;
+    seconds_saved_ += medianSimulationTime();
+}
+
+void Optimizer::requestCancellation(Case *c) {
+    if (!cancel_requests_.contains(c->id())) {
+        cancel_requests_.append(c->id());
+        nr_cancel_requests_++;
+    }
+}
+
+QList<QUuid> Optimizer::GetCasesToCancel() {
+    QList<QUuid> ids = cancel_requests_;
+    cancel_requests_.clear();
+    return ids;
+}
+
+double Optimizer::medianSimulationTime() const {
+    std::vector<double> times;
+    for (auto c : case_handler_->EvaluatedCases()) {
+        if (c->state.eval == Case::CaseState::EvalStatus::E_DONE && c->GetSimTime() > 0)
+            times.push_back(c->GetSimTime());
+    }
+    if (times.size() == 0)
+        return 0.0;
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
 void Optimizer::SubmitEvaluatedCase(Case *c)
 {
-    evaluated_cases_++;
+    Utilities::Trace::Span span("opt.submit_case");
+    if (c->state.eval == Case::CaseState::EvalStatus::E_CANCELLED) {
+        // The result is not needed; only record how much of a full simulation was avoided
+        seconds_saved_ += std::max(0.0, medianSimulationTime() - c->GetSimTime());
+        case_handler_->SetCaseState(c->id(), c->state, c->GetWICTime(), c->GetSimTime());
+        case_handler_->SetCaseEvaluated(c->id());
+        if (enable_logging_) {
+            logger_->AddEntry(case_handler_->GetCase(c->id()));
+        }
+        return;
+    }
+    bool low_fidelity = case_handler_->GetCase(c->id())->GetFidelity() == Case::FID_LOW;
+    if (!low_fidelity) {
+        evaluated_cases_++;
+    }
     if (penalize_) {
         double penalized_ofv = PenalizedOFV(c);
         c->set_objective_function_value(penalized_ofv);
@@ -108,6 +262,13 @@ void Optimizer::SubmitEvaluatedCase(Case *c)
     case_handler_->UpdateCaseObjectiveFunctionValue(c->id(), c->objective_function_value());
     case_handler_->SetCaseState(c->id(), c->state, c->GetWICTime(), c->GetSimTime());
     case_handler_->SetCaseEvaluated(c->id());
+    if (low_fidelity) {
+        // Cases evaluated at low fidelity are held back until the whole batch is done
+        if (--mf_pending_ == 0) {
+            promoteLowFidelityCases();
+        }
+        return;
+    }
     handleEvaluatedCase(case_handler_->GetCase(c->id()));
     if (enable_logging_) {
         logger_->AddEntry(case_handler_->GetCase(c->id()));
@@ -213,6 +374,15 @@ map<string, string> Optimizer::Summary::GetState() {
         case MAX_ITERATIONS_REACHED: statemap["Term. condition"] = "Reached max. iterations"; break;
         default: statemap["Term. condition"] = "Unknown";
     }
+    if (opt_->screening_ != nullptr) {
+        double screened = opt_->case_handler_->NumberScreened();
+        double simulated = opt_->case_handler_->NumberSimulated();
+        statemap["Simulations avoided by screening"] = screened + simulated > 0
+            ? boost::lexical_cast<string>(screened / (screened + simulated)) : "0";
+    }
+    if (opt_->nr_abandoned_ + opt_->nr_cancel_requests_ > 0) {
+        statemap["Seconds saved by abandoning poll steps"] = boost::lexical_cast<string>(opt_->seconds_saved_);
+    }
     statemap["bc Best case found in iter"] = boost::lexical_cast<string>(opt_->tentative_best_case_iteration_);
     statemap["bc UUID"] = opt_->tentative_best_case_->GetId().toString().toStdString();
     statemap["bc Objective function value"] = boost::lexical_cast<string>(opt_->tentative_best_case_->objective_function_value());
@@ -231,6 +401,13 @@ map<string, vector<double>> Optimizer::Summary::GetValues() {
     valmap["failed"] = vector<double>{opt_->case_handler_->NumberFailed()};
     valmap["timed out"] = vector<double>{opt_->case_handler_->NumberTimeout()};
     valmap["bookkeeped"] = vector<double>{opt_->case_handler_->NumberBookkeeped()};
+    valmap["screened"] = vector<double>{opt_->case_handler_->NumberScreened()};
+    valmap["low fidelity"] = vector<double>{opt_->case_handler_->NumberLowFidelity()};
+    valmap["abandoned"] = vector<double>{opt_->nr_abandoned_};
+    valmap["cancel requests"] = vector<double>{opt_->nr_cancel_requests_};
+    valmap["cancelled"] = vector<double>{opt_->case_handler_->NumberCancelled()};
+    valmap["terminated early"] = vector<double>{opt_->case_handler_->NumberTerminated()};
+    valmap["seconds saved"] = vector<double>{opt_->seconds_saved_};
     return valmap;
 }
 
@@ -28,6 +28,7 @@
 #include "Runner/loggable.hpp"
 #include "Runner/logger.h"
 #include "normalizer.h"
+#include "surrogate_screening.h"
 #include "Utilities/verbosity.h"
 #include "Utilities/printer.hpp"
 
@@ -65,6 +66,16 @@ class Optimizer : public Loggable
    */
   void SubmitEvaluatedCase(Case *c);
 
+  /*!
+   * \brief GetCasesToCancel Get the ids of cases being evaluated whose results are no longer
+   * needed by the optimizer (e.g. the rest of an abandoned poll), and clear the list.
+   *
+   * Runners should call this after each call to SubmitEvaluatedCase and cancel the
+   * corresponding simulations. A cancelled case should be submitted with the E_CANCELLED
+   * status; cases that finish before the cancellation takes effect are submitted as usual.
+   */
+  QList<QUuid> GetCasesToCancel();
+
   /*!
    * \brief GetTentativeBestCase Get the best case found so far.
    * \return
@@ -113,6 +124,14 @@ class Optimizer : public Loggable
    */
   int GetSimulationDuration(Case *c);
 
+  /*!
+   * @brief Set a priority used to order each newly generated batch of cases before it is
+   * handed out by GetCaseForEvaluation: cases with higher priority are dispatched first.
+   * Used by the runners to dispatch the cases predicted to take the longest first.
+   * @param priority Function giving the priority of a case.
+   */
+  void SetDispatchPriority(std::function<double(Case *)> priority) { dispatch_priority_ = priority; }
+
  protected:
   /*!
    * \brief Base constructor for optimizers. Initializes constraints and sets some member values.
@@ -163,6 +182,18 @@ class Optimizer : public Loggable
 
  protected:
   void updateTentativeBestCase(Case *c);
+
+  /*!
+   * @brief Drop a queued case that is no longer needed, counting it as an abandoned case.
+   */
+  void abandonQueuedCase(Case *c);
+
+  /*!
+   * @brief Ask the runner to cancel the simulation of a case that is being evaluated.
+   * See GetCasesToCancel().
+   */
+  void requestCancellation(Case *c);
+
   CaseHandler *case_handler_; //!< All cases (base case, unevaluated cases and evaluated cases) passed to or generated by the optimizer.
   Constraints::ConstraintHandler *constraint_handler_; //!< All constraints defined for the optimization.
   int evaluated_cases_; //!< Number of evaluated cases.
@@ -180,6 +211,12 @@ class Optimizer : public Loggable
   bool is_hybrid_component_; //!< Indicates that this object is a hybrid optimization component.
 
   Normalizer normalizer_ofv_; //!< Normalizer for objective function values.
+  SurrogateScreening *screening_; //!< Surrogate used to screen generated cases. Null unless SurrogateScreening is enabled.
+  bool multi_fidelity_; //!< Whether generated batches are evaluated at low fidelity before being promoted.
+  double mf_promotion_; //!< Fraction of each low-fidelity batch promoted to high fidelity.
+  QList<Case *> mf_batch_; //!< The batch currently being evaluated at low fidelity.
+  int mf_pending_; //!< Number of cases in mf_batch_ not yet evaluated.
+  std::function<double(Case *)> dispatch_priority_; //!< Priority used to order generated batches. Empty unless set by the runner.
 
   void initializeNormalizers(); //!< Initialize all normalization parameters.
 
@@ -213,6 +250,44 @@ class Optimizer : public Loggable
    * from the cases that have been evaluated so far.
    */
   void initializeOfvNormalizer();
+
+  /*!
+   * @brief Screen the queued cases with the surrogate, removing the ones not
+   * selected for simulation from the queue.
+   *
+   * Screened cases are given the predicted objective function value, clamped so
+   * that they never improve on the tentative best case, and are passed to
+   * handleEvaluatedCase like simulated cases so that the optimizer can rank them.
+   * They do not count towards max_evaluations_.
+   */
+  void screenQueuedCases();
+
+  /*!
+   * @brief Promote the best fraction of a completed low-fidelity batch to high fidelity
+   * by requeueing them.
+   *
+   * The remaining cases are passed to handleEvaluatedCase with their low-fidelity
+   * value, clamped so that they never improve on the tentative best case. Low-fidelity
+   * evaluations do not count towards max_evaluations_.
+   */
+  void promoteLowFidelityCases();
+
+  /*!
+   * @brief Clamp an objective function value so that it is not an improvement on the
+   * tentative best case. Used for values that were not obtained by a (full) simulation.
+   */
+  double nonImprovingValue(double ofv) const;
+
+  int nr_abandoned_; //!< Number of queued cases dropped before being simulated.
+  int nr_cancel_requests_; //!< Number of in-flight simulations the runner has been asked to cancel.
+  double seconds_saved_; //!< Estimated simulation time saved by abandoning and cancelling cases.
+  QList<QUuid> cancel_requests_; //!< Cases to be cancelled by the runner; see GetCasesToCancel().
+
+  /*!
+   * @brief The median simulation time of the successfully simulated cases, used to
+   * estimate the time saved by abandoning a case. Zero if no simulation times are known.
+   */
+  double medianSimulationTime() const;
 };
 
 }
@@ -75,7 +75,8 @@ void APPS::successful_iteration(Case *c) {
     set_step_lengths(c->origin_direction_index(), c->origin_step_length());
     expand();
     reset_active();
-    prune_queue();
+    if (opportunistic_) abandon_poll();
+    else prune_queue();
     if (VERB_OPT >= 2) print_state("Successful iteration");
     iterate();
 }
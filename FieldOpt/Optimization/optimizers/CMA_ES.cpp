@@ -24,6 +24,7 @@
 #include "Utilities/stringhelpers.hpp"
 #include "Settings/optimizer.h"
 #include <math.h>
+#include <algorithm>
 #include <random>
 
 namespace Optimization {
@@ -129,10 +130,13 @@ CMA_ES::CMA_ES(Settings::Optimizer *settings,
     invsqrtC_ = B_ * (temp_D).asDiagonal() * B_.transpose();
     eigeneval_ = 0;
     chiN_ = pow(n_vars_, 0.5) * (1 - (float(1) / (4 * n_vars_)) + 1 / (21 * pow(n_vars_, 2)));
-    for (int i = 0; i < lambda_; ++i) {
-        auto new_case = generateCase(xmean_, i, 1);
-        case_handler_->AddNewCase(new_case);
-    }
+    es_ = SelfAdjointEigenSolver<MatrixXd>(n_vars_);
+    stream_seed_ = gen_();
+    generation_ = 0;
+
+    QList<Case *> new_cases = generatePopulation();
+    constraint_handler_->CasesSatisfyConstraints(new_cases);
+    case_handler_->AddNewCases(new_cases);
 }
 
 CMA_ES::Individual::Individual(Optimization::Case *c, boost::random::mt19937 &gen, int index,
@@ -144,29 +148,15 @@ CMA_ES::Individual::Individual(Optimization::Case *c, boost::random::mt19937 &ge
     penalty_dist_ = penalty_dist;
 }
 
-vector<CMA_ES::Individual> CMA_ES::sortPopulation(vector<CMA_ES::Individual> population) {
-    vector<CMA_ES::Individual> sortedPopulation;
-    int n = population_.size();
-    bool swapped = true;
-    while (swapped) {
-        swapped = false;
-        for (int i = 1; i <= n - 1; i++) {
-            if (population[i - 1].ofv() > population[i].ofv() &&
-                (Settings::Optimizer::Minimize == settings_->mode())) {
-                CMA_ES::Individual temp_individual = population[i];
-                population[i] = population[i - 1];
-                population[i - 1] = temp_individual;
-                swapped = true;
-            } else if (population[i - 1].ofv() < population[i].ofv() &&
-                       (Settings::Optimizer::Maximize == settings_->mode())) {
-                CMA_ES::Individual temp_individual = population[i];
-                population[i] = population[i - 1];
-                population[i - 1] = temp_individual;
-                swapped = true;
-            }
-        }
+void CMA_ES::sortPopulation() {
+    // Stable, so that ties keep their generation order
+    if (Settings::Optimizer::Minimize == settings_->mode()) {
+        std::stable_sort(population_.begin(), population_.end(),
+                         [](const Individual &a, const Individual &b) { return a.ofv() < b.ofv(); });
+    } else {
+        std::stable_sort(population_.begin(), population_.end(),
+                         [](const Individual &a, const Individual &b) { return a.ofv() > b.ofv(); });
     }
-    return population;
 }
 
 void CMA_ES::iterate() {
@@ -182,25 +172,19 @@ void CMA_ES::iterate() {
                     population_[i].ofv() - (exp(penalty_ * population_[i].penalty_dist_) - 1));
         }
     }
-    population_ = sortPopulation(population_);
+    sortPopulation();
     xold_ = xmean_;
-    xmean_ = Eigen::VectorXd::Zero(xmean_.size());
-    for (int i = 0; i < n_vars_; i++) {
-        double temp = 0;
-        for (int j = 0; j < mu_; j++) {
-            temp += population_[j].erands_norm_[i] * weights_[j];
-        }
-        xmean_(i) = temp;
+    xmean_.setZero();
+    for (int j = 0; j < mu_; j++) {
+        xmean_ += weights_[j] * population_[j].erands_norm_;
     }
     updateEvolutionPath();
     adaptCovarianceMatrix();
     decompositionOfC();
 
-    for (int i = 0; i < lambda_; ++i) {
-        auto new_case = generateCase(xmean_, i, 0);
-        case_handler_->AddNewCase(new_case);
-    }
-    population_ = temp_population_;
+    QList<Case *> new_cases = generatePopulation();
+    constraint_handler_->CasesSatisfyConstraints(new_cases);
+    case_handler_->AddNewCases(new_cases);
     iteration_++;
 }
 
@@ -252,80 +236,61 @@ void CMA_ES::adaptCovarianceMatrix() {
 void CMA_ES::decompositionOfC() {
     if (case_handler_->EvaluatedCases().size() - eigeneval_ > lambda_ / (c1_ + cmu_) / n_vars_ / 10.0) {
         eigeneval_ = case_handler_->EvaluatedCases().size();
-        const IOFormat fmt(10, DontAlignCols, "\t", " ", "\n", "", "", "");
-        Eigen::MatrixXd Cupper = Eigen::MatrixXd::Zero(n_vars_, n_vars_);
-        for (int i = 0; i < n_vars_; i++) {
-            for (int j = i; j < n_vars_; j++) {
-                Cupper(i, j) = C_(i, j);
-            }
-        }
-        Eigen::MatrixXd Cupperest = Eigen::MatrixXd::Zero(n_vars_, n_vars_);
-        for (int i = 0; i < n_vars_; i++) {
-            for (int j = i + 1; j < n_vars_; j++) {
-                Cupperest(i, j) = C_(i, j);
+
+        // Enforce symmetry by mirroring the upper triangle in place; the
+        // self-adjoint solver only reads the lower triangle.
+        for (int j = 0; j < n_vars_; j++) {
+            for (int i = j + 1; i < n_vars_; i++) {
+                C_(i, j) = C_(j, i);
             }
         }
-        C_ = Cupper + Cupperest.transpose();
 
         es_.compute(C_);
-        D_ = es_.eigenvalues().real();
-        B_ = es_.eigenvectors().real();
-
-        VectorXd D_diag_sqrt;
-        D_diag_sqrt.resize(D_.size());
-        for (int i = 0; i < D_.size(); i++) {
-            D_diag_sqrt(i) = sqrt(D_(i));
-        }
-
-        VectorXd D_diag_inverse;
-        D_diag_inverse.resize(D_.size());
-        for (int i = 0; i < D_.size(); i++) {
-            D_diag_inverse(i) = 1. / D_(i);
-        }
-
-        D_ = D_diag_sqrt;
-        invsqrtC_ = B_ * D_diag_inverse.asDiagonal() * B_.transpose();
+        B_ = es_.eigenvectors();
+        D_ = es_.eigenvalues().cwiseSqrt();
+        invsqrtC_ = B_ * D_.cwiseInverse().asDiagonal() * B_.transpose();
     }
 }
 
-Case *CMA_ES::generateCase(Eigen::VectorXd xmean, int index, bool first_iteration) {
-    Case *new_case;
-    new_case = new Case(GetTentativeBestCase());
+void CMA_ES::sampleStandardNormals() {
+    const int n_samples = int(lambda_);
+    arz_.resize(n_vars_, n_samples);
 
-    Eigen::VectorXd xmeanNormal(n_vars_);
-    Eigen::VectorXd erands_norm(n_vars_);
-    Eigen::VectorXd erands(n_vars_);
-    double penalty_dist = 0;
-    for (int i = 0; i < n_vars_; ++i) {
-        xmeanNormal(i) = random_normal_distribution(gen_, 0, 1, 1);
-    }
-    const IOFormat fmt(1, DontAlignCols, "\t", " ", "", "", "", "");
-    for (int i = 0; i < n_vars_; ++i) {
-        erands_norm(i) = xmean(i) + sigma_ * B_(i, i) * (D_(i) * xmeanNormal(i));
-        if (erands_norm(i) > 1.0) {
-            penalty_dist += abs(erands_norm(i) - 1.0);
-        } else if (erands_norm(i) < 0.0) {
-            penalty_dist += abs(erands_norm(i));
-        } else {
-            penalty_dist += 0;
-        }
-        erands(i) = lower_bound_(i) + erands_norm(i) * (upper_bound_(i) - lower_bound_(i));
-        //if (erands(i) < lower_bound_(i)) {
-        //    erands(i) = lower_bound_(i);
-        //} else if (erands(i) > upper_bound_(i)) {
-        //    erands(i) = upper_bound_(i);
-        //}
-    }
-    new_case->SetRealVarValues(erands);
-    constraint_handler_->CaseSatisfiesConstraints(new_case);
+    // One stream per (generation, member), so the samples only depend on the
+    // seed and not on the number of threads used to draw them.
+    int n_threads = n_vars_ * n_samples >= parallel_sampling_threshold_ ? 0 : 1;
+    fill_normal_columns(arz_, stream_seed_, generation_, n_threads);
+    generation_++;
+}
 
-    if (first_iteration) {
-        population_.push_back(Individual(new_case, gen_, index, erands_norm, penalty_dist));
-    } else {
-        temp_population_.push_back(Individual(new_case, gen_, index, erands_norm, penalty_dist));
+QList<Case *> CMA_ES::generatePopulation() {
+    const int n_samples = int(lambda_);
+    sampleStandardNormals();
+
+    // x_k = m + sigma * B * D * z_k, in coordinates normalized to the bounds
+    BD_.noalias() = B_ * D_.asDiagonal();
+    arx_.noalias() = sigma_ * BD_ * arz_;
+    arx_.colwise() += xmean_;
+
+    const Eigen::VectorXd range = upper_bound_ - lower_bound_;
+    Case *prototype = GetTentativeBestCase();
+    temp_population_.resize(n_samples);
+    QList<Case *> new_cases;
+    new_cases.reserve(n_samples);
+    for (int k = 0; k < n_samples; ++k) {
+        Individual &ind = temp_population_[k];
+        ind.erands_norm_ = arx_.col(k);
+        ind.penalty_dist_ = (ind.erands_norm_.array() - 1.0).max(0.0).sum()
+                            + (-ind.erands_norm_.array()).max(0.0).sum();
+        ind.rea_vars_ = lower_bound_ + ind.erands_norm_.cwiseProduct(range);
+        ind.index_ = k;
+        ind.case_pointer_ = new Case(prototype);
+        ind.case_pointer_->SetRealVarValues(ind.rea_vars_);
+        new_cases.append(ind.case_pointer_);
     }
-    return new_case;
+    // The previous generation's individuals become the buffers for the next one
+    std::swap(population_, temp_population_);
+    return new_cases;
 }
 }
 }
-
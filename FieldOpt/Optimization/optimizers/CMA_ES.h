@@ -65,24 +65,33 @@ public:
         int index_; //!< index
         Individual(Optimization::Case *c, boost::random::mt19937 &gen, int index, Eigen::VectorXd erands_norm, double penalty_dist);
         Individual(){}
-        double ofv() { return case_pointer_->objective_function_value(); }
+        double ofv() const { return case_pointer_->objective_function_value(); }
     };
 
 private:
     Settings::Optimizer *settings_;
     /*!
      * @brief
-     * Generates a set of cases within their given upper and lower bounds, based on the mean (or base case, if utilizied).
-     * @return
+     * Generates a new generation of lambda cases around the current mean, and makes it the current population.
+     *
+     * All samples are drawn as one matrix of standard normals and transformed with a single matrix product.
+     * The individuals (and their vectors) from the previous generation are reused as storage.
+     * @return The new cases. They are owned by the caller (normally handed to the CaseHandler).
      */
-    Case *generateCase(Eigen::VectorXd xmean, int index, bool first_iteration);
+    QList<Case *> generatePopulation();
+
+    /*!
+     * @brief Fill arz_ with lambda columns of standard normal samples, drawn from the random
+     * streams (stream_seed_, generation_, member). See fill_normal_columns in Utilities/random.hpp.
+     */
+    void sampleStandardNormals();
 
     void updateEvolutionPath(); //!< Updated the Evolution Path
     void adaptCovarianceMatrix(); //!< The adaption of Covariance Matrix (the CMA of CMA-ES)
     void decompositionOfC(); //!< Utilizing the Covariance matrix to update the next meanx.
-    vector<Individual> sortPopulation(vector<Individual> population);
+    void sortPopulation(); //!< Sort the population by objective function value, best first.
     vector<Individual> population_; //!< The storage vector of the population
-    vector<Individual> temp_population_; //!< Temporary storage for the new generation that will be merged.
+    vector<Individual> temp_population_; //!< Storage for the next generation; swapped with population_ when it is generated.
     bool improve_base_case_ = false;
     double stagnation_limit_; //!< The stagnation criterion, standard deviation of all particle positions.
     int population_size_ = -1; //!< The number of people in the population
@@ -109,7 +118,13 @@ private:
     Eigen::MatrixXd C_; //!< Co-variance matrix
     Eigen::MatrixXd invsqrtC_; //!< The inverse of the co-variance matrix
     double eigeneval_;
-    EigenSolver<MatrixXd> es_; //!< The EigenValueSolver from Eigen, which allows us to calculated the eigenvalues and eigenvector.
+    SelfAdjointEigenSolver<MatrixXd> es_; //!< Symmetric eigen solver for C, which allows us to calculated the eigenvalues and eigenvector.
+    Eigen::MatrixXd arz_; //!< Standard normal samples for the current generation (n_vars x lambda).
+    Eigen::MatrixXd arx_; //!< Normalized samples for the current generation (n_vars x lambda).
+    Eigen::MatrixXd BD_; //!< B * diag(D), recomputed for each generation.
+    uint64_t stream_seed_; //!< Base seed for the per-generation sampling streams, drawn from gen_.
+    int generation_; //!< Number of generations sampled so far; keys the sampling streams.
+    const int parallel_sampling_threshold_ = 1 << 16; //!< Minimum number of samples per generation before sampling in parallel.
     Eigen::VectorXd lower_bound_; //!< Lower bounds for the variables (used for generating populations, and maintaining the search space)
     Eigen::VectorXd upper_bound_; //!< Upper bounds for the variables (used for generating populations, and maintaining the search space)
     int n_vars_; //!< Number of variables in the problem.
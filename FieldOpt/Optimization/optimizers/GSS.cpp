@@ -52,6 +52,7 @@ GSS::GSS(Settings::Optimizer *settings,
     assert(expan_fac_ >= 1.0);
 
     directions_ = GSSPatterns::Compass(num_vars_);
+    opportunistic_ = settings->parameters().opportunistic_polling;
 
     if (!settings->parameters().auto_step_lengths) {
         step_lengths_ = Eigen::VectorXd(directions_.size());
@@ -189,5 +190,22 @@ Case * GSS::dequeue_case_with_worst_origin() {
     return queued_cases.last();
 }
 
+int GSS::abandon_poll() {
+    int nr_abandoned = 0;
+    for (Case *c : case_handler_->QueuedCases()) {
+        if (c->origin_case() != nullptr && c->origin_case()->id() == tentative_best_case_->id())
+            continue;
+        abandonQueuedCase(c);
+        nr_abandoned++;
+    }
+    for (Case *c : case_handler_->CasesBeingEvaluated()) {
+        if (c->origin_case() != nullptr && c->origin_case()->id() == tentative_best_case_->id())
+            continue;
+        requestCancellation(c);
+        nr_abandoned++;
+    }
+    return nr_abandoned;
+}
+
 }
 }
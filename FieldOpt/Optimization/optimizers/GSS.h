@@ -86,6 +86,7 @@ class GSS : public Optimizer {
   double expan_fac_; //!< Step length expansion factor.
   VectorXd step_lengths_; //!< Vector of step lengths.
   vector<VectorXi> directions_; //!< Vector of search directions.
+  bool opportunistic_; //!< Abandon the rest of a poll once an improving trial point has been found.
 
   /*!
    * @brief Contract the search pattern: step_lengths_ * contr_fac_
@@ -143,6 +144,17 @@ class GSS : public Optimizer {
    */
   Case *dequeue_case_with_worst_origin();
 
+  /*!
+   * @brief Abandon the trial points of the current poll that have not yet been evaluated:
+   * queued trial points are dequeued, and the runner is asked to cancel the simulations
+   * of the ones being evaluated.
+   *
+   * Used in opportunistic polling mode when an improving trial point has been found.
+   * Trial points generated from the (new) tentative best case are kept.
+   * @return The number of trial points abandoned.
+   */
+  int abandon_poll();
+
  private:
 
   /*!
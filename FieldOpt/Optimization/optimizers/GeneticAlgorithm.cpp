@@ -125,9 +125,7 @@ Case *GeneticAlgorithm::generateRandomCase() {
     auto new_case = new Case(GetTentativeBestCase());
 
     Eigen::VectorXd erands(n_vars_);
-    for (int i = 0; i < n_vars_; ++i) {
-        erands(i) = random_doubles(gen_, lower_bound_(i), upper_bound_(i), 1)[0];
-    }
+    fill_uniform(gen_, erands, lower_bound_, upper_bound_);
     new_case->SetRealVarValues(erands);
     return  new_case;
 }
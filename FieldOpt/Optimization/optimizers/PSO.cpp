@@ -23,6 +23,7 @@
 #include "Utilities/random.hpp"
 #include "Utilities/stringhelpers.hpp"
 #include <math.h>
+#include <algorithm>
 
 namespace Optimization{
 namespace Optimizers{
@@ -70,12 +71,29 @@ PSO::PSO(Settings::Optimizer *settings,
         swarm_.push_back(Particle(new_case ,gen_, v_max_, n_vars_));
         case_handler_->AddNewCase(new_case);
     }
+    steady_state_ = settings->parameters().steady_state;
+    n_generated_ = number_of_particles_;
+    n_evaluated_ = 0;
+    has_global_best_ = false;
+    if (steady_state_) {
+        is_async_ = true;
+        particle_best_ = swarm_;
+        particle_evaluated_ = vector<bool>(number_of_particles_, false);
+        for (int i = 0; i < number_of_particles_; ++i) {
+            particle_of_case_[swarm_[i].case_pointer->id()] = i;
+        }
+    }
     if (VERB_OPT > 2) {
         printSwarm();
     }
 }
 
 void PSO::iterate(){
+    if (steady_state_) {
+        // New positions are queued as soon as cases are evaluated
+        Printer::ext_warn("Iteration requested in steady-state mode. Skipping call.", "Optimization", "PSO");
+        return;
+    }
     if(enable_logging_){
         logger_->AddEntry(this);
     }
@@ -107,8 +125,12 @@ void PSO::handleEvaluatedCase(Case *c) {
             Printer::ext_info(ss.str(), "Optimization", "PSO");
         }
     }
+    if (steady_state_) {
+        handleSteadyStateCase(c);
+    }
 }
 
+
 Optimizer::TerminationCondition PSO::IsFinished() {
     if (case_handler_->CasesBeingEvaluated().size() > 0) return NOT_FINISHED;
     if (is_stagnant()) return MINIMUM_STEP_LENGTH_REACHED;
@@ -121,9 +143,7 @@ Case *PSO::generateRandomCase() {
     new_case = new Case(GetTentativeBestCase());
 
     Eigen::VectorXd erands(n_vars_);
-    for (int i = 0; i < n_vars_; ++i) {
-        erands(i) = random_doubles(gen_, lower_bound_(i), upper_bound_(i), 1)[0];
-    }
+    fill_uniform(gen_, erands, lower_bound_, upper_bound_);
     new_case->SetRealVarValues(erands);
     return  new_case;
 }
@@ -131,9 +151,7 @@ PSO::Particle::Particle(Optimization::Case *c, boost::random::mt19937 &gen, Vect
     case_pointer = c;
     rea_vars=c->GetRealVarVector();
     Eigen::VectorXd temp(n_vars);
-    for(int i = 0; i < rea_vars.size(); i++){
-        temp(i) = random_doubles(gen, -v_max(i), v_max(i), 1)[0];
-    }
+    fill_uniform(gen, temp, -v_max, v_max);
     rea_vars_velocity=temp;
 }
 void PSO::Particle::ParticleAdapt(Eigen::VectorXd rea_vars_velocity_swap, Eigen::VectorXd rea_vars_swap){
@@ -189,42 +207,91 @@ PSO::Particle PSO::find_best_in_particle_memory(int particle_num){
     }
     return best_in_particle_memory;
 }
+double PSO::inertia() const {
+    return inertia_decay_ ?
+           inertia_weight_max_ - ((iteration_*1.0/max_iterations_) * (inertia_weight_max_-inertia_weight_min_)) : inertia_weight_;
+}
+void PSO::update_particle_velocity(Particle &particle, const Particle &best_in_particle_memory, double inertia_multiple) {
+    // Two uniform draws per variable, interleaved as (r1, r2) for each variable
+    Eigen::VectorXd r(2 * n_vars_);
+    fill_uniform(gen_, r, 0.0, 1.0);
+    for(int j = 0; j < n_vars_; j++){
+        double velocity_1 = learning_factor_1_ * r(2*j) * (best_in_particle_memory.rea_vars(j)-particle.rea_vars(j));
+        double velocity_2 = learning_factor_2_ * r(2*j + 1) * (current_best_particle_global_.rea_vars(j)-particle.rea_vars(j));
+        particle.rea_vars_velocity(j) = (inertia_multiple * particle.rea_vars_velocity(j)) + velocity_1 + velocity_2;
+        if (particle.rea_vars_velocity(j) < -v_max_(j)){
+            particle.rea_vars_velocity(j) = -v_max_(j);
+        }else if(particle.rea_vars_velocity(j) > v_max_(j)){
+            particle.rea_vars_velocity(j) = v_max_(j);
+        }
+    }
+}
+void PSO::update_particle_position(Particle &particle) {
+    for(int j = 0; j < n_vars_; j++){
+        particle.rea_vars(j)=particle.rea_vars_velocity(j)+particle.rea_vars(j);
+        if (particle.rea_vars(j) > upper_bound_[j]){
+            particle.rea_vars(j) = upper_bound_[j]-abs(particle.rea_vars(j)-upper_bound_[j])*0.5;
+            particle.rea_vars_velocity(j) = particle.rea_vars_velocity(j)*-0.5;
+        } else if (particle.rea_vars(j) < lower_bound_[j]){
+            particle.rea_vars(j) = lower_bound_[j]+abs(particle.rea_vars(j)-lower_bound_[j])*0.5;
+            particle.rea_vars_velocity(j) = particle.rea_vars_velocity(j)*-0.5;
+        }
+    }
+}
 vector<PSO::Particle> PSO::update_velocity() {
     vector<Particle> new_swarm;
-    double inertia_multiple = inertia_decay_ ?
-                            inertia_weight_max_ - ((iteration_*1.0/max_iterations_) * (inertia_weight_max_-inertia_weight_min_)) : inertia_weight_;
+    double inertia_multiple = inertia();
     for(int i = 0; i < swarm_.size(); i++){
         Particle best_in_particle_memory = find_best_in_particle_memory(i);
         new_swarm.push_back(swarm_[i]);
-        for(int j = 0; j < n_vars_; j++){
-            double velocity_1 = learning_factor_1_ * random_double(gen_, 0, 1) * (best_in_particle_memory.rea_vars(j)-swarm_[i].rea_vars(j));
-            double velocity_2 = learning_factor_2_ * random_double(gen_, 0, 1) * (current_best_particle_global_.rea_vars(j)-swarm_[i].rea_vars(j));
-            new_swarm[i].rea_vars_velocity(j) = (inertia_multiple * swarm_[i].rea_vars_velocity(j)) + velocity_1 + velocity_2;
-            if (new_swarm[i].rea_vars_velocity(j) < -v_max_(j)){
-                new_swarm[i].rea_vars_velocity(j) = -v_max_(j);
-            }else if(new_swarm[i].rea_vars_velocity(j) > v_max_(j)){
-                new_swarm[i].rea_vars_velocity(j) = v_max_(j);
-            }
-        }
+        update_particle_velocity(new_swarm[i], best_in_particle_memory, inertia_multiple);
     }
     return new_swarm;
 }
 vector<PSO::Particle> PSO::update_position() {
     for(int i = 0; i < swarm_.size(); i++){
-        for(int j = 0; j < n_vars_; j++){
-            swarm_[i].rea_vars(j)=swarm_[i].rea_vars_velocity(j)+swarm_[i].rea_vars(j);
-            if (swarm_[i].rea_vars(j) > upper_bound_[j]){
-                swarm_[i].rea_vars(j) = upper_bound_[j]-abs(swarm_[i].rea_vars(j)-upper_bound_[j])*0.5;
-                swarm_[i].rea_vars_velocity(j) = swarm_[i].rea_vars_velocity(j)*-0.5;
-            } else if (swarm_[i].rea_vars(j) < lower_bound_[j]){
-                swarm_[i].rea_vars(j) = lower_bound_[j]+abs(swarm_[i].rea_vars(j)-lower_bound_[j])*0.5;
-                swarm_[i].rea_vars_velocity(j) = swarm_[i].rea_vars_velocity(j)*-0.5;
-            }
-        }
+        update_particle_position(swarm_[i]);
     }
     return swarm_;
 }
+void PSO::handleSteadyStateCase(Case *c) {
+    if (!particle_of_case_.contains(c->id())) {
+        Printer::ext_warn("Unable to handle case which does not belong to a particle.", "Optimization", "PSO");
+        return;
+    }
+    int i = particle_of_case_.take(c->id());
+    n_evaluated_++;
 
+    // Update the particle's own memory and the global best with its new position
+    if (!particle_evaluated_[i] || isBetter(c, particle_best_[i].case_pointer)) {
+        particle_best_[i] = swarm_[i];
+        particle_evaluated_[i] = true;
+    }
+    if (!has_global_best_ || isBetter(c, current_best_particle_global_.case_pointer)) {
+        current_best_particle_global_ = swarm_[i];
+        has_global_best_ = true;
+    }
 
+    // An iteration is number_of_particles_ evaluations after the initial swarm
+    int iteration = std::max(0, n_evaluated_ / number_of_particles_ - 1);
+    if (iteration > iteration_) {
+        iteration_ = iteration;
+        if (enable_logging_) {
+            logger_->AddEntry(this);
+        }
+    }
+
+    if (n_generated_ < (max_iterations_ + 1) * number_of_particles_) {
+        // Move only this particle, using the current global best
+        update_particle_velocity(swarm_[i], particle_best_[i], inertia());
+        update_particle_position(swarm_[i]);
+        Case *new_case = new Case(GetTentativeBestCase());
+        new_case->SetRealVarValues(swarm_[i].rea_vars);
+        swarm_[i].case_pointer = new_case;
+        particle_of_case_[new_case->id()] = i;
+        case_handler_->AddNewCase(new_case);
+        n_generated_++;
+    }
+}
 }
 }
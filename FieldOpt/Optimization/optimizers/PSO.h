@@ -32,6 +32,11 @@ namespace Optimizers {
  *
  * The implementation is based on the description found at:
  * http://www.cleveralgorithms.com/nature-inspired/swarm/pso.html
+ *
+ * With the SteadyState parameter set, particles are updated asynchronously:
+ * when a particle's case has been evaluated, its memory and the global best
+ * are updated, and the particle is moved and queued again right away using
+ * the current global best, without waiting for the rest of the swarm.
  */
 class PSO : public Optimizer {
  public:
@@ -86,6 +91,23 @@ class PSO : public Optimizer {
    * @return
    */
   vector<PSO::Particle> update_position();
+  /*!
+   * @brief Update the velocity of one particle from its own best position and the global best.
+   */
+  void update_particle_velocity(Particle &particle, const Particle &best_in_particle_memory, double inertia_multiple);
+  /*!
+   * @brief Move one particle according to its velocity, reflecting it off the bounds.
+   */
+  void update_particle_position(Particle &particle);
+  /*!
+   * @brief The inertia weight for the current iteration.
+   */
+  double inertia() const;
+  /*!
+   * @brief Steady-state mode: update the memory of the particle the case belongs to and
+   * the global best, then move the particle and queue its new position.
+   */
+  void handleSteadyStateCase(Case *c);
   /*!
    * @brief Prints the swarm and its current values in a readable format, calls print particle
    * @param swarm
@@ -127,6 +149,14 @@ class PSO : public Optimizer {
   Eigen::VectorXd upper_bound_; //!< Upper bounds for the variables (used for randomly generating populations and mutation)
   int n_vars_; //!< Number of variables in the problem.
 
+  bool steady_state_; //!< Run the asynchronous steady-state variant.
+  int n_generated_; //!< Steady-state mode: number of cases generated, including the initial swarm.
+  int n_evaluated_; //!< Steady-state mode: number of evaluated cases.
+  bool has_global_best_; //!< Steady-state mode: whether current_best_particle_global_ has been set.
+  QHash<QUuid, int> particle_of_case_; //!< Steady-state mode: the particle each queued case belongs to.
+  vector<Particle> particle_best_; //!< Steady-state mode: the best evaluated position of each particle.
+  vector<bool> particle_evaluated_; //!< Steady-state mode: whether each particle has been evaluated.
+
 };
 }
 }
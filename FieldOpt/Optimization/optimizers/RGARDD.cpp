@@ -20,6 +20,7 @@
 #include "Utilities/math.hpp"
 #include "Utilities/random.hpp"
 #include "RGARDD.h"
+#include <algorithm>
 
 namespace Optimization {
 namespace Optimizers {
@@ -38,12 +39,27 @@ RGARDD::RGARDD(Settings::Optimizer *settings,
     else discard_parameter_ = settings->parameters().discard_parameter;
     stagnation_limit_ = settings->parameters().stagnation_limit;
     mating_pool_ = population_;
+    steady_state_ = settings->parameters().steady_state;
+    n_generated_ = population_size_;
+    n_evaluated_ = 0;
+    if (steady_state_) {
+        // The population only holds evaluated chromosomes in steady-state mode
+        is_async_ = true;
+        population_.clear();
+        mating_pool_.clear();
+    }
     if (enable_logging_) {
         logger_->AddEntry(this);
         logger_->AddEntry(new ConfigurationSummary(this));
     }
 }
 void RGARDD::iterate() {
+    if (steady_state_) {
+        if (n_generated_ < (max_generations_ + 1) * population_size_) {
+            enqueueSteadyStateMember();
+        }
+        return;
+    }
     if (case_handler_->QueuedCases().size() > 0 || case_handler_->CasesBeingEvaluated().size() > 0) {
         Printer::ext_warn("Iteration requested while evaluation queue is not empty. Skipping call.", "Optimization", "RGARDD");
         return;
@@ -88,6 +104,10 @@ void RGARDD::iterate() {
     iteration_++;
 }
 void RGARDD::handleEvaluatedCase(Case *c) {
+    if (steady_state_) {
+        handleSteadyStateCase(c);
+        return;
+    }
     int index = -1;
     for (int i = 0; i < mating_pool_.size(); ++i) {
         if (mating_pool_[i].case_pointer == c) {
@@ -118,6 +138,79 @@ void RGARDD::handleEvaluatedCase(Case *c) {
         }
     }
 }
+void RGARDD::handleSteadyStateCase(Case *c) {
+    n_evaluated_++;
+
+    // Replace-worst: keep the population sorted from best to worst
+    auto pos = population_.begin();
+    while (pos != population_.end() && !isBetter(c, pos->case_pointer)) {
+        ++pos;
+    }
+    if (population_.size() < population_size_) {
+        population_.insert(pos, Chromosome(c));
+    }
+    else if (pos != population_.end()) {
+        population_.insert(pos, Chromosome(c));
+        population_.pop_back();
+    }
+
+    if (isImprovement(c)) {
+        updateTentativeBestCase(c);
+        if (enable_logging_) {
+            logger_->AddEntry(this);
+        }
+        if (VERB_OPT >= 1) {
+            Printer::ext_info("New best in generation " + Printer::num2str(iteration_) + ": "
+            + Printer::num2str(GetTentativeBestCase()->objective_function_value()), "RGARDD", "Optimization");
+        }
+    }
+
+    // A generation is population_size_ evaluations after the initial population
+    int generation = std::max(0, n_evaluated_ / population_size_ - 1);
+    if (generation > iteration_) {
+        iteration_ = generation;
+        if (enable_logging_) {
+            logger_->AddEntry(this);
+        }
+        if (population_.size() == population_size_ && is_stagnant()) {
+            if (VERB_OPT >= 1) {
+                Printer::ext_info("The population has stagnated in generation" +
+                                  Printer::num2str(iteration_) + ". Repopulating",
+                                  "RGARDD", "Optimization");
+            }
+            population_.resize(1); // New members are random until the population is full again
+        }
+    }
+
+    if (n_generated_ < (max_generations_ + 1) * population_size_) {
+        enqueueSteadyStateMember();
+    }
+}
+
+void RGARDD::enqueueSteadyStateMember() {
+    Case *new_case;
+    if (population_.size() < population_size_) {
+        new_case = generateRandomCase();
+    }
+    else {
+        mating_pool_ = selection(population_);
+        int i = random_integer(gen_, 0, population_size_ / 2 - 1);
+        Chromosome p1 = mating_pool_[i];
+        Chromosome p2 = mating_pool_[population_size_ / 2 + i];
+        vector<Chromosome> offspring;
+        if (random_double(gen_) > p_crossover_ && p1.rea_vars != p2.rea_vars) {
+            offspring = crossover(vector<Chromosome>{p1, p2});
+        }
+        else {
+            offspring = mutate(vector<Chromosome>{p1, p2});
+        }
+        offspring[0].createNewCase();
+        new_case = offspring[0].case_pointer;
+    }
+    case_handler_->AddNewCase(new_case);
+    n_generated_++;
+}
+
 vector<GeneticAlgorithm::Chromosome> RGARDD::selection(vector<Chromosome> population) {
     auto mating_pool = population_;
     int n_repl = floor(population_size_ * discard_parameter_);
@@ -210,6 +303,7 @@ map<string, string> RGARDD::ConfigurationSummary::GetState() {
     statemap["Crossover Probability"] = boost::lexical_cast<string>(opt_->p_crossover_);
     statemap["Decay Rate"] = boost::lexical_cast<string>(opt_->decay_rate_);
     statemap["Mutation Strength"] = boost::lexical_cast<string>(opt_->mutation_strength_);
+    statemap["Steady State"] = opt_->steady_state_ ? "yes" : "no";
 
     string constraints_used = "";
     for (auto cons : opt_->constraint_handler_->constraints()) {
@@ -45,6 +45,12 @@ namespace Optimizers {
  * passes below the stagnation limit. The stagnation indicator used
  * is the standard deviation of the population.
  *
+ * With the SteadyState parameter set, the algorithm runs asynchronously
+ * instead: each evaluated case replaces the worst member of the population
+ * if it is better, and a single new offspring is generated and queued
+ * immediately, so that no worker waits for the rest of a generation.
+ * Generations are then counted as population-size batches of evaluations.
+ *
  * \note This algorithm requires either that simple max/min bounds are
  * given (i.e. single numbers applying to all variables) as an optimizer
  * argument or that some form of bound constraints are used (e.g. reservoir
@@ -64,6 +70,9 @@ class RGARDD : public GeneticAlgorithm {
   vector<Chromosome> mating_pool_; //!< Holds the current mating pool.
   double discard_parameter_; //!< Determines the fraction of parents to be discarded in selection.
   double stagnation_limit_; //!< The threshold for when to regenerate the population.
+  bool steady_state_; //!< Run the asynchronous steady-state variant.
+  int n_generated_; //!< Steady-state mode: number of cases generated, including the initial population.
+  int n_evaluated_; //!< Steady-state mode: number of evaluated cases.
 
   /*!
    * @brief Perform the next iteration by generating a new mating pool
@@ -124,6 +133,19 @@ class RGARDD : public GeneticAlgorithm {
    */
   void repopulate();
 
+  /*!
+   * @brief Steady-state mode: insert an evaluated case in the (sorted) population,
+   * replacing the worst member if the population is full, then queue a new case.
+   */
+  void handleSteadyStateCase(Case *c);
+
+  /*!
+   * @brief Steady-state mode: generate and queue one new case. While the population
+   * is not full (initially, and after repopulation) this is a random case; otherwise
+   * it is an offspring of two parents picked from a ranking selection mating pool.
+   */
+  void enqueueSteadyStateMember();
+
   /*!
    * @brief Snap the variable values in a chromosome to the upper and lower bounds.
    * @param chrom The chromosome to be snapped.
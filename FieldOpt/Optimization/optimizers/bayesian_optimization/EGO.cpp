@@ -89,10 +89,8 @@ EGO::EGO(Settings::Optimizer *settings,
         }
         auto rng = get_random_generator(settings->parameters().rng_seed);
         for (int i = 0; i < n_initial_guesses_; ++i) {
-            VectorXd pos = VectorXd::Zero(lb_.size());
-            for (int i = 0; i < lb_.size(); ++i) {
-                pos(i) = random_double(rng, lb_(i), ub_(i));
-            }
+            VectorXd pos(lb_.size());
+            fill_uniform(rng, pos, lb_, ub_);
             Case * init_case = new Case(base_case);
             init_case->SetRealVarValues(pos);
             case_handler_->AddNewCase(init_case);
@@ -97,10 +97,8 @@ Eigen::VectorXd AFCompassSearch::Optimize(libgp::GaussianProcess *gp, Acquisitio
     return best_point;
 }
 VectorXd AFCompassSearch::generateRandomVector() {
-    VectorXd rands = VectorXd::Zero(lb_.size());
-    for (int i = 0; i < lb_.size(); ++i) {
-        rands(i) = random_double(gen_, lb_(i), ub_(i));
-    }
+    VectorXd rands(lb_.size());
+    fill_uniform(gen_, rands, lb_, ub_);
     return rands;
 }
 
@@ -138,10 +138,12 @@ AFPSO::Particle::Particle(VectorXd &lb, VectorXd &ub, boost::mt19937 &gen) {
     fit_best_nbhd = fit;
 }
 void AFPSO::Particle::update_velocity(double intertia, double c1, double c2, boost::random::mt19937 &gen) {
+    VectorXd r(2 * pos.size());
+    fill_uniform(gen, r, 0.0, 1.0);
     for (int i = 0; i < pos.size(); ++i) {
         vel(i) = intertia * vel(i)
-            + c1 * random_double(gen) * (pos_best_self(i) - pos(i))
-            + c2 * random_double(gen) * (pos_best_nbhd(i) - pos(i));
+            + c1 * r(2*i) * (pos_best_self(i) - pos(i))
+            + c2 * r(2*i + 1) * (pos_best_nbhd(i) - pos(i));
     }
 }
 void AFPSO::Particle::update_position(VectorXd &lb, VectorXd &ub) {
@@ -63,8 +63,11 @@ namespace Optimization {
         }
 
         void CompassSearch::handleEvaluatedCase(Case *c) {
-            if (isImprovement(c))
+            if (isImprovement(c)) {
                 updateTentativeBestCase(c);
+                if (opportunistic_)
+                    abandon_poll();
+            }
         }
 
         bool CompassSearch::is_successful_iteration() {
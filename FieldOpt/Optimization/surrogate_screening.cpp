@@ -0,0 +1,122 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include "surrogate_screening.h"
+#include "gp/rprop.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Optimization {
+
+SurrogateScreening::SurrogateScreening(const Settings::Optimizer::Parameters &parameters,
+                                       Settings::Optimizer::OptimizerMode mode,
+                                       int n_vars)
+    : af_(parameters) {
+    n_vars_ = n_vars;
+    sign_ = mode == Settings::Optimizer::OptimizerMode::Maximize ? 1.0 : -1.0;
+    oversampling_ = parameters.surrogate_oversampling;
+    min_cases_ = parameters.surrogate_min_cases > 0 ? parameters.surrogate_min_cases : 2 * n_vars;
+    gp_ = new libgp::GaussianProcess(n_vars, parameters.ego_kernel);
+    ofv_mean_ = 0.0;
+    ofv_std_ = 1.0;
+    target_ = 0.0;
+}
+
+SurrogateScreening::~SurrogateScreening() {
+    delete gp_;
+}
+
+bool SurrogateScreening::Fit(const QList<Case *> &simulated_cases) {
+    if (simulated_cases.size() < min_cases_) {
+        return false;
+    }
+
+    Eigen::MatrixXd xs(n_vars_, simulated_cases.size());
+    Eigen::VectorXd ys(simulated_cases.size());
+    for (int i = 0; i < simulated_cases.size(); ++i) {
+        xs.col(i) = simulated_cases[i]->GetRealVarVector();
+        ys(i) = simulated_cases[i]->objective_function_value();
+    }
+    x_lo_ = xs.rowwise().minCoeff();
+    x_hi_ = xs.rowwise().maxCoeff();
+    ofv_mean_ = ys.mean();
+    ofv_std_ = std::sqrt((ys.array() - ofv_mean_).square().sum() / ys.size());
+    if (ofv_std_ <= 0.0) {
+        ofv_std_ = 1.0;
+    }
+
+    // The training set changes scaling as it grows, so the model is rebuilt
+    gp_->clear_sampleset();
+    target_ = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < simulated_cases.size(); ++i) {
+        Eigen::VectorXd x = scale(xs.col(i));
+        double y = sign_ * (ys(i) - ofv_mean_) / ofv_std_;
+        gp_->add_pattern(x.data(), y);
+        target_ = std::max(target_, y);
+    }
+
+    Eigen::VectorXd params(gp_->covf().get_param_dim());
+    params.fill(-1);
+    gp_->covf().set_loghyper(params);
+    libgp::RProp rprop;
+    rprop.init();
+    rprop.maximize(gp_, 100, 0);
+    return true;
+}
+
+QList<Case *> SurrogateScreening::Select(const QList<Case *> &candidates, QList<Case *> &rejected) {
+    std::vector<std::pair<double, int>> scores;
+    for (int i = 0; i < candidates.size(); ++i) {
+        Eigen::VectorXd x = scale(candidates[i]->GetRealVarVector());
+        scores.push_back(std::make_pair(af_.Evaluate(gp_, x, target_), i));
+    }
+    std::stable_sort(scores.begin(), scores.end(),
+                     [](const std::pair<double, int> &a, const std::pair<double, int> &b) {
+                       return a.first > b.first;
+                     });
+
+    int n_selected = std::max(1, (int)std::ceil(candidates.size() / oversampling_));
+    QList<Case *> selected;
+    rejected.clear();
+    for (int k = 0; k < scores.size(); ++k) {
+        if (k < n_selected) selected.append(candidates[scores[k].second]);
+        else rejected.append(candidates[scores[k].second]);
+    }
+    return selected;
+}
+
+double SurrogateScreening::Predict(Case *c) {
+    Eigen::VectorXd x = scale(c->GetRealVarVector());
+    return ofv_mean_ + sign_ * ofv_std_ * gp_->f(x.data());
+}
+
+double SurrogateScreening::PredictStd(Case *c) {
+    Eigen::VectorXd x = scale(c->GetRealVarVector());
+    return ofv_std_ * std::sqrt(gp_->var(x.data()));
+}
+
+Eigen::VectorXd SurrogateScreening::scale(const Eigen::VectorXd &x) const {
+    Eigen::VectorXd range = x_hi_ - x_lo_;
+    Eigen::VectorXd scaled(x.size());
+    for (int i = 0; i < x.size(); ++i) {
+        scaled(i) = range(i) > 0.0 ? (x(i) - x_lo_(i)) / range(i) : 0.0;
+    }
+    return scaled;
+}
+
+}
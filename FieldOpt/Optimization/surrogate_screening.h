@@ -0,0 +1,102 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef FIELDOPT_SURROGATE_SCREENING_H
+#define FIELDOPT_SURROGATE_SCREENING_H
+
+#include <QList>
+#include <Eigen/Core>
+#include "Settings/optimizer.h"
+#include "case.h"
+#include "gp/gp.h"
+#include "optimizers/bayesian_optimization/AcquisitionFunction.h"
+
+namespace Optimization {
+
+/*!
+ * @brief The SurrogateScreening class decides which cases in a batch of
+ * generated cases are worth simulating.
+ *
+ * It fits a Gaussian Process (the same libgp model used by EGO) to the
+ * simulated cases, ranks the candidates by the acquisition function (which
+ * weighs predicted value against uncertainty), and selects the top
+ * 1/oversampling fraction of the batch for simulation.
+ *
+ * Objective function values are standardized and sign-flipped when
+ * minimizing, so that the model is always maximized; variables are scaled
+ * to [0, 1] using the range of the training cases.
+ *
+ * Enabled through the SurrogateScreening optimizer parameter; see
+ * Optimizer::GetCaseForEvaluation.
+ */
+class SurrogateScreening {
+ public:
+  /*!
+   * @param parameters Optimizer parameters: surrogate_* settings, and the kernel and
+   * acquisition function from ego_kernel and ego_af.
+   * @param mode Whether the objective is maximized or minimized.
+   * @param n_vars Number of continuous variables.
+   */
+  SurrogateScreening(const Settings::Optimizer::Parameters &parameters,
+                     Settings::Optimizer::OptimizerMode mode,
+                     int n_vars);
+  ~SurrogateScreening();
+
+  /*!
+   * @brief Fit the model to a set of simulated cases.
+   * @return False if there are too few cases to screen with; the model is then not updated.
+   */
+  bool Fit(const QList<Case *> &simulated_cases);
+
+  /*!
+   * @brief Split a batch of candidates into the ones to simulate and the ones to screen out.
+   * Requires a successful call to Fit().
+   * @param candidates The batch to screen.
+   * @param rejected Output: the candidates that should not be simulated.
+   * @return The candidates that should be simulated, best first. At least one case is always selected.
+   */
+  QList<Case *> Select(const QList<Case *> &candidates, QList<Case *> &rejected);
+
+  /*!
+   * @brief Predicted objective function value for a case.
+   */
+  double Predict(Case *c);
+
+  /*!
+   * @brief Predicted standard deviation of the objective function value for a case.
+   */
+  double PredictStd(Case *c);
+
+  int min_cases() const { return min_cases_; }
+
+ private:
+  libgp::GaussianProcess *gp_;
+  Optimizers::BayesianOptimization::AcquisitionFunction af_;
+  double sign_;          //!< +1 when maximizing, -1 when minimizing.
+  double oversampling_;  //!< Number of candidates per selected case.
+  int min_cases_;        //!< Minimum number of training cases.
+  int n_vars_;
+
+  double ofv_mean_, ofv_std_;   //!< Standardization of the training values.
+  Eigen::VectorXd x_lo_, x_hi_; //!< Scaling of the variables.
+  double target_;               //!< Best standardized training value.
+
+  Eigen::VectorXd scale(const Eigen::VectorXd &x) const;
+};
+
+}
+
+#endif //FIELDOPT_SURROGATE_SCREENING_H
@@ -52,4 +52,48 @@ TEST_F(ConstraintHandlerTest, BaseCaseSatisfyWellSplineLengthConstraint) {
     EXPECT_FALSE(constraint_handler_->constraints()[1]->CaseSatisfiesConstraint(base_case_));
 }
 
+TEST_F(ConstraintHandlerTest, PopulationMatchesPerCase) {
+    // Population of perturbed copies of the base case
+    int n_cases = 24;
+    QList<Optimization::Case *> cases;
+    Eigen::VectorXd base = base_case_->GetRealVarVector();
+    for (int row = 0; row < n_cases; ++row) {
+        Eigen::VectorXd x = base;
+        for (int j = 0; j < x.size(); ++j) {
+            x(j) += 0.02 * ((row * 7 + j * 13) % 11 - 5) * (std::abs(x(j)) + 1.0);
+        }
+        auto c = new Optimization::Case(base_case_);
+        c->SetRealVarValues(x);
+        cases.append(c);
+    }
+    Eigen::MatrixXd population(n_cases, base.size());
+    for (int row = 0; row < n_cases; ++row) {
+        population.row(row) = cases[row]->GetRealVarVector().transpose();
+    }
+    constraint_handler_->InitializeNormalizers(cases);
+
+    for (auto con : constraint_handler_->constraints()) {
+        auto feasible = con->PopulationSatisfiesConstraint(population, base_case_, 4);
+        auto penalties = con->PopulationPenaltyNormalized(population, base_case_, 4);
+        Eigen::MatrixXd snapped = population;
+        con->SnapPopulationToConstraint(snapped, base_case_, 4);
+
+        for (int row = 0; row < n_cases; ++row) {
+            auto c = new Optimization::Case(cases[row]);
+            EXPECT_EQ(con->CaseSatisfiesConstraint(c) ? 1 : 0, feasible(row)) << con->name();
+            EXPECT_NEAR((double)con->PenaltyNormalized(c), (double)penalties(row), 1e-9) << con->name();
+            con->SnapCaseToConstraints(c);
+            EXPECT_TRUE(c->GetRealVarVector().isApprox(snapped.row(row).transpose(), 1e-9)) << con->name();
+        }
+    }
+
+    // Handler-level batch API
+    auto feasible = constraint_handler_->PopulationSatisfiesConstraints(population, base_case_);
+    auto flags = constraint_handler_->CasesSatisfyConstraints(cases);
+    for (int row = 0; row < n_cases; ++row) {
+        EXPECT_EQ(constraint_handler_->CaseSatisfiesConstraints(new Optimization::Case(cases[row])), flags[row]);
+        EXPECT_EQ(flags[row] ? 1 : 0, feasible(row));
+    }
+}
+
 }
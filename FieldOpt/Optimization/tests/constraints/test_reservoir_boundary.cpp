@@ -24,6 +24,7 @@
 #include "Reservoir/tests/test_resource_grids.h"
 #include "Optimization/tests/test_resource_optimizer.h"
 #include "Model/tests/test_resource_variable_property_container.h"
+#include "ConstraintMath/well_constraint_projections/well_constraint_projections.h"
 
 namespace {
 
@@ -86,4 +87,56 @@ TEST_F(ReservoirBoundaryTest, CheckBoundConstraintSettings) {
 
     boundary_constraint_->findCornerCells();
 }
+
+TEST_F(ReservoirBoundaryTest, PrecomputedGeometry) {
+    // The precomputed feasibility check and projection must agree with the
+    // direct approach (checking/projecting onto every cell in the box).
+    QList<int> index_list;
+    QList<Reservoir::Grid::Cell> box_cells;
+    for (int i = bound_settings_.box_imin; i <= bound_settings_.box_imax; i++) {
+        for (int j = bound_settings_.box_jmin; j <= bound_settings_.box_jmax; j++) {
+            for (int k = bound_settings_.box_kmin; k <= bound_settings_.box_kmax; k++) {
+                index_list.append(grid_5spot_->GetCell(i, j, k).global_index());
+                box_cells.append(grid_5spot_->GetCell(i, j, k));
+            }
+        }
+    }
+    double z = grid_5spot_->GetCell(0).center().z();
+
+    // Points inside and outside the box, on a 5 x 5 lattice over the 5spot grid
+    std::vector<Eigen::Vector3d> points;
+    for (int a = 0; a < 5; ++a)
+        for (int b = 0; b < 5; ++b)
+            points.push_back(Eigen::Vector3d(-100 + 360 * a, -100 + 360 * b, z + 10 * (a - b)));
+
+    std::vector<bool> direct_feasible;
+    std::vector<Eigen::Vector3d> direct_projected;
+    for (auto &p : points) {
+        bool feasible = false;
+        for (int index : index_list) {
+            if (grid_5spot_->GetCell(index).EnvelopsPoint(p)) {
+                feasible = true;
+                break;
+            }
+        }
+        direct_feasible.push_back(feasible);
+        direct_projected.push_back(WellConstraintProjections::well_domain_constraint(p, box_cells));
+    }
+    for (int p = 0; p < points.size(); ++p) {
+        // Place both the heel and the toe at the point
+        test_case_spline_->set_real_variable_value(prod_heel_x_->id(), points[p].x());
+        test_case_spline_->set_real_variable_value(prod_heel_y_->id(), points[p].y());
+        test_case_spline_->set_real_variable_value(prod_heel_z_->id(), points[p].z());
+        test_case_spline_->set_real_variable_value(prod_toe_x_->id(), points[p].x());
+        test_case_spline_->set_real_variable_value(prod_toe_y_->id(), points[p].y());
+        test_case_spline_->set_real_variable_value(prod_toe_z_->id(), points[p].z());
+        EXPECT_EQ(direct_feasible[p], boundary_constraint_->CaseSatisfiesConstraint(test_case_spline_));
+
+        boundary_constraint_->SnapCaseToConstraints(test_case_spline_);
+        Eigen::Vector3d projected(test_case_spline_->real_variables()[prod_heel_x_->id()],
+                                  test_case_spline_->real_variables()[prod_heel_y_->id()],
+                                  test_case_spline_->real_variables()[prod_heel_z_->id()]);
+        EXPECT_NEAR((points[p] - direct_projected[p]).norm(), (points[p] - projected).norm(), 1e-6);
+    }
+}
 }
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <QJsonArray>
+#include <cmath>
+#include "Optimization/objective/NPV.h"
+#include "Simulation/results/synthetic_results.h"
+#include "Simulation/tests/test_resource_synthetic_simulator.h"
+
+using namespace Optimization::Objective;
+using namespace Simulation::Results;
+
+namespace {
+
+class NPVTest : public ::testing::Test, public TestResources::TestResourceSyntheticSimulator {
+protected:
+    NPVTest() {
+        QJsonObject component {{"Coefficient", 100.0}, {"Property", "CumulativeOilProduction"}};
+        QJsonArray components;
+        components.append(component);
+        component["Coefficient"] = -10.0;
+        component["Property"] = "CumulativeWaterProduction";
+        components.append(component);
+        settings_npv_ = new Settings::Optimizer(QJsonObject{
+            {"Type", "Compass"},
+            {"Mode", "Maximize"},
+            {"Parameters", QJsonObject{{"MaxEvaluations", 10}, {"InitialStepLength", 1.0}, {"MinimumStepLength", 0.1}}},
+            {"Objective", QJsonObject{{"Type", "NPV"}, {"NPVComponents", components}}}
+        });
+    }
+
+    Settings::Optimizer *settings_npv_;
+};
+
+TEST_F(NPVTest, SyntheticResults) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"Volume", 1000.0}});
+    NPV npv(settings_npv_, simulator->results(), model_);
+
+    SetContinuousVariables(1.0);
+    ASSERT_TRUE(simulator->Evaluate(10));
+    double oil = simulator->results()->GetValue(Results::CumulativeOilProduction);
+    double water = simulator->results()->GetValue(Results::CumulativeWaterProduction);
+    EXPECT_DOUBLE_EQ(100.0 * oil - 10.0 * water, npv.value());
+
+    // All liquid is oil at the optimum of the test function
+    double npv_off_optimum = npv.value();
+    SetContinuousVariables(0.0);
+    ASSERT_TRUE(simulator->Evaluate(10));
+    EXPECT_DOUBLE_EQ(100.0 * 1000.0, npv.value());
+    EXPECT_GT(npv.value(), npv_off_optimum);
+}
+
+TEST_F(NPVTest, OptimisticValueAtEnd) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"Volume", 1000.0}});
+    NPV npv(settings_npv_, simulator->results(), model_);
+    SetContinuousVariables(1.0);
+    ASSERT_TRUE(simulator->Evaluate(10));
+
+    // Nothing remains to be produced at the last report time
+    double end_time = simulator->results()->GetValueVector(Results::Time).back();
+    EXPECT_DOUBLE_EQ(npv.value(), npv.OptimisticValue(end_time, 2.0));
+}
+
+TEST_F(NPVTest, OptimisticValueLaterEnd) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"Volume", 1000.0}});
+    NPV npv(settings_npv_, simulator->results(), model_);
+    SetContinuousVariables(1.0);
+    ASSERT_TRUE(simulator->Evaluate(10));
+
+    // The synthetic production rates are constant, so the highest oil rate is the mean rate
+    auto times = simulator->results()->GetValueVector(Results::Time);
+    double oil_rate = simulator->results()->GetValue(Results::CumulativeOilProduction) / times.back();
+    double remaining_time = 1000.0;
+    double bound = npv.OptimisticValue(times.back() + remaining_time, 2.0);
+    EXPECT_GE(bound, npv.value());
+    EXPECT_LE(bound, npv.value() + 100.0 * 2.0 * oil_rate * remaining_time * (1.0 + 1e-9));
+    EXPECT_LT(npv.OptimisticValue(times.back() + remaining_time, 1.0), bound);
+}
+
+TEST_F(NPVTest, OptimisticValueMissingResults) {
+    // Failed evaluation
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"FailureRate", 1.0}});
+    NPV npv(settings_npv_, simulator->results(), model_);
+    SetContinuousVariables(1.0);
+    ASSERT_FALSE(simulator->Evaluate(10));
+    EXPECT_FALSE(std::isfinite(npv.OptimisticValue(1000.0, 2.0)));
+
+    // Missing water production
+    SyntheticResults results;
+    NPV npv_partial(settings_npv_, &results, model_);
+    results.SetValueVectors({
+        {Results::Time, {0.0, 100.0, 200.0}},
+        {Results::CumulativeOilProduction, {0.0, 10.0, 20.0}}
+    });
+    EXPECT_FALSE(std::isfinite(npv_partial.OptimisticValue(1000.0, 2.0)));
+
+    // Oil production for fewer report times than the time vector
+    results.SetValueVectors({
+        {Results::Time, {0.0, 100.0, 200.0}},
+        {Results::CumulativeOilProduction, {0.0, 10.0}},
+        {Results::CumulativeWaterProduction, {0.0, 1.0}}
+    });
+    EXPECT_FALSE(std::isfinite(npv_partial.OptimisticValue(1000.0, 2.0)));
+
+    // A single report time
+    results.SetValueVectors({
+        {Results::Time, {0.0}},
+        {Results::CumulativeOilProduction, {0.0}},
+        {Results::CumulativeWaterProduction, {0.0}}
+    });
+    EXPECT_FALSE(std::isfinite(npv_partial.OptimisticValue(1000.0, 2.0)));
+}
+
+}
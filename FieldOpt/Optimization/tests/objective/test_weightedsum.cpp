@@ -35,4 +35,9 @@ TEST_F(WeightedSumTest, Value) {
     EXPECT_FLOAT_EQ(fopt - 0.2*wwpt, obj->value());
 }
 
+TEST_F(WeightedSumTest, NoOptimisticBound) {
+    auto *obj = new WeightedSum(settings_optimizer_, results_ecl_horzwell_, model_);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), obj->OptimisticValue(1000.0, 2.0));
+}
+
 }
@@ -90,6 +90,24 @@ namespace {
         EXPECT_NEAR(1.0, best_case->GetRealVarVector()[1], 3);
     }
 
-}
-
+    TEST_F(CMA_ESTest, SeededRunsAreReproducible) {
+        settings_cma_es_min_->SetRngSeed(5);
+        std::vector<Eigen::VectorXd> runs[2];
+        for (int r = 0; r < 2; ++r) {
+            test_case_ga_spherical_6r_->set_objective_function_value(abs(Sphere(test_case_ga_spherical_6r_->GetRealVarVector())));
+            Optimization::Optimizer *minimizer = new CMA_ES(settings_cma_es_min_,
+                test_case_ga_spherical_6r_, varcont_6r_, grid_5spot_, logger_ );
+            for (int i = 0; i < 50 && !minimizer->IsFinished(); ++i) {
+                auto next_case = minimizer->GetCaseForEvaluation();
+                runs[r].push_back(next_case->GetRealVarVector());
+                next_case->set_objective_function_value(abs(Sphere(next_case->GetRealVarVector())));
+                minimizer->SubmitEvaluatedCase(next_case);
+            }
+        }
+        ASSERT_EQ(runs[0].size(), runs[1].size());
+        for (int i = 0; i < runs[0].size(); ++i) {
+            EXPECT_TRUE(runs[0][i].isApprox(runs[1][i]));
+        }
+    }
 
+}
@@ -75,6 +75,36 @@ namespace {
         EXPECT_NEAR(0.0, best_case->GetRealVarVector()[1], 0.01);
     }
 
+    TEST_F(CompassSearchTest, OpportunisticPolling) {
+        test_case_2r_->set_objective_function_value(Sphere(test_case_2r_->GetRealVarVector()));
+        settings_compass_search_min_unconstr_->SetOpportunisticPolling(true);
+        Optimization::Optimizer *minimizer = new CompassSearch(settings_compass_search_min_unconstr_,
+                                                               test_case_2r_,
+                                                               varcont_prod_bhp_,
+                                                               grid_5spot_,
+                                                               logger_
+        );
+
+        while (!minimizer->IsFinished()) {
+            auto next_case = minimizer->GetCaseForEvaluation();
+            next_case->set_objective_function_value(Sphere(next_case->GetRealVarVector()));
+            minimizer->SubmitEvaluatedCase(next_case);
+        }
+        auto best_case = minimizer->GetTentativeBestCase();
+        EXPECT_NEAR(0.0, best_case->objective_function_value(), 0.01);
+
+        // Trial points remaining in a poll when an improvement was found are never simulated
+        int abandoned = 0;
+        for (auto c : minimizer->case_handler()->AllCases()) {
+            if (c->state.queue == Optimization::Case::CaseState::QueueStatus::Q_DISCARDED) {
+                EXPECT_EQ(Optimization::Case::CaseState::EvalStatus::E_PENDING, c->state.eval);
+                abandoned++;
+            }
+        }
+        EXPECT_GT(abandoned, 0);
+        EXPECT_TRUE(minimizer->GetCasesToCancel().empty()); // Nothing is in flight in a serial run
+    }
+
     TEST_F(CompassSearchTest, TestFunctionRosenbrock) {
 
         // First test the Rosenbrock function itself
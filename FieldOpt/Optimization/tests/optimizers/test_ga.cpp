@@ -6,6 +6,7 @@
 #include "Optimization/tests/test_resource_optimizer.h"
 #include "Reservoir/tests/test_resource_grids.h"
 #include "Optimization/tests/test_resource_test_functions.h"
+#include "Optimization/tests/test_resource_simulated_workers.h"
 
 using namespace TestResources::TestFunctions;
 using namespace Optimization::Optimizers;
@@ -73,5 +74,25 @@ TEST_F(GeneticAlgorithmTest, TestFunctionRosenbrock) {
 //    EXPECT_NEAR(1.0, best_case->GetRealVarVector()[1], 2.5);
 }
 
+TEST_F(GeneticAlgorithmTest, SteadyStateHeavyTailedEvaluations) {
+    test_case_ga_spherical_6r_->set_objective_function_value(abs(Sphere(test_case_ga_spherical_6r_->GetRealVarVector())));
+    auto sphere = [](Eigen::VectorXd x) { return abs(Sphere(x)); };
+
+    TestResources::SimulatedWorkerPool generational_pool(8);
+    Optimization::Optimizer *generational = new RGARDD(settings_ga_min_, test_case_ga_spherical_6r_,
+                                                       varcont_6r_, grid_5spot_, logger_);
+    double generational_time = generational_pool.Run(generational, sphere);
+
+    settings_ga_min_->SetSteadyState(true);
+    TestResources::SimulatedWorkerPool steady_state_pool(8);
+    Optimization::Optimizer *steady_state = new RGARDD(settings_ga_min_, test_case_ga_spherical_6r_,
+                                                       varcont_6r_, grid_5spot_, logger_);
+    EXPECT_TRUE(steady_state->IsAsync());
+    double steady_state_time = steady_state_pool.Run(steady_state, sphere);
+
+    EXPECT_LT(steady_state_time, generational_time);
+    EXPECT_LE(steady_state->GetTentativeBestCase()->objective_function_value(),
+              test_case_ga_spherical_6r_->objective_function_value());
 }
 
+}
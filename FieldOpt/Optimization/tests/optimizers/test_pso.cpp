@@ -23,6 +23,7 @@
 #include "Optimization/tests/test_resource_optimizer.h"
 #include "Reservoir/tests/test_resource_grids.h"
 #include "Optimization/tests/test_resource_test_functions.h"
+#include "Optimization/tests/test_resource_simulated_workers.h"
 
 using namespace TestResources::TestFunctions;
 using namespace Optimization::Optimizers;
@@ -103,4 +104,25 @@ TEST_F(PSOTest, TestFunctionDecayRosenbrock) {
     EXPECT_NEAR(1.0, best_case->GetRealVarVector()[1], 0.5);
 }
 
+TEST_F(PSOTest, SteadyStateHeavyTailedEvaluations) {
+    test_case_ga_spherical_6r_->set_objective_function_value(abs(Sphere(test_case_ga_spherical_6r_->GetRealVarVector())));
+    auto sphere = [](Eigen::VectorXd x) { return abs(Sphere(x)); };
+    settings_pso_min_->SetRngSeed(5);
+
+    TestResources::SimulatedWorkerPool generational_pool(8);
+    Optimization::Optimizer *generational = new PSO(settings_pso_min_, test_case_ga_spherical_6r_,
+                                                    varcont_6r_, grid_5spot_, logger_);
+    double generational_time = generational_pool.Run(generational, sphere);
+
+    settings_pso_min_->SetSteadyState(true);
+    TestResources::SimulatedWorkerPool steady_state_pool(8);
+    Optimization::Optimizer *steady_state = new PSO(settings_pso_min_, test_case_ga_spherical_6r_,
+                                                    varcont_6r_, grid_5spot_, logger_);
+    EXPECT_TRUE(steady_state->IsAsync());
+    double steady_state_time = steady_state_pool.Run(steady_state, sphere);
+
+    EXPECT_GT(steady_state_pool.Utilization(steady_state_time), generational_pool.Utilization(generational_time));
+    EXPECT_LT(steady_state->GetTentativeBestCase()->objective_function_value(), 1.0);
+}
+
 }
@@ -75,6 +75,20 @@ namespace {
         EXPECT_FLOAT_EQ(123.0, case_handler_->EvaluatedCases().first()->objective_function_value());
     }
 
+    TEST_F(CaseHandlerTest, PrioritizeQueue) {
+        QHash<QUuid, double> priority;
+        priority[trivial_cases_[0]->id()] = 1.0;
+        priority[trivial_cases_[1]->id()] = 3.0;
+        priority[trivial_cases_[2]->id()] = 1.0;
+        priority[trivial_cases_[3]->id()] = 2.0;
+        case_handler_->PrioritizeQueue([&priority](Optimization::Case *c) { return priority[c->id()]; });
+        EXPECT_EQ(4, case_handler_->QueuedCases().size());
+        EXPECT_EQ(trivial_cases_[1]->id(), case_handler_->GetNextCaseForEvaluation()->id());
+        EXPECT_EQ(trivial_cases_[3]->id(), case_handler_->GetNextCaseForEvaluation()->id());
+        EXPECT_EQ(trivial_cases_[0]->id(), case_handler_->GetNextCaseForEvaluation()->id());
+        EXPECT_EQ(trivial_cases_[2]->id(), case_handler_->GetNextCaseForEvaluation()->id());
+    }
+
 // clear recent
 
 
@@ -70,4 +70,44 @@ namespace {
 
 
     }
+
+    TEST_F(CaseTransferObjectTest, Fidelity) {
+        test_case_3_4b3i3r_->SetFidelity(Case::FID_LOW);
+        auto cto1 = CaseTransferObject(test_case_3_4b3i3r_);
+        std::stringstream stream;
+        binary_oarchive oa(stream);
+        oa << cto1;
+        auto cto2 = CaseTransferObject();
+        binary_iarchive ia(stream);
+        ia >> cto2;
+        EXPECT_EQ(Case::FID_LOW, cto2.CreateCase()->GetFidelity());
+        EXPECT_EQ(Case::FID_HIGH, CaseTransferObject(test_case_2r_).CreateCase()->GetFidelity());
+    }
+
+    TEST_F(CaseTransferObjectTest, TerminationTarget) {
+        EXPECT_FALSE(CaseTransferObject(test_case_2r_).CreateCase()->HasTerminationTarget());
+        test_case_3_4b3i3r_->SetTerminationTarget(1234.5);
+        auto cto1 = CaseTransferObject(test_case_3_4b3i3r_);
+        std::stringstream stream;
+        binary_oarchive oa(stream);
+        oa << cto1;
+        auto cto2 = CaseTransferObject();
+        binary_iarchive ia(stream);
+        ia >> cto2;
+        EXPECT_TRUE(cto2.CreateCase()->HasTerminationTarget());
+        EXPECT_DOUBLE_EQ(1234.5, cto2.CreateCase()->GetTerminationTarget());
+    }
+
+    TEST_F(CaseTransferObjectTest, SimTimeout) {
+        EXPECT_EQ(0, CaseTransferObject(test_case_2r_).CreateCase()->GetSimTimeout());
+        test_case_3_4b3i3r_->SetSimTimeout(95);
+        auto cto1 = CaseTransferObject(test_case_3_4b3i3r_);
+        std::stringstream stream;
+        binary_oarchive oa(stream);
+        oa << cto1;
+        auto cto2 = CaseTransferObject();
+        binary_iarchive ia(stream);
+        ia >> cto2;
+        EXPECT_EQ(95, cto2.CreateCase()->GetSimTimeout());
+    }
 }
@@ -0,0 +1,77 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <gtest/gtest.h>
+#include "Optimization/optimizers/RGARDD.h"
+#include "Optimization/tests/test_resource_optimizer.h"
+#include "Optimization/tests/test_resource_test_functions.h"
+#include "Reservoir/tests/test_resource_grids.h"
+#include "Runner/tests/test_resource_runner.hpp"
+
+using namespace TestResources::TestFunctions;
+
+namespace {
+
+class MultiFidelityTest : public ::testing::Test,
+                          public TestResources::TestResourceOptimizer,
+                          public TestResources::TestResourceGrids
+{
+ protected:
+  MultiFidelityTest() {}
+  virtual ~MultiFidelityTest() {}
+};
+
+TEST_F(MultiFidelityTest, PromotesBestOfEachBatch) {
+    test_case_ga_spherical_6r_->set_objective_function_value(Sphere(test_case_ga_spherical_6r_->GetRealVarVector()));
+    settings_ga_min_->SetMultiFidelity(true);
+    Optimization::Optimizer *minimizer = new Optimization::Optimizers::RGARDD(
+        settings_ga_min_, test_case_ga_spherical_6r_, varcont_6r_, grid_5spot_, logger_);
+
+    // The low-fidelity model is a biased, but well correlated, version of the objective
+    int n_low = 0, n_high = 0;
+    while (!minimizer->IsFinished()) {
+        auto next_case = minimizer->GetCaseForEvaluation();
+        double ofv = Sphere(next_case->GetRealVarVector());
+        if (next_case->GetFidelity() == Optimization::Case::FID_LOW) {
+            next_case->set_objective_function_value(1.1 * ofv + 1.0);
+            n_low++;
+        }
+        else {
+            next_case->set_objective_function_value(ofv);
+            n_high++;
+        }
+        next_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_DONE;
+        minimizer->SubmitEvaluatedCase(next_case);
+    }
+
+    auto case_handler = minimizer->case_handler();
+    EXPECT_EQ(n_low, case_handler->NumberLowFidelity());
+    EXPECT_EQ(n_high, case_handler->NumberSimulated());
+    EXPECT_GT(n_low, n_high);
+
+    // Only high-fidelity values can become the best case
+    auto best = minimizer->GetTentativeBestCase();
+    EXPECT_EQ(Optimization::Case::FID_HIGH, best->GetFidelity());
+    for (auto c : case_handler->EvaluatedCases()) {
+        if (c->GetFidelity() == Optimization::Case::FID_HIGH && c != test_case_ga_spherical_6r_) {
+            EXPECT_NE(std::numeric_limits<double>::max(), c->GetLowFidelityOfv());
+        }
+    }
+}
+
+}
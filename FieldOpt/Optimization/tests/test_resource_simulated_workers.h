@@ -0,0 +1,102 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#ifndef FIELDOPT_TEST_RESOURCE_SIMULATED_WORKERS_H
+#define FIELDOPT_TEST_RESOURCE_SIMULATED_WORKERS_H
+
+#include <cmath>
+#include <functional>
+#include <vector>
+#include <boost/random.hpp>
+#include "Optimization/optimizer.h"
+
+namespace TestResources {
+
+/*!
+ * @brief Drives an optimizer with a pool of simulated workers and a simulated
+ * clock, following the scheduling of the SynchronousMPIRunner: queued cases are
+ * handed to free workers, new iterations are only requested when no cases are
+ * queued and all workers are idle, and otherwise we wait for the first worker
+ * to finish.
+ *
+ * Evaluation times are drawn from a Pareto distribution, i.e. they are heavy
+ * tailed like reservoir simulation run times tend to be.
+ */
+class SimulatedWorkerPool {
+ public:
+  /*!
+   * @param n_workers Number of workers.
+   * @param pareto_shape Shape parameter of the evaluation time distribution. Lower is heavier tailed.
+   * @param seed Seed for the evaluation time generator.
+   */
+  SimulatedWorkerPool(int n_workers, double pareto_shape = 1.5, int seed = 1)
+      : n_workers_(n_workers), pareto_shape_(pareto_shape), gen_(seed) {}
+
+  /*!
+   * @brief Run the optimizer to completion.
+   * @param objective Objective function, called with the continuous variables of each case.
+   * @return The simulated wall time, in units of the minimum evaluation time.
+   */
+  double Run(Optimization::Optimizer *optimizer, std::function<double(Eigen::VectorXd)> objective) {
+      struct Running { Optimization::Case *c; double done; };
+      std::vector<Running> running;
+      double clock = 0.0;
+      busy_time_ = 0.0;
+
+      while (!optimizer->IsFinished()) {
+          bool free_worker = running.size() < n_workers_;
+          if (free_worker && (optimizer->nr_queued_cases() > 0 || running.empty())) {
+              auto c = optimizer->GetCaseForEvaluation();
+              double duration = evaluationTime();
+              busy_time_ += duration;
+              running.push_back(Running{c, clock + duration});
+              continue;
+          }
+          if (running.empty()) break;
+          auto first = running.begin();
+          for (auto it = running.begin(); it != running.end(); ++it) {
+              if (it->done < first->done) first = it;
+          }
+          clock = first->done;
+          auto c = first->c;
+          running.erase(first);
+          c->set_objective_function_value(objective(c->GetRealVarVector()));
+          optimizer->SubmitEvaluatedCase(c);
+      }
+      return clock;
+  }
+
+  /*!
+   * @brief The fraction of the available worker time spent evaluating in the last run.
+   */
+  double Utilization(double wall_time) const { return busy_time_ / (wall_time * n_workers_); }
+
+ private:
+  int n_workers_;
+  double pareto_shape_;
+  double busy_time_ = 0.0;
+  boost::random::mt19937 gen_;
+
+  double evaluationTime() {
+      boost::random::uniform_real_distribution<> dist(0.0, 1.0);
+      return std::pow(1.0 - dist(gen_), -1.0 / pareto_shape_);
+  }
+};
+
+}
+
+#endif //FIELDOPT_TEST_RESOURCE_SIMULATED_WORKERS_H
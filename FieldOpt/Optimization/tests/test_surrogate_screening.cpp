@@ -0,0 +1,102 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <gtest/gtest.h>
+#include <boost/random.hpp>
+#include "Optimization/surrogate_screening.h"
+#include "Optimization/optimizers/RGARDD.h"
+#include "Optimization/tests/test_resource_optimizer.h"
+#include "Optimization/tests/test_resource_test_functions.h"
+#include "Reservoir/tests/test_resource_grids.h"
+#include "Runner/tests/test_resource_runner.hpp"
+
+using namespace TestResources::TestFunctions;
+
+namespace {
+
+class SurrogateScreeningTest : public ::testing::Test,
+                               public TestResources::TestResourceOptimizer,
+                               public TestResources::TestResourceGrids
+{
+ protected:
+  SurrogateScreeningTest() {}
+  virtual ~SurrogateScreeningTest() {}
+
+  Optimization::Case *sphereCase(Eigen::VectorXd x) {
+      auto c = new Optimization::Case(test_case_ga_spherical_6r_);
+      c->SetRealVarValues(x);
+      c->set_objective_function_value(Sphere(x));
+      return c;
+  }
+};
+
+TEST_F(SurrogateScreeningTest, SelectsPromisingCandidates) {
+    boost::random::mt19937 gen(1);
+    boost::random::uniform_real_distribution<> dist(-5.0, 5.0);
+    Optimization::SurrogateScreening screening(settings_ga_min_->parameters(),
+                                               Settings::Optimizer::OptimizerMode::Minimize, 6);
+
+    QList<Optimization::Case *> training;
+    EXPECT_FALSE(screening.Fit(training));
+    for (int i = 0; i < 40; ++i) {
+        Eigen::VectorXd x(6);
+        for (int j = 0; j < 6; ++j) x(j) = dist(gen);
+        training.append(sphereCase(x));
+    }
+    EXPECT_TRUE(screening.Fit(training));
+
+    // Two candidates near the optimum among ones far away from it
+    QList<Optimization::Case *> candidates;
+    for (int i = 0; i < 6; ++i) {
+        candidates.append(sphereCase(Eigen::VectorXd::Constant(6, i % 2 == 0 ? 4.5 : -4.5)));
+    }
+    candidates.append(sphereCase(Eigen::VectorXd::Constant(6, 0.1)));
+    candidates.append(sphereCase(Eigen::VectorXd::Constant(6, -0.1)));
+
+    QList<Optimization::Case *> rejected;
+    auto selected = screening.Select(candidates, rejected);
+    EXPECT_EQ(4, selected.size());
+    EXPECT_EQ(4, rejected.size());
+    EXPECT_TRUE(selected.contains(candidates[6]));
+    EXPECT_TRUE(selected.contains(candidates[7]));
+    EXPECT_LT(screening.Predict(candidates[6]), screening.Predict(candidates[0]));
+    EXPECT_GT(screening.PredictStd(candidates[0]), 0.0);
+}
+
+TEST_F(SurrogateScreeningTest, ScreenedOptimizerRun) {
+    test_case_ga_spherical_6r_->set_objective_function_value(Sphere(test_case_ga_spherical_6r_->GetRealVarVector()));
+    settings_ga_min_->SetSurrogateScreening(true);
+    Optimization::Optimizer *minimizer = new Optimization::Optimizers::RGARDD(
+        settings_ga_min_, test_case_ga_spherical_6r_, varcont_6r_, grid_5spot_, logger_);
+
+    while (!minimizer->IsFinished()) {
+        auto next_case = minimizer->GetCaseForEvaluation();
+        next_case->set_objective_function_value(Sphere(next_case->GetRealVarVector()));
+        minimizer->SubmitEvaluatedCase(next_case);
+    }
+    auto case_handler = minimizer->case_handler();
+    EXPECT_GT(case_handler->NumberScreened(), 0);
+    for (auto c : case_handler->EvaluatedCases()) {
+        if (c->state.eval == Optimization::Case::CaseState::EvalStatus::E_SCREENED) {
+            EXPECT_GE(c->objective_function_value(),
+                      minimizer->GetTentativeBestCase()->objective_function_value());
+        }
+    }
+}
+
+}
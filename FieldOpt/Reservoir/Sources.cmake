@@ -2,6 +2,8 @@ SET(RESERVOIR_HEADERS
 	grid/cell.h
 	grid/eclgrid.h
 	grid/grid.h
+	grid/grid_index.h
+	grid/column_locator.h
 	grid/ijkcoordinate.h
 )
 
@@ -9,6 +11,8 @@ SET(RESERVOIR_SOURCES
 	grid/cell.cpp
 	grid/eclgrid.cpp
 	grid/grid.cpp
+	grid/grid_index.cpp
+	grid/column_locator.cpp
 	grid/ijkcoordinate.cpp
 )
 
@@ -16,6 +20,8 @@ SET(RESERVOIR_TESTS
 	tests/test_resource_grids.h
 	tests/grid/test_cell.cpp
 	tests/grid/test_grid.cpp
+	tests/grid/test_grid_index.cpp
+	tests/grid/test_column_locator.cpp
 	tests/grid/test_ijkcoordinate.cpp
 )
 
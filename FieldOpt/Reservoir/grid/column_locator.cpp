@@ -0,0 +1,173 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#include "column_locator.h"
+#include "grid.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Reservoir {
+namespace Grid {
+
+using namespace std;
+
+ColumnLocator::ColumnLocator(Grid *grid) {
+    auto dims = grid->Dimensions();
+    nx_ = dims.nx;
+    ny_ = dims.ny;
+    int ncols = nx_ * ny_;
+    px_.assign(4 * ncols, 0.0);
+    py_.assign(4 * ncols, 0.0);
+    valid_.assign(ncols, 0);
+
+    // Corners 0, 1, 3, 2 go around the top face; corner c + 4 is the
+    // bottom end of the same pillar.
+    const int order[4] = {0, 1, 3, 2};
+    const double inf = numeric_limits<double>::infinity();
+    lo_ = Eigen::Vector2d(inf, inf);
+    Eigen::Vector2d hi = -lo_;
+    vector<Eigen::Vector2d> col_lo(ncols), col_hi(ncols);
+    for (int j = 0; j < ny_; ++j) {
+        for (int i = 0; i < nx_; ++i) {
+            int col = column(i, j);
+            Cell cell;
+            try {
+                cell = grid->GetCell(i, j, 0);
+            }
+            catch (const runtime_error &e) {
+                continue;
+            }
+            auto corners = cell.corners();
+            col_lo[col] = Eigen::Vector2d(inf, inf);
+            col_hi[col] = -col_lo[col];
+            for (int c = 0; c < 4; ++c) {
+                Eigen::Vector3d mid = 0.5 * (corners[order[c]] + corners[order[c] + 4]);
+                px_[4 * col + c] = mid.x();
+                py_[4 * col + c] = mid.y();
+                col_lo[col] = col_lo[col].cwiseMin(mid.head<2>());
+                col_hi[col] = col_hi[col].cwiseMax(mid.head<2>());
+            }
+            valid_[col] = 1;
+            lo_ = lo_.cwiseMin(col_lo[col]);
+            hi = hi.cwiseMax(col_hi[col]);
+        }
+    }
+    if (lo_.x() > hi.x()) { // No columns with geometry
+        lo_ = hi = Eigen::Vector2d::Zero();
+    }
+
+    nbx_ = max(1, nx_);
+    nby_ = max(1, ny_);
+    int nb[2] = {nbx_, nby_};
+    for (int a = 0; a < 2; ++a) {
+        double extent = hi(a) - lo_(a);
+        bin_size_(a) = extent > 0 ? extent / nb[a] : 1.0;
+    }
+
+    // Count the columns overlapping each bin, then fill
+    int nbins = nbx_ * nby_;
+    bin_start_.assign(nbins + 1, 0);
+    for (int pass = 0; pass < 2; ++pass) {
+        vector<int> fill;
+        if (pass == 1) {
+            for (int b = 0; b < nbins; ++b) bin_start_[b + 1] += bin_start_[b];
+            bin_columns_.resize(bin_start_[nbins]);
+            fill.assign(bin_start_.begin(), bin_start_.end() - 1);
+        }
+        for (int col = 0; col < ncols; ++col) {
+            if (!valid_[col]) continue;
+            for (int by = binCoord(col_lo[col].y(), 1); by <= binCoord(col_hi[col].y(), 1); ++by) {
+                for (int bx = binCoord(col_lo[col].x(), 0); bx <= binCoord(col_hi[col].x(), 0); ++bx) {
+                    int b = by * nbx_ + bx;
+                    if (pass == 0) bin_start_[b + 1]++;
+                    else bin_columns_[fill[b]++] = col;
+                }
+            }
+        }
+    }
+}
+
+int ColumnLocator::binCoord(double v, int axis) const {
+    int n = axis == 0 ? nbx_ : nby_;
+    int b = (int)floor((v - lo_(axis)) / bin_size_(axis));
+    return min(max(b, 0), n - 1);
+}
+
+bool ColumnLocator::footprintContains(int col, double x, double y) const {
+    // Crossing number test. Points on a shared edge belong to exactly one
+    // of the neighbouring columns, except on the outer boundary of the grid,
+    // which is handled by the tolerance check in FindColumn.
+    bool inside = false;
+    const double *px = &px_[4 * col];
+    const double *py = &py_[4 * col];
+    for (int a = 0, b = 3; a < 4; b = a++) {
+        if ((py[a] > y) != (py[b] > y)) {
+            double x_cross = px[a] + (y - py[a]) * (px[b] - px[a]) / (py[b] - py[a]);
+            if (x < x_cross) inside = !inside;
+        }
+    }
+    return inside;
+}
+
+bool ColumnLocator::FindColumn(double x, double y, int &i, int &j) const {
+    if (bin_columns_.empty()) return false;
+    double fx = (x - lo_.x()) / bin_size_.x();
+    double fy = (y - lo_.y()) / bin_size_.y();
+    if (fx < 0 || fy < 0 || fx > nbx_ || fy > nby_) return false;
+
+    int b = binCoord(y, 1) * nbx_ + binCoord(x, 0);
+    for (int c = bin_start_[b]; c < bin_start_[b + 1]; ++c) {
+        int col = bin_columns_[c];
+        if (footprintContains(col, x, y)) {
+            i = col % nx_;
+            j = col / nx_;
+            return true;
+        }
+    }
+
+    // Points exactly on the outer (max x/y) boundary of the grid: accept
+    // the column whose footprint is nearest within a small tolerance.
+    const double tol = 1e-9 * max(bin_size_.x(), bin_size_.y());
+    for (int c = bin_start_[b]; c < bin_start_[b + 1]; ++c) {
+        int col = bin_columns_[c];
+        for (double dx : {-tol, 0.0}) {
+            for (double dy : {-tol, 0.0}) {
+                if (footprintContains(col, x + dx, y + dy)) {
+                    i = col % nx_;
+                    j = col / nx_;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+Eigen::Vector2d ColumnLocator::ColumnCenter(int i, int j) const {
+    int col = column(i, j);
+    if (i < 0 || i >= nx_ || j < 0 || j >= ny_ || !valid_[col])
+        throw runtime_error("ColumnLocator::ColumnCenter: Column has no footprint.");
+    Eigen::Vector2d center(0, 0);
+    for (int c = 0; c < 4; ++c)
+        center += Eigen::Vector2d(px_[4 * col + c], py_[4 * col + c]);
+    return center / 4.0;
+}
+
+}
+}
@@ -0,0 +1,83 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#ifndef FIELDOPT_COLUMN_LOCATOR_H
+#define FIELDOPT_COLUMN_LOCATOR_H
+
+#include <Eigen/Dense>
+#include <vector>
+
+namespace Reservoir {
+namespace Grid {
+
+class Grid;
+
+/*!
+ * \brief The ColumnLocator class finds the (i,j) column containing an
+ * areal (x,y) point.
+ *
+ * On construction it reads the cells in the top layer of the grid once,
+ * and stores the footprint of each column as the quadrilateral formed
+ * by the pillar midpoints of its top layer cell (i.e. the cell's xy
+ * outline at the mid-depth of the layer). The footprints are binned by
+ * their bounding boxes into a uniform 2D grid with roughly one bin per
+ * column, so a lookup only tests the few footprints in a single bin.
+ *
+ * This is intended for vertical wells and 2D workflows, where only the
+ * column matters. Columns whose top cell can not be read have no
+ * footprint and are never returned.
+ *
+ * Use Grid::Columns() to get the (lazily constructed) locator for a grid.
+ */
+class ColumnLocator {
+ public:
+  explicit ColumnLocator(Grid *grid);
+
+  int nx() const { return nx_; }
+  int ny() const { return ny_; }
+
+  /*!
+   * \brief Find the column whose footprint contains the point (x, y).
+   * \param i Set to the (zero-based) i index of the column, if found.
+   * \param j Set to the (zero-based) j index of the column, if found.
+   * \return True if a column was found; otherwise false.
+   */
+  bool FindColumn(double x, double y, int &i, int &j) const;
+
+  /*!
+   * \brief Get the center of the footprint of column (i,j).
+   */
+  Eigen::Vector2d ColumnCenter(int i, int j) const;
+
+ private:
+  int nx_, ny_;
+  std::vector<double> px_, py_; //!< Footprint corners, four per column, in polygon order.
+  std::vector<char> valid_;     //!< Whether the column has a footprint.
+
+  Eigen::Vector2d lo_, bin_size_;
+  int nbx_, nby_;
+  std::vector<int> bin_start_, bin_columns_; //!< Columns overlapping each bin, in compressed row format.
+
+  int column(int i, int j) const { return j * nx_ + i; }
+  int binCoord(double v, int axis) const;
+  bool footprintContains(int col, double x, double y) const;
+};
+
+}
+}
+
+#endif //FIELDOPT_COLUMN_LOCATOR_H
@@ -121,10 +121,15 @@ Cell ECLGrid::GetCell(int global_index) {
     }
 
     if (type_ == GridSourceType::ECLIPSE) {
-        auto ertCell = ecl_grid_reader_->GetGridCell(global_index);
+        ERTWrapper::ECLGrid::ECLGridReader::Cell ertCell;
+        ERTWrapper::ECLGrid::ECLGridReader::IJKIndex ecl_ijk_index;
+        {
+            std::lock_guard<std::mutex> lock(ert_mutex_);
+            ertCell = ecl_grid_reader_->GetGridCell(global_index);
 
-        // Get IJK index corresponding to global index
-        auto ecl_ijk_index = ecl_grid_reader_->ConvertGlobalIndexToIJK(global_index);
+            // Get IJK index corresponding to global index
+            ecl_ijk_index = ecl_grid_reader_->ConvertGlobalIndexToIJK(global_index);
+        }
         IJKCoordinate ijk_index = IJKCoordinate(ecl_ijk_index.i,
                                                 ecl_ijk_index.j,
                                                 ecl_ijk_index.k);
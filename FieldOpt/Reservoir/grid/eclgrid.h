@@ -22,6 +22,7 @@
 #define ECLGRID_H
 
 #include <vector>
+#include <mutex>
 #include "grid.h"
 
 namespace Reservoir {
@@ -68,6 +69,14 @@ private:
  private:
   ERTWrapper::ECLGrid::ECLGridReader* ecl_grid_reader_ = 0;
 
+  /*!
+   * Serializes cell lookups in the ERT grid. ERT lazily caches cell
+   * centers inside the grid struct, so concurrent GetCell calls (e.g.
+   * from well index calculations running in parallel) must not
+   * touch it at the same time.
+   */
+  std::mutex ert_mutex_;
+
   /// Check that global_index is less than nx*ny*nz
   bool IndexIsInsideGrid(int global_index);
 
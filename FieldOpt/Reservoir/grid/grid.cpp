@@ -35,5 +35,21 @@ std::string Grid::GetGridFilePath() const {
     return file_path_;
 }
 
+const GridIndex &Grid::Index() {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (!index_) {
+        index_.reset(new GridIndex(this));
+    }
+    return *index_;
+}
+
+const ColumnLocator &Grid::Columns() {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (!columns_) {
+        columns_.reset(new ColumnLocator(this));
+    }
+    return *columns_;
+}
+
 }
 }
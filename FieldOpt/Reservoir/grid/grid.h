@@ -23,7 +23,11 @@
 
 #include "cell.h"
 #include "ijkcoordinate.h"
+#include "grid_index.h"
+#include "column_locator.h"
 #include "ERTWrapper/eclgridreader.h"
+#include <memory>
+#include <mutex>
 
 namespace Reservoir {
 namespace Grid {
@@ -133,10 +137,33 @@ class Grid
 
   std::string GetGridFilePath() const;
 
+  /*!
+   * @brief Get the spatial and property index for this grid, used
+   * for range, radius, segment and predicate queries over the cells.
+   *
+   * The index is built (by reading every cell once) on the first
+   * call, and reused after that.
+   */
+  const GridIndex &Index();
+
+  /*!
+   * @brief Get the areal (i,j) column locator for this grid, used to
+   * find the column containing an (x,y) point, e.g. for vertical wells.
+   *
+   * The locator is built (by reading the top layer of cells once) on
+   * the first call, and reused after that.
+   */
+  const ColumnLocator &Columns();
+
  protected:
   GridSourceType type_;
   std::string file_path_;
   Grid(GridSourceType type, std::string file_path);
+
+ private:
+  std::unique_ptr<GridIndex> index_;
+  std::unique_ptr<ColumnLocator> columns_;
+  std::mutex index_mutex_;
 };
 
 }
@@ -0,0 +1,313 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#include "grid_index.h"
+#include "grid.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Reservoir {
+namespace Grid {
+
+using namespace std;
+
+CellFilter CellFilter::Box(int imin, int imax, int jmin, int jmax, int kmin, int kmax) {
+    CellFilter filter;
+    filter.imin = imin; filter.imax = imax;
+    filter.jmin = jmin; filter.jmax = jmax;
+    filter.kmin = kmin; filter.kmax = kmax;
+    return filter;
+}
+
+bool CellFilter::Accepts(const GridIndex &index, int gi) const {
+    if (active_only && !index.active()[gi]) return false;
+    int ci = index.i()[gi], cj = index.j()[gi], ck = index.k()[gi];
+    if (ci < imin || ci > imax || cj < jmin || cj > jmax || ck < kmin || ck > kmax)
+        return false;
+    double px = index.permx()[gi], py = index.permy()[gi], pz = index.permz()[gi];
+    if (px < permx_min || px > permx_max) return false;
+    if (py < permy_min || py > permy_max) return false;
+    if (pz < permz_min || pz > permz_max) return false;
+    double poro = index.porosity()[gi];
+    if (poro < poro_min || poro > poro_max) return false;
+    if (predicate && !predicate(gi)) return false;
+    return true;
+}
+
+GridIndex::GridIndex(Grid *grid) {
+    grid_ = grid;
+    auto dims = grid->Dimensions();
+    int n = dims.nx * dims.ny * dims.nz;
+
+    const double nan = numeric_limits<double>::quiet_NaN();
+    center_x_.assign(n, nan); center_y_.assign(n, nan); center_z_.assign(n, nan);
+    min_x_.assign(n, nan); min_y_.assign(n, nan); min_z_.assign(n, nan);
+    max_x_.assign(n, nan); max_y_.assign(n, nan); max_z_.assign(n, nan);
+    i_.assign(n, -1); j_.assign(n, -1); k_.assign(n, -1);
+    active_.assign(n, 0);
+    permx_.assign(n, 0.0); permy_.assign(n, 0.0); permz_.assign(n, 0.0);
+    poro_.assign(n, 0.0); volume_.assign(n, 0.0);
+
+    for (int gi = 0; gi < n; ++gi) {
+        Cell cell;
+        try {
+            cell = grid->GetCell(gi);
+        }
+        catch (const runtime_error &e) {
+            continue; // Cells without geometry are never matched by queries
+        }
+        auto c = cell.center();
+        center_x_[gi] = c.x(); center_y_[gi] = c.y(); center_z_[gi] = c.z();
+
+        Eigen::Vector3d lo = cell.corners()[0], hi = cell.corners()[0];
+        for (auto &corner : cell.corners()) {
+            lo = lo.cwiseMin(corner);
+            hi = hi.cwiseMax(corner);
+        }
+        min_x_[gi] = lo.x(); min_y_[gi] = lo.y(); min_z_[gi] = lo.z();
+        max_x_[gi] = hi.x(); max_y_[gi] = hi.y(); max_z_[gi] = hi.z();
+
+        i_[gi] = cell.ijk_index().i();
+        j_[gi] = cell.ijk_index().j();
+        k_[gi] = cell.ijk_index().k();
+        active_[gi] = cell.is_active_matrix() ? 1 : 0;
+        if (!cell.permx().empty()) permx_[gi] = cell.permx()[0];
+        if (!cell.permy().empty()) permy_[gi] = cell.permy()[0];
+        if (!cell.permz().empty()) permz_[gi] = cell.permz()[0];
+        if (!cell.porosity().empty()) poro_[gi] = cell.porosity()[0];
+        volume_[gi] = cell.volume();
+    }
+
+    // Roughly one bin per 2x2x2 cells
+    nbx_ = max(1, (dims.nx + 1) / 2);
+    nby_ = max(1, (dims.ny + 1) / 2);
+    nbz_ = max(1, (dims.nz + 1) / 2);
+    buildBins();
+}
+
+void GridIndex::buildBins() {
+    const double inf = numeric_limits<double>::infinity();
+    lo_ = Eigen::Vector3d(inf, inf, inf);
+    hi_ = -lo_;
+    for (int gi = 0; gi < num_cells(); ++gi) {
+        if (std::isnan(min_x_[gi])) continue;
+        lo_ = lo_.cwiseMin(Eigen::Vector3d(min_x_[gi], min_y_[gi], min_z_[gi]));
+        hi_ = hi_.cwiseMax(Eigen::Vector3d(max_x_[gi], max_y_[gi], max_z_[gi]));
+    }
+    if (lo_.x() > hi_.x()) { // No cells with geometry
+        lo_ = hi_ = Eigen::Vector3d::Zero();
+    }
+    int nb[3] = {nbx_, nby_, nbz_};
+    for (int a = 0; a < 3; ++a) {
+        double extent = hi_(a) - lo_(a);
+        bin_size_(a) = extent > 0 ? extent / nb[a] : 1.0;
+    }
+    int nbins = nbx_ * nby_ * nbz_;
+
+    // Center bins
+    vector<int> cell_bin(num_cells(), -1);
+    center_bin_start_.assign(nbins + 1, 0);
+    for (int gi = 0; gi < num_cells(); ++gi) {
+        if (std::isnan(center_x_[gi])) continue;
+        cell_bin[gi] = binIndex(binCoord(center_x_[gi], 0),
+                                binCoord(center_y_[gi], 1),
+                                binCoord(center_z_[gi], 2));
+        center_bin_start_[cell_bin[gi] + 1]++;
+    }
+    for (int b = 0; b < nbins; ++b) center_bin_start_[b + 1] += center_bin_start_[b];
+    center_bin_cells_.resize(center_bin_start_[nbins]);
+    vector<int> fill(center_bin_start_.begin(), center_bin_start_.end() - 1);
+    for (int gi = 0; gi < num_cells(); ++gi) {
+        if (cell_bin[gi] >= 0) center_bin_cells_[fill[cell_bin[gi]]++] = gi;
+    }
+
+    // Bounding box bins: count, then fill
+    aabb_bin_start_.assign(nbins + 1, 0);
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 1) {
+            for (int b = 0; b < nbins; ++b) aabb_bin_start_[b + 1] += aabb_bin_start_[b];
+            aabb_bin_cells_.resize(aabb_bin_start_[nbins]);
+            fill.assign(aabb_bin_start_.begin(), aabb_bin_start_.end() - 1);
+        }
+        for (int gi = 0; gi < num_cells(); ++gi) {
+            if (std::isnan(min_x_[gi])) continue;
+            int bx0 = binCoord(min_x_[gi], 0), bx1 = binCoord(max_x_[gi], 0);
+            int by0 = binCoord(min_y_[gi], 1), by1 = binCoord(max_y_[gi], 1);
+            int bz0 = binCoord(min_z_[gi], 2), bz1 = binCoord(max_z_[gi], 2);
+            for (int bz = bz0; bz <= bz1; ++bz)
+                for (int by = by0; by <= by1; ++by)
+                    for (int bx = bx0; bx <= bx1; ++bx) {
+                        int b = binIndex(bx, by, bz);
+                        if (pass == 0) aabb_bin_start_[b + 1]++;
+                        else aabb_bin_cells_[fill[b]++] = gi;
+                    }
+        }
+    }
+}
+
+int GridIndex::binCoord(double v, int axis) const {
+    int nb = axis == 0 ? nbx_ : axis == 1 ? nby_ : nbz_;
+    int b = (int)floor((v - lo_(axis)) / bin_size_(axis));
+    return min(max(b, 0), nb - 1);
+}
+
+void GridIndex::forEachCenterCandidate(const Eigen::Vector3d &lo, const Eigen::Vector3d &hi,
+                                       const std::function<void(int)> &visit) const {
+    for (int a = 0; a < 3; ++a) {
+        if (hi(a) < lo_(a) || lo(a) > hi_(a)) return; // Query region outside grid
+    }
+    int bx0 = binCoord(lo.x(), 0), bx1 = binCoord(hi.x(), 0);
+    int by0 = binCoord(lo.y(), 1), by1 = binCoord(hi.y(), 1);
+    int bz0 = binCoord(lo.z(), 2), bz1 = binCoord(hi.z(), 2);
+    for (int bz = bz0; bz <= bz1; ++bz)
+        for (int by = by0; by <= by1; ++by)
+            for (int bx = bx0; bx <= bx1; ++bx) {
+                int b = binIndex(bx, by, bz);
+                for (int c = center_bin_start_[b]; c < center_bin_start_[b + 1]; ++c) {
+                    visit(center_bin_cells_[c]);
+                }
+            }
+}
+
+vector<int> GridIndex::CellsInBox(const Eigen::Vector3d &lo, const Eigen::Vector3d &hi,
+                                  const CellFilter &filter) const {
+    vector<int> cells;
+    forEachCenterCandidate(lo, hi, [&](int gi) {
+        if (center_x_[gi] >= lo.x() && center_x_[gi] <= hi.x() &&
+            center_y_[gi] >= lo.y() && center_y_[gi] <= hi.y() &&
+            center_z_[gi] >= lo.z() && center_z_[gi] <= hi.z() &&
+            filter.Accepts(*this, gi)) {
+            cells.push_back(gi);
+        }
+    });
+    sort(cells.begin(), cells.end());
+    return cells;
+}
+
+vector<int> GridIndex::CellsWithinRadius(const Eigen::Vector3d &p, double r,
+                                         const CellFilter &filter) const {
+    vector<int> cells;
+    Eigen::Vector3d rv(r, r, r);
+    double r2 = r * r;
+    forEachCenterCandidate(p - rv, p + rv, [&](int gi) {
+        if ((center(gi) - p).squaredNorm() <= r2 && filter.Accepts(*this, gi)) {
+            cells.push_back(gi);
+        }
+    });
+    sort(cells.begin(), cells.end());
+    return cells;
+}
+
+vector<int> GridIndex::CellsNearSegment(const Eigen::Vector3d &a, const Eigen::Vector3d &b, double r,
+                                        const CellFilter &filter) const {
+    vector<int> cells;
+    Eigen::Vector3d rv(r, r, r);
+    Eigen::Vector3d ab = b - a;
+    double ab2 = ab.squaredNorm();
+    double r2 = r * r;
+    forEachCenterCandidate(a.cwiseMin(b) - rv, a.cwiseMax(b) + rv, [&](int gi) {
+        Eigen::Vector3d c = center(gi);
+        double t = ab2 > 0 ? max(0.0, min(1.0, (c - a).dot(ab) / ab2)) : 0.0;
+        if ((a + t * ab - c).squaredNorm() <= r2 && filter.Accepts(*this, gi)) {
+            cells.push_back(gi);
+        }
+    });
+    sort(cells.begin(), cells.end());
+    return cells;
+}
+
+vector<int> GridIndex::CellsInPolygon(const vector<Eigen::Vector2d> &polygon,
+                                      const CellFilter &filter) const {
+    vector<int> cells;
+    if (polygon.size() < 3) return cells;
+
+    Eigen::Vector2d plo = polygon[0], phi = polygon[0];
+    for (auto &v : polygon) {
+        plo = plo.cwiseMin(v);
+        phi = phi.cwiseMax(v);
+    }
+    Eigen::Vector3d lo(plo.x(), plo.y(), lo_.z());
+    Eigen::Vector3d hi(phi.x(), phi.y(), hi_.z());
+
+    forEachCenterCandidate(lo, hi, [&](int gi) {
+        double x = center_x_[gi], y = center_y_[gi];
+        bool inside = false; // Crossing number test
+        for (size_t v = 0, w = polygon.size() - 1; v < polygon.size(); w = v++) {
+            if ((polygon[v].y() > y) != (polygon[w].y() > y) &&
+                x < (polygon[w].x() - polygon[v].x()) * (y - polygon[v].y())
+                    / (polygon[w].y() - polygon[v].y()) + polygon[v].x()) {
+                inside = !inside;
+            }
+        }
+        if (inside && filter.Accepts(*this, gi)) {
+            cells.push_back(gi);
+        }
+    });
+    sort(cells.begin(), cells.end());
+    return cells;
+}
+
+vector<int> GridIndex::CellsMatching(const CellFilter &filter) const {
+    vector<int> cells;
+    for (int gi = 0; gi < num_cells(); ++gi) {
+        if (!std::isnan(center_x_[gi]) && filter.Accepts(*this, gi)) {
+            cells.push_back(gi);
+        }
+    }
+    return cells;
+}
+
+int GridIndex::FindCellEnvelopingPoint(const Eigen::Vector3d &p, const CellFilter &filter) const {
+    for (int a = 0; a < 3; ++a) {
+        if (p(a) < lo_(a) || p(a) > hi_(a)) return -1;
+    }
+    int b = binIndex(binCoord(p.x(), 0), binCoord(p.y(), 1), binCoord(p.z(), 2));
+
+    vector<int> candidates;
+    for (int c = aabb_bin_start_[b]; c < aabb_bin_start_[b + 1]; ++c) {
+        int gi = aabb_bin_cells_[c];
+        if (p.x() >= min_x_[gi] && p.x() <= max_x_[gi] &&
+            p.y() >= min_y_[gi] && p.y() <= max_y_[gi] &&
+            p.z() >= min_z_[gi] && p.z() <= max_z_[gi] &&
+            filter.Accepts(*this, gi)) {
+            candidates.push_back(gi);
+        }
+    }
+    // Check the exact cell geometry, in global index order
+    sort(candidates.begin(), candidates.end());
+    for (int gi : candidates) {
+        if (grid_->GetCell(gi).EnvelopsPoint(p)) {
+            return gi;
+        }
+    }
+    return -1;
+}
+
+void GridIndex::CenterBounds(const vector<int> &cells, Eigen::Vector3d &lo, Eigen::Vector3d &hi) const {
+    if (cells.empty()) {
+        throw runtime_error("GridIndex::CenterBounds: The list of cells is empty.");
+    }
+    lo = hi = center(cells[0]);
+    for (int gi : cells) {
+        lo = lo.cwiseMin(center(gi));
+        hi = hi.cwiseMax(center(gi));
+    }
+}
+
+}
+}
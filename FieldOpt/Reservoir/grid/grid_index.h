@@ -0,0 +1,187 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#ifndef FIELDOPT_GRID_INDEX_H
+#define FIELDOPT_GRID_INDEX_H
+
+#include <Eigen/Dense>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace Reservoir {
+namespace Grid {
+
+class Grid;
+class GridIndex;
+
+/*!
+ * \brief The CellFilter struct describes the predicates a cell must
+ * satisfy to be returned by a GridIndex query. All limits are
+ * inclusive, and the default values accept every cell.
+ */
+struct CellFilter {
+  bool active_only = false; //!< Only accept cells that are active in the matrix grid.
+
+  int imin = 0, imax = std::numeric_limits<int>::max();
+  int jmin = 0, jmax = std::numeric_limits<int>::max();
+  int kmin = 0, kmax = std::numeric_limits<int>::max();
+
+  double permx_min = -std::numeric_limits<double>::infinity();
+  double permx_max =  std::numeric_limits<double>::infinity();
+  double permy_min = -std::numeric_limits<double>::infinity();
+  double permy_max =  std::numeric_limits<double>::infinity();
+  double permz_min = -std::numeric_limits<double>::infinity();
+  double permz_max =  std::numeric_limits<double>::infinity();
+  double poro_min  = -std::numeric_limits<double>::infinity();
+  double poro_max  =  std::numeric_limits<double>::infinity();
+
+  /*!
+   * Optional additional predicate, called with the global index of
+   * cells that pass all other tests.
+   */
+  std::function<bool(int)> predicate;
+
+  /*!
+   * \brief Convenience function for creating a filter restricted to
+   * an (i,j,k) box.
+   */
+  static CellFilter Box(int imin, int imax, int jmin, int jmax, int kmin, int kmax);
+
+  bool Accepts(const GridIndex &index, int global_index) const;
+};
+
+/*!
+ * \brief The GridIndex class is a query layer over a Grid.
+ *
+ * On construction it reads every cell in the grid once and stores
+ * the cell centers, axis-aligned bounding boxes, (i,j,k) indices,
+ * active flags and static properties in flat per-property arrays
+ * (structure-of-arrays). The cells are then binned into a uniform
+ * spatial grid, both by center and by bounding box, so that range
+ * queries only visit the cells in the bins overlapping the query
+ * region rather than the entire grid.
+ *
+ * Range queries (box, radius, segment distance and polygon) test the
+ * cell _centers_. FindCellEnvelopingPoint tests the full cell
+ * geometry of the candidates whose bounding box contains the point.
+ *
+ * All query methods are const and may be called concurrently. The
+ * returned global indices are sorted in ascending order.
+ *
+ * Use Grid::Index() to get the (lazily constructed) index for a grid.
+ */
+class GridIndex {
+ public:
+  explicit GridIndex(Grid *grid);
+
+  int num_cells() const { return (int)center_x_.size(); }
+
+  /*!
+   * \brief Cells with center inside the axis-aligned box [lo, hi].
+   */
+  std::vector<int> CellsInBox(const Eigen::Vector3d &lo, const Eigen::Vector3d &hi,
+                              const CellFilter &filter = CellFilter()) const;
+
+  /*!
+   * \brief Cells with center within distance r of point p.
+   */
+  std::vector<int> CellsWithinRadius(const Eigen::Vector3d &p, double r,
+                                     const CellFilter &filter = CellFilter()) const;
+
+  /*!
+   * \brief Cells with center within distance r of the line segment a-b.
+   */
+  std::vector<int> CellsNearSegment(const Eigen::Vector3d &a, const Eigen::Vector3d &b, double r,
+                                    const CellFilter &filter = CellFilter()) const;
+
+  /*!
+   * \brief Cells with center inside a polygon in the xy-plane. Use the
+   * k limits of the filter to restrict the query to a layer range.
+   * \param polygon Polygon vertices, in order. The polygon is closed
+   * implicitly.
+   */
+  std::vector<int> CellsInPolygon(const std::vector<Eigen::Vector2d> &polygon,
+                                  const CellFilter &filter = CellFilter()) const;
+
+  /*!
+   * \brief All cells accepted by the filter. This is a linear scan over
+   * the property arrays, but does not touch the underlying grid.
+   */
+  std::vector<int> CellsMatching(const CellFilter &filter) const;
+
+  /*!
+   * \brief Find a cell accepted by the filter that envelops point p.
+   * \return The global index of the cell, or -1 if no such cell exists.
+   */
+  int FindCellEnvelopingPoint(const Eigen::Vector3d &p,
+                              const CellFilter &filter = CellFilter()) const;
+
+  /*!
+   * \brief Get the bounding box of the centers of the given cells.
+   */
+  void CenterBounds(const std::vector<int> &cells, Eigen::Vector3d &lo, Eigen::Vector3d &hi) const;
+
+  // Per-cell property arrays, indexed by global index.
+  Eigen::Vector3d center(int gi) const { return Eigen::Vector3d(center_x_[gi], center_y_[gi], center_z_[gi]); }
+  const std::vector<double> &center_x() const { return center_x_; }
+  const std::vector<double> &center_y() const { return center_y_; }
+  const std::vector<double> &center_z() const { return center_z_; }
+  const std::vector<int> &i() const { return i_; }
+  const std::vector<int> &j() const { return j_; }
+  const std::vector<int> &k() const { return k_; }
+  const std::vector<char> &active() const { return active_; }
+  const std::vector<double> &permx() const { return permx_; }
+  const std::vector<double> &permy() const { return permy_; }
+  const std::vector<double> &permz() const { return permz_; }
+  const std::vector<double> &porosity() const { return poro_; }
+  const std::vector<double> &volume() const { return volume_; }
+
+ private:
+  Grid *grid_;
+
+  std::vector<double> center_x_, center_y_, center_z_;
+  std::vector<double> min_x_, min_y_, min_z_; //!< Cell bounding box lower corner.
+  std::vector<double> max_x_, max_y_, max_z_; //!< Cell bounding box upper corner.
+  std::vector<int> i_, j_, k_;
+  std::vector<char> active_; //!< Matrix active flag.
+  std::vector<double> permx_, permy_, permz_, poro_, volume_;
+
+  // Uniform spatial bins over the grid bounding box.
+  Eigen::Vector3d lo_, hi_, bin_size_;
+  int nbx_, nby_, nbz_;
+
+  // Bins in compressed row format: the cells in bin b are
+  // cells[start[b]] ... cells[start[b+1]-1].
+  std::vector<int> center_bin_start_, center_bin_cells_; //!< Each cell in the bin containing its center.
+  std::vector<int> aabb_bin_start_, aabb_bin_cells_;     //!< Each cell in all bins overlapped by its bounding box.
+
+  void buildBins();
+  int binCoord(double v, int axis) const;
+  int binIndex(int bx, int by, int bz) const { return (bz * nby_ + by) * nbx_ + bx; }
+
+  /*!
+   * \brief Visit all cells whose center lies in a bin overlapping [lo, hi].
+   */
+  void forEachCenterCandidate(const Eigen::Vector3d &lo, const Eigen::Vector3d &hi,
+                              const std::function<void(int)> &visit) const;
+};
+
+}
+}
+
+#endif //FIELDOPT_GRID_INDEX_H
@@ -0,0 +1,75 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Reservoir/grid/grid.h"
+#include "Reservoir/grid/eclgrid.h"
+#include "Reservoir/tests/test_resource_grids.h"
+
+using namespace Reservoir::Grid;
+
+namespace {
+
+class ColumnLocatorTest : public ::testing::Test, TestResources::TestResourceGrids {
+ protected:
+  ColumnLocatorTest() : Test(), TestResourceGrids() {}
+
+  virtual ~ColumnLocatorTest() {
+      delete grid_5spot_;
+      delete grid_horzwel_;
+      delete grid_norne_;
+  }
+};
+
+TEST_F(ColumnLocatorTest, FindColumn) {
+    // 5spot: 60x60x1 cells of 24x24 m
+    auto &columns = grid_5spot_->Columns();
+    EXPECT_EQ(&columns, &grid_5spot_->Columns()); // Built only once
+    EXPECT_EQ(60, columns.nx());
+    EXPECT_EQ(60, columns.ny());
+
+    int i, j;
+    EXPECT_TRUE(columns.FindColumn(12, 12, i, j));
+    EXPECT_EQ(0, i);
+    EXPECT_EQ(0, j);
+    EXPECT_TRUE(columns.FindColumn(130, 50, i, j));
+    EXPECT_EQ(5, i);
+    EXPECT_EQ(2, j);
+
+    // Points on the grid boundary belong to the boundary columns
+    EXPECT_TRUE(columns.FindColumn(1440, 1440, i, j));
+    EXPECT_EQ(59, i);
+    EXPECT_EQ(59, j);
+
+    EXPECT_FALSE(columns.FindColumn(-1, 12, i, j));
+    EXPECT_FALSE(columns.FindColumn(12, 1e5, i, j));
+}
+
+TEST_F(ColumnLocatorTest, MatchesEnvelopingCell) {
+    auto &columns = grid_horzwel_->Columns();
+    for (int gi : {0, 17, 200, 1619}) {
+        auto cell = grid_horzwel_->GetCell(gi);
+        auto center = grid_horzwel_->GetCell(cell.ijk_index().i(), cell.ijk_index().j(), 0).center();
+        int i, j;
+        ASSERT_TRUE(columns.FindColumn(center.x(), center.y(), i, j));
+        EXPECT_EQ(cell.ijk_index().i(), i);
+        EXPECT_EQ(cell.ijk_index().j(), j);
+        EXPECT_TRUE(columns.ColumnCenter(i, j).isApprox(center.head<2>(), 1e-6));
+    }
+}
+
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+#include "Reservoir/grid/grid.h"
+#include "Reservoir/grid/eclgrid.h"
+#include "Reservoir/tests/test_resource_grids.h"
+
+using namespace Reservoir::Grid;
+
+namespace {
+
+class GridIndexTest : public ::testing::Test, TestResources::TestResourceGrids {
+ protected:
+  GridIndexTest() : Test(), TestResourceGrids() {}
+
+  virtual ~GridIndexTest() {
+      delete grid_5spot_;
+      delete grid_horzwel_;
+      delete grid_norne_;
+  }
+};
+
+TEST_F(GridIndexTest, Build) {
+    auto &index = grid_5spot_->Index();
+    EXPECT_EQ(3600, index.num_cells());
+    EXPECT_EQ(&index, &grid_5spot_->Index()); // Built only once
+
+    auto cell = grid_5spot_->GetCell(61);
+    EXPECT_TRUE(cell.center().isApprox(index.center(61)));
+    EXPECT_EQ(cell.ijk_index().i(), index.i()[61]);
+    EXPECT_EQ(cell.ijk_index().j(), index.j()[61]);
+    EXPECT_DOUBLE_EQ(cell.permx()[0], index.permx()[61]);
+}
+
+TEST_F(GridIndexTest, RangeQueries) {
+    // 5spot: 60x60x1 cells of 24x24 m
+    auto &index = grid_5spot_->Index();
+    double z = index.center(0).z();
+
+    auto box = index.CellsInBox(Eigen::Vector3d(0, 0, z - 1), Eigen::Vector3d(48, 48, z + 1));
+    EXPECT_EQ(std::vector<int>({0, 1, 60, 61}), box);
+
+    auto radius = index.CellsWithinRadius(Eigen::Vector3d(12, 12, z), 25);
+    EXPECT_EQ(std::vector<int>({0, 1, 60}), radius);
+
+    auto segment = index.CellsNearSegment(Eigen::Vector3d(12, 12, z), Eigen::Vector3d(108, 12, z), 1.0);
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4}), segment);
+
+    std::vector<Eigen::Vector2d> triangle = {
+        Eigen::Vector2d(0, 0), Eigen::Vector2d(72, 0), Eigen::Vector2d(0, 72)
+    };
+    auto polygon = index.CellsInPolygon(triangle);
+    EXPECT_EQ(std::vector<int>({0, 1, 60}), polygon);
+
+    // Queries outside the grid return nothing
+    EXPECT_TRUE(index.CellsWithinRadius(Eigen::Vector3d(-1e4, -1e4, z), 10).empty());
+}
+
+TEST_F(GridIndexTest, Filters) {
+    auto &index = grid_5spot_->Index();
+    double z = index.center(0).z();
+
+    auto filter = CellFilter::Box(1, 2, 0, 59, 0, 0);
+    auto cells = index.CellsNearSegment(Eigen::Vector3d(12, 12, z), Eigen::Vector3d(108, 12, z), 1.0, filter);
+    EXPECT_EQ(std::vector<int>({1, 2}), cells);
+
+    filter = CellFilter();
+    filter.predicate = [](int gi) { return gi % 2 == 0; };
+    cells = index.CellsNearSegment(Eigen::Vector3d(12, 12, z), Eigen::Vector3d(108, 12, z), 1.0, filter);
+    EXPECT_EQ(std::vector<int>({0, 2, 4}), cells);
+
+    // Property filter matches a brute force scan
+    filter = CellFilter();
+    filter.active_only = true;
+    filter.permx_min = index.permx()[0];
+    auto matching = index.CellsMatching(filter);
+    std::vector<int> expected;
+    for (int gi = 0; gi < index.num_cells(); ++gi) {
+        auto cell = grid_5spot_->GetCell(gi);
+        if (cell.is_active_matrix() && cell.permx()[0] >= index.permx()[0])
+            expected.push_back(gi);
+    }
+    EXPECT_EQ(expected, matching);
+}
+
+TEST_F(GridIndexTest, EnvelopingPoint) {
+    auto &index = grid_horzwel_->Index();
+    for (int gi : {0, 17, 200, 1619}) {
+        auto center = grid_horzwel_->GetCell(gi).center();
+        EXPECT_EQ(grid_horzwel_->GetCellEnvelopingPoint(center).global_index(),
+                  index.FindCellEnvelopingPoint(center));
+    }
+    EXPECT_EQ(-1, index.FindCellEnvelopingPoint(Eigen::Vector3d(-1e6, 0, 0)));
+
+    // Restricted to a box not containing the point
+    auto center = grid_horzwel_->GetCell(0).center();
+    EXPECT_EQ(-1, index.FindCellEnvelopingPoint(center, CellFilter::Box(5, 10, 0, 8, 0, 8)));
+}
+
+}
@@ -8,9 +8,11 @@ SET(RUNNER_HEADERS
 	runners/mpi_runner.h
 	runners/oneoff_runner.h
 	runners/overseer.h
+	runners/overseer_metrics.h
 	runners/serial_runner.h
 	runners/synchronous_mpi_runner.h
 	runners/worker.h
+	runtime_predictor.h
 	runtime_settings.h
 )
 
@@ -23,15 +25,19 @@ SET(RUNNER_SOURCES
 	runners/mpi_runner.cpp
 	runners/oneoff_runner.cpp
 	runners/overseer.cpp
+	runners/overseer_metrics.cpp
 	runners/serial_runner.cpp
 	runners/synchronous_mpi_runner.cpp
 	runners/worker.cpp
+	runtime_predictor.cpp
 	runtime_settings.cpp
 )
 
 SET(RUNNER_TESTS
 	tests/test_resource_runner.hpp
 	tests/test_bookkeeper.cpp
+	tests/test_overseer_metrics.cpp
+	tests/test_runtime_predictor.cpp
 	tests/test_runtime_settings.cpp
 )
 
@@ -11,6 +11,14 @@ namespace Runner {
     bool Bookkeeper::IsEvaluated(Optimization::Case *c, bool set_obj)
     {
         for (auto evaluated_c : case_handler_->EvaluatedCases()) {
+            // Screened values are surrogate predictions; the case may still be simulated later
+            if (evaluated_c->state.eval == Optimization::Case::CaseState::EvalStatus::E_SCREENED)
+                continue;
+            // Early terminated values are optimistic bounds, and low-fidelity values can not
+            // stand in for high-fidelity ones
+            if (evaluated_c->state.eval == Optimization::Case::CaseState::EvalStatus::E_TERMINATED
+                || evaluated_c->GetFidelity() < c->GetFidelity())
+                continue;
             if (evaluated_c->Equals(c)) { // Case has been evaluated
                 if (set_obj) c->set_objective_function_value(evaluated_c->objective_function_value());
                 return true;
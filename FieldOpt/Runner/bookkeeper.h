@@ -29,6 +29,9 @@ public:
      * \brief IsEvaluated Check if a case has already been evaluated. If the set_obj parameter
      * is set to true, the objective value of the case will be set to that of the existing
      * case.
+     *
+     * Cases screened out by a surrogate are never matched, and cases evaluated at low
+     * fidelity are only matched by cases that are also to be evaluated at low fidelity.
      * \param c The case to check.
      * \param set_obj Automatically set the objective value if it is known.
      * \return True if objective value of these variable values has already been calculated; otherwise false.
@@ -21,6 +21,7 @@
 #include <QtCore/QJsonDocument>
 #include "logger.h"
 #include "Utilities/time.hpp"
+#include "Utilities/trace.hpp"
 #include <boost/algorithm/string.hpp>
 
 
@@ -42,6 +43,18 @@ Logger::Logger(Runner::RuntimeSettings *rts,
     run_state_path_ = output_dir_ + "/state_runner.txt";
     summary_prerun_path_ = output_dir_ + output_subdir + "/summary_prerun.md";
     summary_postrun_path_ = output_dir_ + output_subdir + "/summary_postrun.md";
+    summary_timing_path_ = output_dir_ + "/summary_timing.md";
+    if (!rts->trace_file().empty()) {
+        trace_path_ = QString::fromStdString(rts->trace_file());
+        if (is_worker_) { // One trace per rank, e.g. trace.json -> trace.rank1.json
+            QFileInfo trace_info(trace_path_);
+            trace_path_ = trace_info.path() + "/" + trace_info.completeBaseName() + "." + output_subdir
+                + (trace_info.suffix().isEmpty() ? "" : "." + trace_info.suffix());
+        }
+        if (write_logs_) {
+            Utilities::Trace::Tracer::Instance().EnableEvents(true);
+        }
+    }
     QStringList log_paths = (QStringList() << cas_log_path_ << opt_log_path_ << ext_log_path_ << run_state_path_
                                            << summary_prerun_path_ << summary_postrun_path_);
 
@@ -181,6 +194,17 @@ void Logger::logExtended(Loggable *obj) {
     }
     new_entry.insert("ProductionData", prod);
 
+    // Time spent computing well indices per well [ms]
+    QJsonObject wic_times;
+    for (auto const a : obj->GetValues()) {
+        if(a.first.compare(0, 4, "Wic#") == 0) {
+            wic_times.insert(QString::fromStdString(a.first.substr(4)), a.second[0]);
+        }
+    }
+    if (wic_times.count() > 0) {
+        new_entry.insert("WellIndexTimes", wic_times);
+    }
+
     // Compdat string
     new_entry.insert("COMPDAT", QString::fromStdString(obj->GetState()["COMPDAT"]));
 
@@ -364,6 +388,11 @@ void Logger::FinalizePostrunSummary() {
     sum << "* [Optimizer](#optimizer)\n";
     sum << "* [Evaluation](#evaluation)\n";
     sum << "* [Best Case](#best-case)\n";
+    for (auto section : sum_sections_) {
+        sum << "* [" << section.first << "](#" << boost::algorithm::to_lower_copy(
+            boost::algorithm::replace_all_copy(section.first, " ", "-")) << ")\n";
+    }
+    sum << "* [Timing](#timing)\n";
     sum << "\n";
 
     // ==> Breif summary table <==
@@ -411,12 +440,40 @@ void Logger::FinalizePostrunSummary() {
     sum << "### Compdat\n\n";
     sum << "```\n";
     sum << sum_mod_statemap_["compdat"] << "\n";
-    sum << "```\n";
+    sum << "```\n\n";
+
+    for (auto section : sum_sections_) {
+        sum << "## " << section.first << "\n\n";
+        sum << section.second << "\n";
+    }
+
+    // ==> Timing <==
+    sum << "## Timing\n\n";
+    sum << "Wall time spent in each phase on this process. Worker timings are in summary_timing.md in the rank directories.\n\n";
+    sum << Utilities::Trace::Tracer::Instance().SummaryTable();
 
     string str = sum.str();
     Utilities::FileHandling::WriteStringToFile(QString::fromStdString(str), summary_postrun_path_);
 }
 
+void Logger::AddSummarySection(string title, string body) {
+    sum_sections_.push_back(make_pair(title, body));
+}
+
+void Logger::FinalizeTiming() {
+    if (!write_logs_) return;
+    auto &tracer = Utilities::Trace::Tracer::Instance();
+    if (is_worker_) {
+        stringstream sum;
+        sum << "# FieldOpt timing (rank " << tracer.process_id() << ")\n\n";
+        sum << tracer.SummaryTable();
+        Utilities::FileHandling::WriteStringToFile(QString::fromStdString(sum.str()), summary_timing_path_);
+    }
+    if (!trace_path_.isEmpty()) {
+        tracer.WriteChromeTrace(trace_path_.toStdString());
+    }
+}
+
 void Logger::appendWellToc(map<string, Loggable::WellDescription> wellmap, stringstream &sum) {
     sum << "| Name                      | Group      | Type       |\n";
     sum << "| ------------------------- | ---------- | ---------- |\n";
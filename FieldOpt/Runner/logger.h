@@ -52,8 +52,12 @@ using namespace std;
  * In addition to these, two markdown-formatted summary logs (summary_prerun.md and
  * summary_postrun) will be written at the start and at the end of the run.
  *
- * Finally, files indicating the current state of each worker will be written when
+ * Files indicating the current state of each worker will be written when
  * running in parallel (state_runner.txt).
+ *
+ * Finally, the phase timings collected by Utilities::Trace are added to the post-run
+ * summary (summary_timing.md on workers), and, if a trace file is given in the runtime
+ * settings, written as a Chrome/Perfetto trace.
  */
 class Logger
 {
@@ -70,6 +74,19 @@ class Logger
   void FinalizePrerunSummary();
   void FinalizePostrunSummary();
 
+  /*!
+   * \brief Add a section to the post-run summary, after the best case.
+   * \param title Section title.
+   * \param body Markdown-formatted section body.
+   */
+  void AddSummarySection(string title, string body);
+
+  /*!
+   * \brief Write the phase timings of this process: the timing summary on workers and
+   * the trace file, if one was requested. The root's timings go into the post-run summary.
+   */
+  void FinalizeTiming();
+
  private:
   bool is_worker_; //!< Indicates whether or not this logger is on a worker process. This determines which logs are written.
   bool write_logs_;
@@ -81,6 +98,8 @@ class Logger
   QString run_state_path_; //!< Path to the runner state file.
   QString summary_prerun_path_; //!< Path to the pre-run summary file.
   QString summary_postrun_path_; //!< Path to the pre-run summary file.
+  QString summary_timing_path_; //!< Path to the timing summary file (workers only).
+  QString trace_path_; //!< Path to the trace file. Empty if no trace should be written.
 
   map<string, vector<double>> sum_mod_valmap_; //!< Model summary value map.
   map<string, vector<double>> sum_opt_valmap_; //!< Optimizer summary value map.
@@ -89,6 +108,7 @@ class Logger
   map<string, string> sum_opt_statemap_; //!< Optimizer summary state map.
   map<string, string> sum_rts_statemap_; //!< Runtime settings summary state map.
   map<string, Loggable::WellDescription> sum_wellmap_; //!< Model summary well map.
+  vector<pair<string, string>> sum_sections_; //!< Additional post-run summary sections (title, body).
 
   /*!
    * @brief The column widths count from after the leading comma (if there is one) up to the
@@ -31,6 +31,7 @@
 #include "Optimization/optimizers/VFSA.h"
 #include "Optimization/optimizers/SPSA.h"
 #include "Simulation/simulator_interfaces/ix_simulator.h"
+#include "Simulation/simulator_interfaces/synthetic_simulator.h"
 #include "abstract_runner.h"
 #include "Optimization/optimizers/compass_search.h"
 #include "Optimization/optimizers/ExhaustiveSearch2DVert.h"
@@ -40,6 +41,10 @@
 #include "Utilities/math.hpp"
 #include "Utilities/printer.hpp"
 #include "Utilities/verbosity.h"
+#include "Utilities/time.hpp"
+#include "Utilities/trace.hpp"
+#include <cmath>
+#include <limits>
 
 namespace Runner {
 
@@ -54,6 +59,12 @@ AbstractRunner::AbstractRunner(RuntimeSettings *runtime_settings)
     base_case_ = 0;
     optimizer_ = 0;
     bookkeeper_ = 0;
+    early_termination_ = false;
+    schedule_end_time_ = 0;
+    monitored_case_ = nullptr;
+    early_terminated_ = false;
+    early_termination_bound_ = 0;
+    runtime_predictor_ = nullptr;
 }
 
 double AbstractRunner::sentinelValue() const
@@ -83,6 +94,31 @@ void AbstractRunner::InitializeSettings(QString output_subdirectory)
     else {
         is_ensemble_run_ = false;
     }
+
+    is_multi_fidelity_run_ = settings_->optimizer()->parameters().multi_fidelity;
+    if (is_multi_fidelity_run_ && !settings_->simulator()->is_multi_fidelity()) {
+        throw std::runtime_error("MultiFidelity optimization requires a LowFidelity deck in the Simulator section.");
+    }
+    early_termination_ = settings_->simulator()->early_termination().enabled;
+    if (early_termination_) {
+        if (settings_->optimizer()->mode() != Settings::Optimizer::OptimizerMode::Maximize) {
+            throw std::runtime_error("EarlyTermination is only supported when maximizing.");
+        }
+        if (settings_->simulator()->is_ensemble()) {
+            throw std::runtime_error("EarlyTermination can not be combined with an ensemble.");
+        }
+        if (settings_->optimizer()->objective().type != Settings::Optimizer::ObjectiveType::NPV) {
+            Printer::ext_warn("EarlyTermination requires an NPV objective to bound; no simulations will be terminated.",
+                              "Runner", "AbstractRunner");
+        }
+        schedule_end_time_ = settings_->model()->control_times().last();
+    }
+}
+
+const Settings::Ensemble::Realization &AbstractRunner::fidelityDeck(const Optimization::Case *c) const {
+    if (c->GetFidelity() == Optimization::Case::FID_LOW)
+        return settings_->simulator()->low_fidelity();
+    return settings_->simulator()->high_fidelity();
 }
 
 void AbstractRunner::InitializeModel()
@@ -102,27 +138,38 @@ void AbstractRunner::InitializeSimulator()
     if (model_ == 0)
         throw std::runtime_error("The Model must be initialized before the simulator.");
 
-    switch (settings_->simulator()->type()) {
+    simulator_ = createSimulator(settings_, model_);
+}
+
+Simulation::Simulator *AbstractRunner::createSimulator(Settings::Settings *settings, Model::Model *model) const
+{
+    Simulation::Simulator *simulator;
+    switch (settings->simulator()->type()) {
         case ::Settings::Simulator::SimulatorType::ECLIPSE:
             if (VERB_RUN >= 1) Printer::info("Using ECLIPSE reservoir simulator.");
-            simulator_ = new Simulation::ECLSimulator(settings_, model_);
+            simulator = new Simulation::ECLSimulator(settings, model);
             break;
         case ::Settings::Simulator::SimulatorType::ADGPRS:
             if (VERB_RUN >= 1) Printer::info("Using AD-GPRS reservoir simulator.");
-            simulator_ = new Simulation::AdgprsSimulator(settings_, model_);
+            simulator = new Simulation::AdgprsSimulator(settings, model);
             break;
         case ::Settings::Simulator::SimulatorType::Flow:
             if (VERB_RUN >= 1) Printer::info("Using Flow reservoir simulator.");
-            simulator_ = new Simulation::ECLSimulator(settings_, model_);
+            simulator = new Simulation::ECLSimulator(settings, model);
             break;
         case ::Settings::Simulator::SimulatorType::INTERSECT:
             if (VERB_RUN >= 1) Printer::info("Using INTERSECT reservoir simulator.");
-            simulator_ = new Simulation::IXSimulator(settings_, model_);
+            simulator = new Simulation::IXSimulator(settings, model);
+            break;
+        case ::Settings::Simulator::SimulatorType::Synthetic:
+            if (VERB_RUN >= 1) Printer::info("Using synthetic in-process simulator.");
+            simulator = new Simulation::SyntheticSimulator(settings, model);
             break;
         default:
             throw std::runtime_error("Unable to initialize runner: simulator set in driver file not recognized.");
     }
-    simulator_->SetVerbosityLevel(runtime_settings_->verbosity_level());
+    simulator->SetVerbosityLevel(runtime_settings_->verbosity_level());
+    return simulator;
 }
 
 void AbstractRunner::EvaluateBaseModel()
@@ -144,18 +191,26 @@ void AbstractRunner::InitializeObjectiveFunction()
     if (simulator_ == 0 || settings_ == 0)
         throw std::runtime_error("The Simulator and the Settings must be initialized before the Objective Function.");
 
+    objective_function_ = createObjectiveFunction(simulator_, model_);
+}
+
+Optimization::Objective::Objective *AbstractRunner::createObjectiveFunction(Simulation::Simulator *simulator,
+                                                                            Model::Model *model) const
+{
+    Optimization::Objective::Objective *objective;
     switch (settings_->optimizer()->objective().type) {
         case Settings::Optimizer::ObjectiveType::WeightedSum:
             if (VERB_RUN >=1) Printer::ext_info("Using WeightedSum-type objective function.", "Runner", "AbstractRunner");
-            objective_function_ = new Optimization::Objective::WeightedSum(settings_->optimizer(), simulator_->results(), model_);
+            objective = new Optimization::Objective::WeightedSum(settings_->optimizer(), simulator->results(), model);
             break;
         case Settings::Optimizer::ObjectiveType::NPV:
             if (VERB_RUN >=1) Printer::ext_info("Using NPV-type objective function.", "Runner", "AbstractRunner");
-            objective_function_ = new Optimization::Objective::NPV(settings_->optimizer(), simulator_->results(), model_);
+            objective = new Optimization::Objective::NPV(settings_->optimizer(), simulator->results(), model);
             break;
         default:
             throw std::runtime_error("Unable to initialize runner: objective function type not recognized.");
     }
+    return objective;
 }
 
 void AbstractRunner::InitializeBaseCase()
@@ -171,6 +226,7 @@ void AbstractRunner::InitializeBaseCase()
         base_case_->set_objective_function_value(sentinelValue());
     }
     else{
+        Utilities::Trace::Span span("objective");
         model_->wellCost(settings_->optimizer());
         base_case_->set_objective_function_value(objective_function_->value());
     }
@@ -287,6 +343,14 @@ void AbstractRunner::InitializeOptimizer()
             throw std::runtime_error("Unable to initialize runner: optimization algorithm set in driver file not recognized.");
     }
     optimizer_->EnableConstraintLogging(QString::fromStdString(runtime_settings_->paths().GetPath(Paths::OUTPUT_DIR)));
+
+    if (runtime_settings_->timeout_quantile() > 0) {
+        if (VERB_RUN >= 1) Printer::ext_info("Predicting simulation runtimes; longest predicted cases are dispatched first.", "Runner", "AbstractRunner");
+        runtime_predictor_ = new RuntimePredictor(runtime_settings_->timeout_quantile());
+        optimizer_->SetDispatchPriority([this](Optimization::Case *c) {
+          return runtime_predictor_->IsTrained() ? runtime_predictor_->Predict(c) : 0.0;
+        });
+    }
 }
 
 void AbstractRunner::InitializeBookkeeper()
@@ -341,6 +405,76 @@ int AbstractRunner::timeoutValue() const {
     }
 }
 
+int AbstractRunner::timeoutValue(const Optimization::Case *c) const {
+    if (c->GetSimTimeout() > 0)
+        return c->GetSimTimeout();
+    return timeoutValue();
+}
+
+void AbstractRunner::setTerminationTarget(Optimization::Case *c) const {
+    if (early_termination_ && c->GetFidelity() == Optimization::Case::FID_HIGH) {
+        c->SetTerminationTarget(optimizer_->GetTentativeBestCase()->objective_function_value());
+    }
+}
+
+void AbstractRunner::setPredictedTimeout(Optimization::Case *c) const {
+    if (runtime_predictor_ != nullptr && runtime_predictor_->IsTrained()
+        && c->GetFidelity() == Optimization::Case::FID_HIGH) {
+        c->SetSimTimeout((int)std::ceil(runtime_predictor_->PredictQuantile(c)));
+    }
+}
+
+void AbstractRunner::recordRuntime(Optimization::Case *c) const {
+    if (runtime_predictor_ == nullptr || c->GetFidelity() != Optimization::Case::FID_HIGH)
+        return;
+    if (c->state.eval == Optimization::Case::CaseState::EvalStatus::E_DONE) {
+        runtime_predictor_->AddObservation(c, c->GetSimTime());
+    }
+    else if (c->state.eval == Optimization::Case::CaseState::EvalStatus::E_TIMEOUT && c->GetSimTimeout() > 0) {
+        if (VERB_RUN >= 2) Printer::ext_info("Simulation stopped by its predicted timeout of "
+                                                 + Printer::num2str(c->GetSimTimeout()) + " s.", "Runner", "AbstractRunner");
+        runtime_predictor_->AddTimeout(c, c->GetSimTimeout());
+    }
+}
+
+void AbstractRunner::beginMonitoring(Optimization::Case *c) {
+    monitored_case_ = c;
+    early_terminated_ = false;
+    last_monitor_check_ = QDateTime::currentDateTime();
+    if (early_termination_ && c->HasTerminationTarget()) {
+        model_->wellCost(settings_->optimizer()); // Include the well costs for this case in the bound
+    }
+}
+
+bool AbstractRunner::earlyTerminationCheck() {
+    if (early_terminated_ || monitored_case_ == nullptr || !monitored_case_->HasTerminationTarget()) {
+        return early_terminated_;
+    }
+    auto settings = settings_->simulator()->early_termination();
+    if (time_since_seconds(last_monitor_check_) < settings.check_interval) {
+        return false;
+    }
+    last_monitor_check_ = QDateTime::currentDateTime();
+    if (!simulator_->ReadPartialResults()) {
+        return false;
+    }
+    double bound = std::numeric_limits<double>::infinity();
+    if (simulator_->results()->GetValueVector(Simulation::Results::Results::Time).size() >= settings.min_report_steps) {
+        bound = objective_function_->OptimisticValue(schedule_end_time_, settings.rate_cap_factor);
+    }
+    simulator_->results()->DumpResults();
+    if (bound < monitored_case_->GetTerminationTarget()) {
+        early_terminated_ = true;
+        early_termination_bound_ = bound;
+        if (VERB_RUN >= 2) {
+            Printer::ext_info("Terminating simulation: optimistic objective value " + Printer::num2str(bound)
+                                  + " can not beat " + Printer::num2str(monitored_case_->GetTerminationTarget()) + ".",
+                              "Runner", "AbstractRunner");
+        }
+    }
+    return early_terminated_;
+}
+
 void AbstractRunner::FinalizeInitialization(bool write_logs) {
     if (write_logs) {
         logger_->AddEntry(runtime_settings_);
@@ -349,7 +483,13 @@ void AbstractRunner::FinalizeInitialization(bool write_logs) {
 }
 
 void AbstractRunner::FinalizeRun(bool write_logs) {
+    if (runtime_predictor_ != nullptr && write_logs)
+        logger_->AddSummarySection("Runtime prediction", runtime_predictor_->SummaryTable());
     if (optimizer_ != 0) { // This indicates whether or not we're on a worker process
+        if (is_multi_fidelity_run_) { // The last simulation may have been on the low-fidelity deck
+            model_->set_grid_path(settings_->simulator()->high_fidelity().grid());
+            simulator_->SetRealization(settings_->simulator()->high_fidelity());
+        }
         model_->ApplyCase(optimizer_->GetTentativeBestCase());
         simulator_->WriteDriverFilesOnly();
         PrintCompletionMessage();
@@ -357,6 +497,7 @@ void AbstractRunner::FinalizeRun(bool write_logs) {
     model_->Finalize();
     if (write_logs)
         logger_->FinalizePostrunSummary();
+    logger_->FinalizeTiming();
 }
 
 }
@@ -35,6 +35,7 @@
 #include "Settings/settings.h"
 #include "bookkeeper.h"
 #include "Runner/logger.h"
+#include "Runner/runtime_predictor.h"
 #include "ensemble_helper.h"
 #include <vector>
 #include "Optimization/objective/NPV.h"
@@ -79,6 +80,59 @@ class AbstractRunner
   std::vector<int> simulation_times_;
   bool is_ensemble_run_;
   EnsembleHelper ensemble_helper_;
+  bool is_multi_fidelity_run_; //!< Whether cases may be tagged for evaluation on the low-fidelity deck.
+
+  /*!
+   * @brief Get the deck a case should be simulated on in a multi-fidelity run, i.e. the
+   * low- or high-fidelity deck depending on the fidelity the case is tagged with.
+   */
+  const Settings::Ensemble::Realization &fidelityDeck(const Optimization::Case *c) const;
+
+  bool early_termination_; //!< Whether simulations are monitored and terminated once they cannot beat the tentative best case.
+  double schedule_end_time_; //!< The last control time (days), i.e. the time the simulations end at.
+  Optimization::Case *monitored_case_; //!< The case currently being simulated on this process.
+  QDateTime last_monitor_check_; //!< The last time the summary of the running simulation was read.
+  bool early_terminated_; //!< Whether the simulation of monitored_case_ was terminated early.
+  double early_termination_bound_; //!< The optimistic objective value of monitored_case_ when it was terminated.
+
+  /*!
+   * @brief Set the value a case must be able to beat for its simulation to be completed,
+   * i.e. the objective function value of the tentative best case. Only done when early
+   * termination is enabled, and only for (high-fidelity) cases compared with it directly.
+   */
+  void setTerminationTarget(Optimization::Case *c) const;
+
+  RuntimePredictor *runtime_predictor_; //!< Predicts simulation runtimes from the case variables. Null unless a timeout quantile is given.
+
+  /*!
+   * @brief Set the timeout for the simulation of a case to the timeout quantile of its
+   * predicted runtime. Only done once the runtime predictor has been trained, and only
+   * for high-fidelity cases, as the predictor is trained on high-fidelity runtimes.
+   */
+  void setPredictedTimeout(Optimization::Case *c) const;
+
+  /*!
+   * @brief Add the runtime of an evaluated (high-fidelity) case to the runtime predictor.
+   * Cases stopped by their predicted timeout are added with the timeout as their runtime.
+   */
+  void recordRuntime(Optimization::Case *c) const;
+
+  /*!
+   * @brief Start monitoring the simulation of a case. Should be called after the case has
+   * been applied to the model and before it is simulated.
+   */
+  void beginMonitoring(Optimization::Case *c);
+
+  /*!
+   * @brief Check whether the simulation of the monitored case should be terminated because
+   * it cannot beat its termination target. Polled by the simulator while it runs (see
+   * Simulation::Simulator::SetCancellationCheck).
+   *
+   * The summary written so far is read every CheckInterval seconds and the objective's
+   * optimistic bound is compared with the target. When this returns true, early_terminated_
+   * and early_termination_bound_ are set.
+   */
+  bool earlyTerminationCheck();
 
   void PrintCompletionMessage() const;
 
@@ -101,6 +155,12 @@ class AbstractRunner
    */
   int timeoutValue() const;
 
+  /*!
+   * @brief Get the timeout value to be used when simulating a specific case: the predicted
+   * timeout set on the case (see setPredictedTimeout) if there is one; otherwise timeoutValue().
+   */
+  int timeoutValue(const Optimization::Case *c) const;
+
   void InitializeSettings(QString output_subdirectory="");
   void InitializeModel();
   void InitializeSimulator();
@@ -109,6 +169,19 @@ class AbstractRunner
   void InitializeBaseCase();
   void InitializeOptimizer();
   void InitializeBookkeeper();
+
+  /*!
+   * @brief Create a simulator of the type set in the driver file, working in the output
+   * directory of the given settings on the given model. Used by InitializeSimulator.
+   */
+  Simulation::Simulator *createSimulator(Settings::Settings *settings, Model::Model *model) const;
+
+  /*!
+   * @brief Create an objective function of the type set in the driver file, reading the
+   * results of the given simulator. Used by InitializeObjectiveFunction.
+   */
+  Optimization::Objective::Objective *createObjectiveFunction(Simulation::Simulator *simulator,
+                                                              Model::Model *model) const;
   void FinalizeInitialization(bool write_logs); //!< Write the pre-run summary
   void FinalizeRun(bool write_logs); //!< Finalize the run, writing data to the summary log.
 
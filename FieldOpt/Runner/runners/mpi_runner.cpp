@@ -8,6 +8,7 @@
 #include <iostream>
 #include "Utilities/verbosity.h"
 #include "Utilities/printer.hpp"
+#include "Utilities/trace.hpp"
 
 BOOST_IS_MPI_DATATYPE(boost::uuids::uuid)
 
@@ -16,10 +17,12 @@ namespace MPI {
 
 MPIRunner::MPIRunner(RuntimeSettings *rts) : AbstractRunner(rts) {
     rank_ = world_.rank();
+    Utilities::Trace::Tracer::Instance().SetProcessId(rank_);
     simulator_delay_ = rts->simulation_delay();
 }
 
 void MPIRunner::SendMessage(Message &message) {
+    Utilities::Trace::Span span("mpi.send");
     std::string s;
     if (message.c != nullptr) {
         auto cto = Optimization::CaseTransferObject(message.c);
@@ -42,11 +45,14 @@ void MPIRunner::RecvMessage(Message &message) {
     printMessage("Waiting to receive a message with tag " + boost::lexical_cast<std::string>(message.tag)
                      + " (" + tag_to_string[message.tag] + ") "
                      + " from source " + boost::lexical_cast<std::string>(message.source), 2);
+    Utilities::Trace::Span wait_span("mpi.recv_wait");
     mpi::status status = world_.recv(message.source, ANY_TAG, s);
+    wait_span.End();
     message.set_status(status);
     message.tag = status.tag();
 
     auto handle_received_case = [&]() mutable {
+      Utilities::Trace::Span span("mpi.recv_unpack");
       std::istringstream iss(s);
       boost::archive::text_iarchive ia(iss);
       ia >> cto;
@@ -77,6 +83,19 @@ void MPIRunner::RecvMessage(Message &message) {
     }
     else if (message.tag == CASE_EVAL_TIMEOUT) {
         printMessage("Received a case that was terminated due to timeout.", 2);
+        handle_received_case();
+    }
+    else if (message.tag == CASE_EVAL_CANCELLED) {
+        printMessage("Received a case whose simulation was cancelled.", 2);
+        handle_received_case();
+    }
+    else if (message.tag == CASE_EVAL_TERMINATED) {
+        printMessage("Received a case whose simulation was terminated early.", 2);
+        handle_received_case();
+    }
+    else if (message.tag == CANCEL_CASE) {
+        printMessage("Received a case cancellation.", 2); // Carries only the case id; see Worker::CancellationRequested
+        message.c = nullptr;
     }
     else {
         printMessage("Received message with an unrecognized tag. Throwing exception.");
@@ -37,13 +37,21 @@ class MPIRunner : public AbstractRunner {
    * CASE_EVAL_SUCCESS: To be used when sending successfully evaluated cases.
    * CASE_EVAL_INVALID: To be used when sending cases that were some some reason deemed invalid.
    * CASE_EVAL_TIMEOUT: To be used when sending cases whose simulation was terminated by a timeout condition.
+   * CASE_EVAL_CANCELLED: To be used when sending cases whose simulation was cancelled by the overseer.
+   * CASE_EVAL_TERMINATED: To be used when sending cases whose simulation was terminated early because they
+   *  could not beat the tentative best case.
+   * CANCEL_CASE: To be sent by the overseer to cancel the simulation of a case on a worker. The message
+   *  contains only the id of the case.
    * MODEL_SYNC: To be used when sending model synchronization objects.
+   * WORKER_SLOTS: To be sent by each worker after the model synchronization, with the number of
+   *  cases it can evaluate concurrently.
    * ANY_TAG: This will match any tag.
    * TERMINATE: This tag should be sent by the overseer to terminate a worker.
    */
   enum MsgTag : int {
     CASE_UNEVAL = 1, CASE_EVAL_SUCCESS = 2, CASE_EVAL_INVALID = 3, CASE_EVAL_TIMEOUT = 4,
-    MODEL_SYNC = 10, TERMINATE = 100,
+    CASE_EVAL_CANCELLED = 5, CANCEL_CASE = 6, CASE_EVAL_TERMINATED = 7,
+    MODEL_SYNC = 10, WORKER_SLOTS = 11, TERMINATE = 100,
     ANY_TAG = MPI_ANY_TAG
   };
 
@@ -53,7 +61,11 @@ class MPIRunner : public AbstractRunner {
       {2, "successfully evaluated case"},
       {3, "invalid case"},
       {4, "timed out case"},
+      {5, "cancelled case"},
+      {6, "case cancellation"},
+      {7, "early terminated case"},
       {10, "model synchronization object"},
+      {11, "worker slot count"},
       {100, "termination signal"}
   };
 
@@ -73,7 +85,11 @@ class MPIRunner : public AbstractRunner {
             case 2: return CASE_EVAL_SUCCESS;
             case 3: return CASE_EVAL_INVALID;
             case 4: return CASE_EVAL_TIMEOUT;
+            case 5: return CASE_EVAL_CANCELLED;
+            case 6: return CANCEL_CASE;
+            case 7: return CASE_EVAL_TERMINATED;
             case 10: return MODEL_SYNC;
+            case 11: return WORKER_SLOTS;
             case 100: return TERMINATE;
         }
     }
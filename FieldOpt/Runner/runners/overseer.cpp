@@ -27,19 +27,31 @@ Overseer::Overseer(MPIRunner *runner) {
     runner_ = runner;
     runner_->BroadcastModel();
 
+    std::vector<int> ranks;
     for (int i = 1; i < runner->world_.size(); ++i) {
         workers_.insert(i, new WorkerStatus(i));
+        ranks.push_back(i);
+    }
+    metrics_ = new OverseerMetrics(ranks, QString::fromStdString(
+        runner_->runtime_settings_->paths().GetPath(Paths::OUTPUT_DIR) + "/metrics_overseer.json"));
+    for (int i : ranks) {
+        int slots;
+        runner_->world_.recv(i, MPIRunner::MsgTag::WORKER_SLOTS, slots);
+        workers_[i]->slots = std::max(1, slots);
+        metrics_->SetSlots(i, workers_[i]->slots);
+        runner_->printMessage("Worker " + boost::lexical_cast<std::string>(i) + " has "
+                                  + boost::lexical_cast<std::string>(workers_[i]->slots) + " slot(s).", 2);
     }
     runner_->printMessage("Initialized overseer.");
     last_sim_start_ = current_time();
 }
 
 void Overseer::AssignCase(Optimization::Case *c, int preferred_worker) {
-    if (NumberOfFreeWorkers() == 0) throw std::runtime_error("Cannot assign Case. No free workers found.");
+    if (NumberOfFreeSlots() == 0) throw std::runtime_error("Cannot assign Case. No free workers found.");
     WorkerStatus *worker;
     if (preferred_worker > 0) {
         worker = workers_[preferred_worker];
-        assert(worker->working == false);
+        assert(worker->free_slots() > 0);
     }
     else {
         worker = getFreeWorker();
@@ -53,7 +65,8 @@ void Overseer::AssignCase(Optimization::Case *c, int preferred_worker) {
     msg.destination = worker->rank;
     msg.c = c;
     runner_->SendMessage(msg);
-    worker->start();
+    worker->start(c->id());
+    metrics_->WorkerStarted(worker->rank);
     last_sim_start_ = current_time();
     c->state.eval = Optimization::Case::CaseState::EvalStatus::E_CURRENT;
     runner_->printMessage("Assigned case to worker " + boost::lexical_cast<std::string>(worker->rank), 2);
@@ -62,8 +75,11 @@ void Overseer::AssignCase(Optimization::Case *c, int preferred_worker) {
 
 Optimization::Case *Overseer::RecvEvaluatedCase() {
     auto message = MPIRunner::Message();
+    metrics_->BeginWait();
     runner_->RecvMessage(message);
-    workers_[message.source]->stop();
+    metrics_->EndWait();
+    if (message.c != nullptr) workers_[message.source]->stop(message.c->id());
+    metrics_->WorkerStopped(message.source);
     runner_->printMessage("Received case with tag " + boost::lexical_cast<std::string>(message.tag)
                               + " from worker " + boost::lexical_cast<std::string>(message.source), 2);
     runner_->printMessage("Current status for workers:\n" + workerStatusSummary(), 2);
@@ -72,27 +88,29 @@ Optimization::Case *Overseer::RecvEvaluatedCase() {
 }
 
 Overseer::WorkerStatus * Overseer::getFreeWorker() {
-    if (NumberOfFreeWorkers() == 0) throw std::runtime_error("No free workers in network.");
+    if (NumberOfFreeSlots() == 0) throw std::runtime_error("No free workers in network.");
+    WorkerStatus *free_worker = nullptr;
     for (int i = 1; i < runner_->world_.size(); ++i) {
-        if (workers_[i]->working == false) return workers_[i];
+        if (free_worker == nullptr || workers_[i]->free_slots() > free_worker->free_slots())
+            free_worker = workers_[i];
     }
+    return free_worker;
 }
 
-int Overseer::NumberOfFreeWorkers() {
+int Overseer::NumberOfFreeSlots() {
     int f = 0;
     for (int i = 1; i < runner_->world_.size(); ++i) {
-        if (workers_[i]->working == false)
-            f++;
+        f += std::max(0, workers_[i]->free_slots());
     }
     return f;
 }
 
 Overseer::WorkerStatus * Overseer::GetLongestRunningWorker() {
-    if (NumberOfFreeWorkers() == runner_->world_.size()-1) return nullptr;
+    if (NumberOfBusyWorkers() == 0) return nullptr;
     int longest_running_time = -1;
     int longest_running_worker;
     for (int i = 1; i < runner_->world_.size(); ++i) {
-        if (workers_[i]->working_seconds() > longest_running_time) {
+        if (workers_[i]->working() && workers_[i]->working_seconds() > longest_running_time) {
             longest_running_time = workers_[i]->working_seconds();
             longest_running_worker = workers_[i]->rank;
         }
@@ -109,6 +127,17 @@ void Overseer::TerminateWorkers() {
     }
 }
 
+bool Overseer::CancelCase(const QUuid &id) {
+    for (auto worker : workers_.values()) {
+        if (worker->running.contains(id)) {
+            runner_->world_.send(worker->rank, MPIRunner::MsgTag::CANCEL_CASE, id.toString().toStdString());
+            runner_->printMessage("Sent case cancellation to worker " + boost::lexical_cast<std::string>(worker->rank), 2);
+            return true;
+        }
+    }
+    return false;
+}
+
 void Overseer::EnsureWorkerTermination() {
     for (int i = 1; i < runner_->world_.size(); ++i) {
         auto msg = MPIRunner::Message();
@@ -121,13 +150,17 @@ void Overseer::EnsureWorkerTermination() {
 }
 
 int Overseer::NumberOfBusyWorkers() {
-    return workers_.count() - NumberOfFreeWorkers();
+    int b = 0;
+    for (auto worker : workers_.values()) {
+        if (worker->working()) b++;
+    }
+    return b;
 }
 
 std::vector<int> Overseer::GetFreeWorkerRanks() const {
     std::vector<int> free_workers;
     for (int i = 1; i < runner_->world_.size(); ++i) {
-        if (workers_[i]->working == false)
+        if (workers_[i]->free_slots() > 0)
             free_workers.push_back(workers_[i]->rank);
     }
     return free_workers;
@@ -136,9 +169,11 @@ std::vector<int> Overseer::GetFreeWorkerRanks() const {
 std::string Overseer::workerStatusSummary() {
     QString status = "";
     for (auto stat : workers_.values()) {
-        if (stat->working)
-            status.append(QString("\tWorker %1: working. Duration of current task: %2 sec\n")
+        if (stat->working())
+            status.append(QString("\tWorker %1: working on %2/%3 slots. Duration of longest task: %4 sec\n")
                               .arg(stat->rank)
+                              .arg(stat->running.size())
+                              .arg(stat->slots)
                               .arg(stat->working_seconds())
             );
         else
@@ -20,7 +20,9 @@
 #define FIELDOPT_OVERSEER_H
 
 #include "mpi_runner.h"
+#include "overseer_metrics.h"
 #include "Utilities/time.hpp"
+#include <algorithm>
 #include <chrono>
 
 namespace Runner {
@@ -28,13 +30,16 @@ namespace MPI {
 /*!
  * @brief The Overseer class takes care of distributing cases between workers. The runner taken as an
  * is primarily used for the common MPI helpers.
+ *
+ * Each worker reports how many cases it can evaluate concurrently (its slots) after the model has
+ * been broadcast; cases are assigned as long as any worker has a free slot.
  */
 class Overseer {
  public:
   Overseer(MPIRunner *runner);
 
   /*!
-   * @brief Assign a Case to a Worker. If no workers are free, the scheduler will wait untill one is.
+   * @brief Assign a Case to a Worker with a free slot, preferring the worker with the most free slots.
    * @param c The case to be assigned to a Worker for evaluation.
    * @param preferred_worker Prefer to assign the case to the worker with this rank (default: no preference)
    */
@@ -46,6 +51,15 @@ class Overseer {
    */
   Optimization::Case *RecvEvaluatedCase();
 
+  /*!
+   * @brief Ask the worker evaluating a case to cancel its simulation. The worker will send the
+   * case back with the CASE_EVAL_CANCELLED tag (or with its normal tag, if the simulation
+   * finished before the request arrived).
+   * @param id The id of the case to cancel.
+   * @return True if a worker was evaluating the case and the request was sent; otherwise false.
+   */
+  bool CancelCase(const QUuid &id);
+
   /*!
    * @brief Wait for a message with the TERMINATE tag from each of the workers to confirm termination
    * before moving on to finalization.
@@ -58,17 +72,17 @@ class Overseer {
   void TerminateWorkers();
 
   /*!
-   * @brief Get the number of workers that are currently not performing any work.
+   * @brief Get the number of slots, summed over all workers, that are currently not performing any work.
    */
-  int NumberOfFreeWorkers();
+  int NumberOfFreeSlots();
 
   /*!
-   * @brief Get the number of workers that are currently executing simulations.
+   * @brief Get the number of workers that are currently executing at least one simulation.
    */
   int NumberOfBusyWorkers();
 
   /*!
-   * @brief Get the ranks of all free workers.
+   * @brief Get the ranks of all workers with at least one free slot.
    */
   std::vector<int> GetFreeWorkerRanks() const;
 
@@ -79,25 +93,29 @@ class Overseer {
     WorkerStatus() { rank = -1; }
     WorkerStatus(int r) { rank = r;}
     int rank; //!< The rank of the process the worker is running on.
-    bool working = false; //!< Indicates if the worker is currently performing simulations.
-    QDateTime working_since; //!< The last time a job was sent to the worker.
-    int working_seconds() { //!< Number of seconds since last work was sent to the process.
-        return time_since_seconds(working_since);
+    int slots = 1; //!< The number of cases the worker can evaluate concurrently.
+    QHash<QUuid, QDateTime> running; //!< The ids of the cases the worker is evaluating, with the time they were sent.
+    bool working() const { return !running.isEmpty(); } //!< Indicates if the worker is performing simulations.
+    int free_slots() const { return slots - running.size(); }
+    int working_seconds() const { //!< Number of seconds since the oldest running case was sent to the process.
+        if (running.isEmpty()) return 0;
+        QDateTime oldest = running.values().first();
+        for (auto since : running.values()) oldest = std::min(oldest, since);
+        return time_since_seconds(oldest);
     }
     /*!
-     * @brief Start the worker. Should be called whenever work is sent to the worker. This marks is as
-     * working.
+     * @brief Start a case on the worker. Should be called whenever work is sent to the worker. This
+     * occupies one of its slots.
      */
-    void start() {
-        working = true;
-        working_since = QDateTime::currentDateTime();
+    void start(const QUuid &case_id) {
+        running.insert(case_id, QDateTime::currentDateTime());
     }
     /*!
-     * @brief Stop the worker. This should be called whenever results are received from the worker. This
-     * marks the worker as not working.
+     * @brief Stop a case on the worker. This should be called whenever results are received from the
+     * worker. This frees the slot the case occupied.
      */
-    void stop() {
-        working = false;
+    void stop(const QUuid &case_id) {
+        running.remove(case_id);
     }
   };
 
@@ -109,11 +127,17 @@ class Overseer {
 
   MPIRunner::MsgTag last_case_tag; //!< The message tag for the last received case.
 
+  /*!
+   * @brief Get the utilization metrics for the workers and the overseer.
+   */
+  OverseerMetrics *metrics() { return metrics_; }
+
  private:
   MPIRunner *runner_;
   QHash<int, WorkerStatus*> workers_; //!< A map of the workers. The key is the rank of the process.
+  OverseerMetrics *metrics_;
 
-  WorkerStatus * getFreeWorker(); //!< Get a worker not marked as working.
+  WorkerStatus * getFreeWorker(); //!< Get the worker with the most free slots.
 
   /*!
    * @brief Get a string summarizing the status for all workers.
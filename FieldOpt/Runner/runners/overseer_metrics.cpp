@@ -0,0 +1,203 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include "overseer_metrics.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace Runner {
+namespace MPI {
+
+OverseerMetrics::OverseerMetrics(const std::vector<int> &ranks, const QString &output_path, int write_interval) {
+    output_path_ = output_path;
+    write_interval_ = write_interval;
+    for (int rank : ranks) {
+        workers_[rank] = WorkerMetrics();
+    }
+    start_ = Clock::now();
+    last_event_ = start_;
+    last_write_ = start_;
+}
+
+void OverseerMetrics::SetSlots(int rank, int slots) {
+    advance();
+    workers_[rank].slots = std::max(1, slots);
+}
+
+void OverseerMetrics::WorkerStarted(int rank) {
+    advance();
+    workers_[rank].busy_slots++;
+    workers_[rank].cases++;
+}
+
+void OverseerMetrics::WorkerStopped(int rank) {
+    advance();
+    workers_[rank].busy_slots = std::max(0, workers_[rank].busy_slots - 1);
+}
+
+void OverseerMetrics::SetQueueDepth(int depth) {
+    advance();
+    queue_depth_ = depth;
+    max_queue_depth_ = std::max(max_queue_depth_, depth);
+}
+
+void OverseerMetrics::BeginWait() {
+    advance();
+    waiting_ = true;
+}
+
+void OverseerMetrics::EndWait() {
+    advance();
+    waiting_ = false;
+}
+
+void OverseerMetrics::RecordBookkeeperLookup(bool hit) {
+    bookkeeper_lookups_++;
+    if (hit) bookkeeper_hits_++;
+}
+
+double OverseerMetrics::mean_queue_depth() const {
+    return elapsed_seconds_ > 0 ? queue_depth_integral_ / elapsed_seconds_ : 0.0;
+}
+
+double OverseerMetrics::bookkeeper_hit_rate() const {
+    return bookkeeper_lookups_ > 0 ? (double)bookkeeper_hits_ / bookkeeper_lookups_ : 0.0;
+}
+
+void OverseerMetrics::advance() {
+    auto now = Clock::now();
+    double dt = std::chrono::duration<double>(now - last_event_).count();
+    last_event_ = now;
+    elapsed_seconds_ += dt;
+    if (waiting_) wait_seconds_ += dt;
+    queue_depth_integral_ += queue_depth_ * dt;
+    for (auto &item : workers_) {
+        int idle_slots = std::max(0, item.second.slots - item.second.busy_slots);
+        item.second.busy_seconds += dt * item.second.busy_slots;
+        item.second.idle_seconds += dt * idle_slots;
+        if (queue_depth_ == 0) item.second.barrier_idle_seconds += dt * idle_slots;
+    }
+    if (!output_path_.isEmpty() && std::chrono::duration<double>(now - last_write_).count() >= write_interval_) {
+        Write();
+    }
+}
+
+double OverseerMetrics::utilization(const WorkerMetrics &w) const {
+    return elapsed_seconds_ > 0 ? w.busy_seconds / (elapsed_seconds_ * w.slots) : 0.0;
+}
+
+int OverseerMetrics::busyWorkers() const {
+    int busy = 0;
+    for (auto &item : workers_) {
+        if (item.second.busy_slots > 0) busy++;
+    }
+    return busy;
+}
+
+void OverseerMetrics::Write() {
+    last_write_ = Clock::now();
+    samples_.push_back(Sample{elapsed_seconds_, queue_depth_, busyWorkers()});
+    if (output_path_.isEmpty()) return;
+
+    QJsonObject json;
+    json.insert("ElapsedSeconds", elapsed_seconds_);
+
+    QJsonArray workers;
+    for (auto &item : workers_) {
+        QJsonObject worker;
+        worker.insert("Rank", item.first);
+        worker.insert("Slots", item.second.slots);
+        worker.insert("BusySeconds", item.second.busy_seconds);
+        worker.insert("IdleSeconds", item.second.idle_seconds);
+        worker.insert("BarrierIdleSeconds", item.second.barrier_idle_seconds);
+        worker.insert("Utilization", utilization(item.second));
+        worker.insert("Cases", item.second.cases);
+        workers.append(worker);
+    }
+    json.insert("Workers", workers);
+
+    QJsonObject queue;
+    queue.insert("Current", queue_depth_);
+    queue.insert("Max", max_queue_depth_);
+    queue.insert("Mean", mean_queue_depth());
+    json.insert("QueueDepth", queue);
+
+    QJsonObject bookkeeper;
+    bookkeeper.insert("Lookups", bookkeeper_lookups_);
+    bookkeeper.insert("Hits", bookkeeper_hits_);
+    bookkeeper.insert("HitRate", bookkeeper_hit_rate());
+    json.insert("Bookkeeper", bookkeeper);
+
+    QJsonObject overseer;
+    overseer.insert("WorkSeconds", work_seconds());
+    overseer.insert("WaitSeconds", wait_seconds_);
+    json.insert("Overseer", overseer);
+
+    QJsonArray samples;
+    for (auto &sample : samples_) {
+        samples.append(QJsonArray({sample.time, sample.queue_depth, sample.busy_workers}));
+    }
+    json.insert("SampleColumns", QJsonArray({"ElapsedSeconds", "QueueDepth", "BusyWorkers"}));
+    json.insert("Samples", samples);
+
+    QFile file(output_path_);
+    file.open(QFile::WriteOnly | QFile::Truncate);
+    file.write(QJsonDocument(json).toJson(QJsonDocument::Indented));
+    file.close();
+}
+
+std::string OverseerMetrics::SummaryTable() {
+    advance();
+    double busy = 0, idle = 0, barrier_idle = 0;
+    std::stringstream sum;
+    sum << std::fixed << std::setprecision(1);
+    sum << "| Worker | Slots | Cases    | Busy [s]   | Idle [s]   | Barrier idle [s] | Utilization |\n";
+    sum << "| ------ | ----- | -------- | ---------- | ---------- | ---------------- | ----------- |\n";
+    for (auto &item : workers_) {
+        const WorkerMetrics &w = item.second;
+        busy += w.busy_seconds;
+        idle += w.idle_seconds;
+        barrier_idle += w.barrier_idle_seconds;
+        sum << "| " << std::setw(6) << item.first << " | " << std::setw(5) << w.slots << " | " << std::setw(8) << w.cases
+            << " | " << std::setw(10) << w.busy_seconds << " | " << std::setw(10) << w.idle_seconds
+            << " | " << std::setw(16) << w.barrier_idle_seconds
+            << " | " << std::setw(10) << 100.0 * utilization(w) << "% |\n";
+    }
+    sum << "\n";
+    sum << "| Metric                         | Value           |\n";
+    sum << "| ------------------------------ | --------------- |\n";
+    sum << "| Elapsed [s]                    | " << std::setw(15) << elapsed_seconds_ << " |\n";
+    sum << "| Total utilization              | " << std::setw(14)
+        << (busy + idle > 0 ? 100.0 * busy / (busy + idle) : 0.0) << "% |\n";
+    sum << "| Idle on optimizer barrier      | " << std::setw(14)
+        << (idle > 0 ? 100.0 * barrier_idle / idle : 0.0) << "% |\n";
+    sum << "| Mean queue depth               | " << std::setw(15) << mean_queue_depth() << " |\n";
+    sum << "| Max queue depth                | " << std::setw(15) << max_queue_depth_ << " |\n";
+    sum << "| Bookkeeper hit rate            | " << std::setw(14) << 100.0 * bookkeeper_hit_rate() << "% |\n";
+    sum << "| Overseer work [s]              | " << std::setw(15) << work_seconds() << " |\n";
+    sum << "| Overseer waiting [s]           | " << std::setw(15) << wait_seconds_ << " |\n";
+    return sum.str();
+}
+
+}
+}
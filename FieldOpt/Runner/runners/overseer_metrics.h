@@ -0,0 +1,135 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef FIELDOPT_OVERSEER_METRICS_H
+#define FIELDOPT_OVERSEER_METRICS_H
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <QString>
+
+namespace Runner {
+namespace MPI {
+
+/*!
+ * @brief The OverseerMetrics class records how the workers and the overseer spend their time.
+ *
+ * The time between two events is attributed to the state everything was in before the
+ * later one: busy or idle for each worker, waiting for a message or working for the
+ * overseer. Idle time while the optimizer has no queued cases is counted separately as
+ * barrier idle time, as it is caused by the optimizer waiting for a batch to finish
+ * rather than by the overseer. Workers evaluating several cases concurrently have their
+ * time counted per slot, i.e. in slot-seconds.
+ *
+ * The metrics are written as JSON to the output path at most every write_interval
+ * seconds, with one sample of the queue depth and number of busy workers per write.
+ */
+class OverseerMetrics {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  OverseerMetrics(const std::vector<int> &ranks, const QString &output_path, int write_interval=10);
+
+  struct WorkerMetrics {
+    double busy_seconds = 0;
+    double idle_seconds = 0;
+    double barrier_idle_seconds = 0; //!< Part of the idle time where the optimizer had no queued cases.
+    int cases = 0; //!< Number of cases assigned to the worker.
+    int slots = 1; //!< Number of cases the worker can evaluate concurrently.
+    int busy_slots = 0; //!< Number of cases the worker is currently evaluating.
+  };
+
+  /*!
+   * @brief Set the number of cases a worker can evaluate concurrently (default: 1).
+   */
+  void SetSlots(int rank, int slots);
+
+  void WorkerStarted(int rank);
+  void WorkerStopped(int rank);
+
+  /*!
+   * @brief Set the number of cases waiting for a worker. When it is zero, idle
+   * workers are counted as waiting on an optimizer barrier.
+   */
+  void SetQueueDepth(int depth);
+
+  /*!
+   * @brief Mark the start and end of the overseer blocking while waiting for a worker.
+   */
+  void BeginWait();
+  void EndWait();
+
+  void RecordBookkeeperLookup(bool hit);
+
+  /*!
+   * @brief Write the metrics to the output path.
+   */
+  void Write();
+
+  /*!
+   * @brief Get a markdown summary of the metrics.
+   */
+  std::string SummaryTable();
+
+  const std::map<int, WorkerMetrics> &workers() const { return workers_; }
+  double elapsed_seconds() const { return elapsed_seconds_; }
+  double wait_seconds() const { return wait_seconds_; }
+  double work_seconds() const { return elapsed_seconds_ - wait_seconds_; }
+  int max_queue_depth() const { return max_queue_depth_; }
+  double mean_queue_depth() const;
+  double bookkeeper_hit_rate() const;
+
+ private:
+  QString output_path_;
+  int write_interval_;
+  Clock::time_point start_;
+  Clock::time_point last_event_;
+  Clock::time_point last_write_;
+
+  std::map<int, WorkerMetrics> workers_;
+  double elapsed_seconds_ = 0;
+  double wait_seconds_ = 0;
+  bool waiting_ = false;
+  int queue_depth_ = 0;
+  int max_queue_depth_ = 0;
+  double queue_depth_integral_ = 0; //!< Queue depth integrated over time, for the time-weighted mean.
+  int bookkeeper_lookups_ = 0;
+  int bookkeeper_hits_ = 0;
+
+  struct Sample {
+    double time;
+    int queue_depth;
+    int busy_workers;
+  };
+  std::vector<Sample> samples_;
+
+  /*!
+   * @brief Attribute the time since the last event to the current states, and write
+   * the metrics if the write interval has passed.
+   */
+  void advance();
+  int busyWorkers() const;
+  double utilization(const WorkerMetrics &w) const; //!< Busy fraction of the worker's slot-time.
+};
+
+}
+}
+
+#endif //FIELDOPT_OVERSEER_METRICS_H
@@ -19,7 +19,9 @@
 #include <Utilities/time.hpp>
 #include "serial_runner.h"
 #include "Utilities/printer.hpp"
+#include "Utilities/trace.hpp"
 #include "Model/model.h"
+#include <limits>
 
 namespace Runner {
 
@@ -35,6 +37,9 @@ SerialRunner::SerialRunner(Runner::RuntimeSettings *runtime_settings)
     InitializeBaseCase();
     InitializeOptimizer();
     InitializeBookkeeper();
+    if (early_termination_) {
+        simulator_->SetCancellationCheck([this]() { return earlyTerminationCheck(); });
+    }
     FinalizeInitialization(true);
 }
 
@@ -64,26 +69,47 @@ void SerialRunner::Execute()
             try {
                 bool simulation_success = true;
                 new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_CURRENT;
+                if (is_multi_fidelity_run_) {
+                    model_->set_grid_path(fidelityDeck(new_case).grid());
+                }
                 if (VERB_RUN >= 3) Printer::ext_info("Applying case to model.", "Runner", "Serial Runner");
                 model_->ApplyCase(new_case);
+                if (!is_ensemble_run_) setTerminationTarget(new_case);
+                setPredictedTimeout(new_case);
+                beginMonitoring(new_case);
                 auto start = QDateTime::currentDateTime();
-                if (!is_ensemble_run_ && (simulation_times_.size() == 0 || runtime_settings_->simulation_timeout() == 0)) {
+                if (is_multi_fidelity_run_) {
+                    if (VERB_RUN >= 3) Printer::ext_info("Simulating case on the deck for its fidelity.", "Runner", "Serial Runner");
+                    simulation_success = simulator_->Evaluate(
+                        fidelityDeck(new_case),
+                        timeoutValue(new_case),
+                        runtime_settings_->threads_per_sim()
+                    );
+                }
+                else if (!is_ensemble_run_ && new_case->GetSimTimeout() == 0
+                    && (simulation_times_.size() == 0 || runtime_settings_->simulation_timeout() == 0)) {
                     if (VERB_RUN >= 3) Printer::ext_info("Simulating case.", "Runner", "Serial Runner");
-                    simulator_->Evaluate();
+                    if (early_termination_) { // Monitored, but without a timeout
+                        simulation_success = simulator_->Evaluate(std::numeric_limits<int>::max(),
+                                                                  runtime_settings_->threads_per_sim());
+                    }
+                    else {
+                        simulator_->Evaluate();
+                    }
                 }
                 else {
                     if (is_ensemble_run_) {
                         if (VERB_RUN >= 3) Printer::ext_info("Simulating ensemble case.", "Runner", "Serial Runner");
                         simulation_success = simulator_->Evaluate(
                             ensemble_helper_.GetRealization(new_case->GetEnsembleRealization().toStdString()),
-                            timeoutValue(),
+                            timeoutValue(new_case),
                             runtime_settings_->threads_per_sim()
                         );
                     }
                     else {
                         if (VERB_RUN >= 3) Printer::ext_info("Simulating case.", "Runner", "Serial Runner");
                         simulation_success = simulator_->Evaluate(
-                            timeoutValue(),
+                            timeoutValue(new_case),
                             runtime_settings_->threads_per_sim()
                         );
                     }
@@ -92,17 +118,26 @@ void SerialRunner::Execute()
                 auto end = QDateTime::currentDateTime();
                 int sim_time = time_span_seconds(start, end);
                 if (simulation_success) {
+                    Utilities::Trace::Span objective_span("objective");
                     model_->wellCost(settings_->optimizer());
                     new_case->set_objective_function_value(objective_function_->value());
+                    objective_span.End();
                     new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_DONE;
                     new_case->SetSimTime(sim_time);
-                    simulation_times_.push_back((sim_time));
+                    if (new_case->GetFidelity() == Optimization::Case::FID_HIGH)
+                        simulation_times_.push_back((sim_time));
+                }
+                else if (early_terminated_) {
+                    if (VERB_RUN >= 3) Printer::ext_info("Simulation terminated early.", "Runner", "Serial Runner");
+                    new_case->set_objective_function_value(early_termination_bound_);
+                    new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_TERMINATED;
+                    new_case->SetSimTime(sim_time);
                 }
                 else {
                     new_case->set_objective_function_value(sentinelValue());
                     new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_FAILED;
                     new_case->state.err_msg = Optimization::Case::CaseState::ErrorMessage::ERR_SIM;
-                    if (sim_time >= timeoutValue())
+                    if (sim_time >= timeoutValue(new_case))
                         new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_TIMEOUT;
                 }
             } catch (std::runtime_error e) {
@@ -111,6 +146,7 @@ void SerialRunner::Execute()
                 new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_FAILED;
                 new_case->state.err_msg = Optimization::Case::CaseState::ErrorMessage::ERR_WIC;
             }
+            recordRuntime(new_case);
         }
         if (is_ensemble_run_) {
             ensemble_helper_.SubmitEvaluatedRealization(new_case);
@@ -17,6 +17,13 @@
    along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 ******************************************************************************/
 #include "synchronous_mpi_runner.h"
+#include "Model/model_synchronization_object.h"
+#include "Utilities/printer.hpp"
+#include "Utilities/trace.hpp"
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 namespace Runner {
 namespace MPI {
@@ -44,13 +51,44 @@ SynchronousMPIRunner::SynchronousMPIRunner(RuntimeSettings *rts) : MPIRunner(rts
         InitializeModel();
         InitializeSimulator();
         InitializeObjectiveFunction();
-        worker_ = new MPI::Worker(this);
+        bool single_slot_run = is_ensemble_run_ || is_multi_fidelity_run_ || early_termination_;
+        int slots = runtime_settings_->slots_per_worker();
+        if (slots == 0) {
+            slots = single_slot_run ? 1 : std::max(1, (int)std::thread::hardware_concurrency()
+                / std::max(1, runtime_settings_->threads_per_sim()));
+        }
+        else if (slots > 1 && single_slot_run) {
+            throw std::runtime_error("Several simulation slots per worker cannot be used with ensembles, "
+                                     "multi-fidelity optimization or early termination.");
+        }
+        int cores = std::thread::hardware_concurrency(); // 0 if unknown
+        if (cores > 0 && slots * runtime_settings_->threads_per_sim() > cores) {
+            Printer::ext_warn("Running " + Printer::num2str(slots) + " simulations with "
+                                  + Printer::num2str(runtime_settings_->threads_per_sim())
+                                  + " threads each exceeds the number of cores on the worker.",
+                              "Runner", "SynchronousMPIRunner");
+        }
+        worker_ = new MPI::Worker(this, slots);
+        if (slots > 1) initializeSlots(slots);
+        bool opportunistic = settings_->optimizer()->parameters().opportunistic_polling;
+        if (slots == 1 && (opportunistic || early_termination_)) {
+            simulator_->SetCancellationCheck([this, opportunistic]() {
+              return (opportunistic && worker_->CancellationRequested()) || earlyTerminationCheck();
+            });
+        }
         FinalizeInitialization(false);
     }
 }
 
 void SynchronousMPIRunner::Execute() {
 
+    auto cancel_obsolete_cases = [&]() mutable {
+      for (auto id : optimizer_->GetCasesToCancel()) {
+          if (overseer_->CancelCase(id))
+              printMessage("Requested cancellation of obsolete case.", 2);
+      }
+    };
+
     auto handle_new_case = [&]() mutable {
       Optimization::Case *new_case;
       if (ensemble_helper_.IsCaseAvailableForEval()) {
@@ -65,17 +103,25 @@ void SynchronousMPIRunner::Execute() {
               new_case = ensemble_helper_.GetCaseForEval();
           }
       }
-      if (!is_ensemble_run_ && bookkeeper_->IsEvaluated(new_case, true)) {
+      bool bookkeeped = !is_ensemble_run_ && bookkeeper_->IsEvaluated(new_case, true);
+      if (!is_ensemble_run_) {
+          overseer_->metrics()->RecordBookkeeperLookup(bookkeeped);
+      }
+      if (bookkeeped) {
           printMessage("Case found in bookkeeper");
           new_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_BOOKKEEPED;
           optimizer_->SubmitEvaluatedCase(new_case);
+          cancel_obsolete_cases();
       }
       else {
           if (is_ensemble_run_) {
               int worker_rank = ensemble_helper_.GetAssignedWorker(new_case->GetEnsembleRealization().toStdString(), overseer_->GetFreeWorkerRanks());
+              setPredictedTimeout(new_case);
               overseer_->AssignCase(new_case, worker_rank);
           }
           else {
+              setTerminationTarget(new_case);
+              setPredictedTimeout(new_case);
               overseer_->AssignCase(new_case);
           }
           printMessage("New case assigned to worker.", 2);
@@ -90,11 +136,13 @@ void SynchronousMPIRunner::Execute() {
           printMessage("Setting state for evaluated case.", 2);
           evaluated_case->state.eval = Optimization::Case::CaseState::EvalStatus::E_DONE;
           printMessage("Setting timings for evaluated case.", 2);
-          if (!is_ensemble_run_ && optimizer_->GetSimulationDuration(evaluated_case) > 0){
+          if (!is_ensemble_run_ && evaluated_case->GetFidelity() == Optimization::Case::FID_HIGH
+              && optimizer_->GetSimulationDuration(evaluated_case) > 0){
               printMessage("Setting timings for evaluated case.", 2);
               simulation_times_.push_back(optimizer_->GetSimulationDuration(evaluated_case));
           }
       }
+      recordRuntime(evaluated_case);
       if (is_ensemble_run_) {
           printMessage("Submitting evaluated realization to ensemble helper.", 2);
           ensemble_helper_.SubmitEvaluatedRealization(evaluated_case);
@@ -110,6 +158,7 @@ void SynchronousMPIRunner::Execute() {
       else {
           optimizer_->SubmitEvaluatedCase(evaluated_case);
           printMessage("Submitted evaluated case to optimizer.", 2);
+          cancel_obsolete_cases();
       }
     };
 
@@ -118,12 +167,15 @@ void SynchronousMPIRunner::Execute() {
         initialDistribution();
         printMessage("Initial distribution done.", 2);
         while (optimizer_->IsFinished() == false) {
+            int queue_depth = optimizer_->nr_queued_cases();
             if (is_ensemble_run_) {
                 printMessage(ensemble_helper_.GetStateString(), 2);
+                if (ensemble_helper_.IsCaseAvailableForEval()) queue_depth++;
             }
+            overseer_->metrics()->SetQueueDepth(queue_depth);
             if (is_ensemble_run_ && ensemble_helper_.IsCaseAvailableForEval()) {
                 printMessage("Queued realization cases available.", 2);
-                if (overseer_->NumberOfFreeWorkers() > 0) { // Free workers available
+                if (overseer_->NumberOfFreeSlots() > 0) { // Free workers available
                     printMessage("Free workers available. Handling next case.", 2);
                     handle_new_case();
                 }
@@ -138,7 +190,7 @@ void SynchronousMPIRunner::Execute() {
             }
             else if (optimizer_->nr_queued_cases() > 0) { // Queued cases in optimizer
                 printMessage("Queued cases available.", 2);
-                if (overseer_->NumberOfFreeWorkers() > 0) { // Free workers available
+                if (overseer_->NumberOfFreeSlots() > 0) { // Free workers available
                     printMessage("Free workers available. Handling next case.", 2);
                     handle_new_case();
                 }
@@ -159,6 +211,8 @@ void SynchronousMPIRunner::Execute() {
                 }
             }
         }
+        logger_->AddSummarySection("Workers", overseer_->metrics()->SummaryTable());
+        overseer_->metrics()->Write();
         FinalizeRun(true);
         overseer_->TerminateWorkers();
         printMessage("Terminating workers.", 2);
@@ -167,6 +221,15 @@ void SynchronousMPIRunner::Execute() {
         return;
     }
 
+    else if (slots_.size() > 1) { // Worker running several simulations concurrently
+        executeSlots();
+        FinalizeRun(false);
+        printMessage("Finalized on worker.", 2);
+        worker_->ConfirmFinalization();
+        env_.~environment();
+        return;
+    }
+
     else { // Worker
         printMessage("Waiting to receive initial unevaluated case...", 2);
         worker_->RecvUnevaluatedCase();
@@ -182,13 +245,44 @@ void SynchronousMPIRunner::Execute() {
                     printMessage("Updating grid path.", 2);
                     model_->set_grid_path(ensemble_helper_.GetRealization(worker_->GetCurrentCase()->GetEnsembleRealization().toStdString()).grid());
                 }
+                else if (is_multi_fidelity_run_) {
+                    printMessage("Updating grid path for case fidelity.", 2);
+                    model_->set_grid_path(fidelityDeck(worker_->GetCurrentCase()).grid());
+                }
                 printMessage("Applying case to model.", 2);
                 model_->ApplyCase(worker_->GetCurrentCase());
+                beginMonitoring(worker_->GetCurrentCase());
                 model_update_done_ = true; logger_->AddEntry(this);
                 auto start = QDateTime::currentDateTime();
-                if (runtime_settings_->simulation_timeout() == 0 && settings_->simulator()->max_minutes() < 0) {
+                if (is_multi_fidelity_run_) {
+                    printMessage("Starting model evaluation on the deck for the case fidelity.", 2);
+                    int timeout = simulation_times_.size() == 0 && settings_->simulator()->max_minutes() > 0
+                                  && worker_->GetCurrentCase()->GetSimTimeout() == 0
+                                  ? settings_->simulator()->max_minutes() * 60 : timeoutValue(worker_->GetCurrentCase());
+                    simulation_success = simulator_->Evaluate(fidelityDeck(worker_->GetCurrentCase()),
+                                                              timeout, runtime_settings_->threads_per_sim());
+                }
+                else if (worker_->GetCurrentCase()->GetSimTimeout() > 0) {
+                    int timeout = worker_->GetCurrentCase()->GetSimTimeout();
+                    if (!is_ensemble_run_) {
+                        printMessage("Starting model evaluation with predicted timeout.", 2);
+                        simulation_success = simulator_->Evaluate(timeout, runtime_settings_->threads_per_sim());
+                    }
+                    else {
+                        printMessage("Starting ensemble model evaluation with predicted timeout.", 2);
+                        simulation_success = simulator_->Evaluate(ensemble_helper_.GetRealization(worker_->GetCurrentCase()->GetEnsembleRealization().toStdString()),
+                                                                  timeout, runtime_settings_->threads_per_sim());
+                    }
+                }
+                else if (runtime_settings_->simulation_timeout() == 0 && settings_->simulator()->max_minutes() < 0) {
                     printMessage("Starting model evaluation.", 2);
-                    simulator_->Evaluate();
+                    if (early_termination_) { // Monitored, but without a timeout
+                        simulation_success = simulator_->Evaluate(std::numeric_limits<int>::max(),
+                                                                  runtime_settings_->threads_per_sim());
+                    }
+                    else {
+                        simulator_->Evaluate();
+                    }
                 }
                 else if (simulation_times_.size() == 0 && settings_->simulator()->max_minutes() > 0) {
                     if (!is_ensemble_run_) {
@@ -221,11 +315,28 @@ void SynchronousMPIRunner::Execute() {
                 if (simulation_success) {
                     tag = MPIRunner::MsgTag::CASE_EVAL_SUCCESS;
                     printMessage("Setting objective function value.", 2);
+                    Utilities::Trace::Span objective_span("objective");
                     model_->wellCost(settings_->optimizer());
                     worker_->GetCurrentCase()->set_objective_function_value(objective_function_->value());
+                    objective_span.End();
                     worker_->GetCurrentCase()->SetSimTime(sim_time);
                     worker_->GetCurrentCase()->state.eval = Optimization::Case::CaseState::EvalStatus::E_DONE;
-                    simulation_times_.push_back(sim_time);
+                    if (worker_->GetCurrentCase()->GetFidelity() == Optimization::Case::FID_HIGH)
+                        simulation_times_.push_back(sim_time);
+                }
+                else if (early_terminated_) {
+                    tag = MPIRunner::MsgTag::CASE_EVAL_TERMINATED;
+                    printMessage("Simulation terminated early. Setting objective function value to its optimistic bound.", 2);
+                    worker_->GetCurrentCase()->set_objective_function_value(early_termination_bound_);
+                    worker_->GetCurrentCase()->SetSimTime(sim_time);
+                    worker_->GetCurrentCase()->state.eval = Optimization::Case::CaseState::EvalStatus::E_TERMINATED;
+                }
+                else if (worker_->CancellationRequested()) {
+                    tag = MPIRunner::MsgTag::CASE_EVAL_CANCELLED;
+                    printMessage("Simulation cancelled by overseer.", 2);
+                    worker_->GetCurrentCase()->SetSimTime(sim_time);
+                    worker_->GetCurrentCase()->state.eval = Optimization::Case::CaseState::EvalStatus::E_CANCELLED;
+                    worker_->GetCurrentCase()->set_objective_function_value(sentinelValue());
                 }
                 else {
                     tag = MPIRunner::MsgTag::CASE_EVAL_TIMEOUT;
@@ -265,19 +376,149 @@ void SynchronousMPIRunner::Execute() {
 void SynchronousMPIRunner::initialDistribution() {
 
     if (!is_ensemble_run_) { // Single-realization run
-        while (optimizer_->nr_queued_cases() > 0 && overseer_->NumberOfFreeWorkers() > 1) { // Leave one free worker
+        while (optimizer_->nr_queued_cases() > 0 && overseer_->NumberOfFreeSlots() > 1) { // Leave one free slot
             overseer_->AssignCase(optimizer_->GetCaseForEvaluation());
         }
     }
     else { // Ensemble run
         auto next_case = optimizer_->GetCaseForEvaluation();
         ensemble_helper_.SetActiveCase(next_case);
-        while (ensemble_helper_.IsCaseAvailableForEval() && overseer_->NumberOfFreeWorkers() > 1) {
+        while (ensemble_helper_.IsCaseAvailableForEval() && overseer_->NumberOfFreeSlots() > 1) {
             overseer_->AssignCase(ensemble_helper_.GetCaseForEval());
         }
 
     }
 }
+
+void SynchronousMPIRunner::initializeSlots(int slots) {
+    for (int k = 0; k < slots; ++k) {
+        auto slot = new Slot();
+        if (k == 0) {
+            slot->model = model_;
+            slot->simulator = simulator_;
+            slot->objective = objective_function_;
+        }
+        else { // Separate output directory for the simulator, on a model sharing the grid
+            QString slot_dir = "slot" + QString::number(k);
+            auto slot_logger = new Logger(runtime_settings_, slot_dir, false);
+            Paths slot_paths = runtime_settings_->paths();
+            slot_paths.SetPath(Paths::OUTPUT_DIR, runtime_settings_->paths().GetPath(Paths::OUTPUT_DIR)
+                + "/" + slot_dir.toStdString() + "/");
+            auto slot_settings = new Settings::Settings(slot_paths);
+            slot_settings->set_verbosity(runtime_settings_->verbosity_level());
+            slot->model = new Model::Model(*slot_settings, slot_logger, model_);
+            Model::ModelSynchronizationObject(model_).UpdateVariablePropertyIds(slot->model);
+            slot->simulator = createSimulator(slot_settings, slot->model);
+            slot->objective = createObjectiveFunction(slot->simulator, slot->model);
+        }
+        slot->simulator->SetCancellationCheck([slot]() { return slot->cancelled.load(); });
+        slots_.push_back(slot);
+    }
+    printMessage("Initialized " + boost::lexical_cast<std::string>(slots) + " simulation slots.", 2);
+}
+
+void SynchronousMPIRunner::executeSlots() {
+    while (true) {
+        for (auto slot : slots_) {
+            if (slot->c != nullptr && slot->done) {
+                slot->thread.join();
+                if (slot->tag == MPIRunner::MsgTag::CASE_EVAL_SUCCESS
+                    && slot->c->GetFidelity() == Optimization::Case::FID_HIGH)
+                    simulation_times_.push_back(slot->c->GetSimTime());
+                printMessage("Sending back evaluated case.", 2);
+                worker_->SendEvaluatedCase(slot->c, slot->tag);
+                slot->c = nullptr; // Not deleted: the slot model keeps a pointer to the last applied case
+            }
+        }
+        if (!worker_->MessageWaiting()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            continue;
+        }
+        Optimization::Case *c;
+        QUuid cancel_id;
+        auto tag = worker_->RecvSlotMessage(c, cancel_id);
+        if (tag == MPIRunner::MsgTag::CASE_UNEVAL) {
+            Slot *free_slot = nullptr;
+            for (auto slot : slots_) {
+                if (slot->c == nullptr) { free_slot = slot; break; }
+            }
+            if (free_slot == nullptr)
+                throw std::runtime_error("Received a case on a worker with no free simulation slots.");
+            free_slot->c = c;
+            free_slot->timeout = slotTimeout(c);
+            free_slot->cancelled = false;
+            free_slot->done = false;
+            free_slot->thread = std::thread(&SynchronousMPIRunner::evaluateInSlot, this, free_slot);
+            printMessage("Received an unevaluated case.", 2);
+        }
+        else if (tag == MPIRunner::MsgTag::CANCEL_CASE) {
+            for (auto slot : slots_) {
+                if (slot->c != nullptr && slot->c->id() == cancel_id)
+                    slot->cancelled = true;
+            }
+        }
+        else if (tag == MPIRunner::MsgTag::TERMINATE) {
+            printMessage("Received termination message. Breaking.", 2);
+            for (auto slot : slots_) {
+                if (slot->c != nullptr) {
+                    slot->cancelled = true;
+                    slot->thread.join();
+                    slot->c = nullptr;
+                }
+            }
+            break;
+        }
+    }
+}
+
+void SynchronousMPIRunner::evaluateInSlot(Slot *slot) {
+    auto c = slot->c;
+    try {
+        slot->model->ApplyCase(c);
+        auto start = QDateTime::currentDateTime();
+        bool simulation_success = slot->simulator->Evaluate(slot->timeout, runtime_settings_->threads_per_sim());
+        int sim_time = time_span_seconds(start, QDateTime::currentDateTime());
+        if (simulation_success) {
+            slot->tag = MPIRunner::MsgTag::CASE_EVAL_SUCCESS;
+            Utilities::Trace::Span objective_span("objective");
+            slot->model->wellCost(settings_->optimizer());
+            c->set_objective_function_value(slot->objective->value());
+            objective_span.End();
+            c->SetSimTime(sim_time);
+            c->state.eval = Optimization::Case::CaseState::EvalStatus::E_DONE;
+        }
+        else if (slot->cancelled) {
+            slot->tag = MPIRunner::MsgTag::CASE_EVAL_CANCELLED;
+            c->SetSimTime(sim_time);
+            c->state.eval = Optimization::Case::CaseState::EvalStatus::E_CANCELLED;
+            c->set_objective_function_value(sentinelValue());
+        }
+        else {
+            slot->tag = MPIRunner::MsgTag::CASE_EVAL_TIMEOUT;
+            c->state.eval = Optimization::Case::CaseState::EvalStatus::E_TIMEOUT;
+            c->state.err_msg = Optimization::Case::CaseState::ErrorMessage::ERR_SIM;
+            c->set_objective_function_value(sentinelValue());
+        }
+    } catch (std::runtime_error &e) {
+        std::cout << e.what() << std::endl;
+        slot->tag = MPIRunner::MsgTag::CASE_EVAL_INVALID;
+        c->state.eval = Optimization::Case::CaseState::EvalStatus::E_FAILED;
+        c->state.err_msg = Optimization::Case::CaseState::ErrorMessage::ERR_WIC;
+        c->set_objective_function_value(sentinelValue());
+    }
+    slot->done = true;
+}
+
+int SynchronousMPIRunner::slotTimeout(Optimization::Case *c) const {
+    if (c->GetSimTimeout() > 0)
+        return c->GetSimTimeout();
+    if (runtime_settings_->simulation_timeout() == 0 && settings_->simulator()->max_minutes() < 0)
+        return std::numeric_limits<int>::max();
+    if (simulation_times_.size() == 0 && settings_->simulator()->max_minutes() > 0)
+        return settings_->simulator()->max_minutes() * 60;
+    return timeoutValue();
+}
+
 Loggable::LogTarget SynchronousMPIRunner::GetLogTarget() {
     return STATE_RUNNER;
 }
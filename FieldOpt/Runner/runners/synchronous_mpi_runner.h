@@ -22,6 +22,9 @@
 #include "mpi_runner.h"
 #include "overseer.h"
 #include "worker.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace Runner {
 namespace MPI {
@@ -31,6 +34,10 @@ namespace MPI {
  * on the process rank, it will instantiate either an Overseer (rank = 0) to handle optimizer iteraction
  * and logging, or a Worker (rank > 0) to execute simulations.
  *
+ * A worker may run several simulations concurrently (see RuntimeSettings::slots_per_worker). Each
+ * slot then has its own model, simulator, objective function and output directory, while the grid
+ * and well index calculator are loaded once and shared by the models of all slots.
+ *
  * Still todo:
  *   - Probably some more logging and console debug messages
  *   - Logging of runner stats
@@ -52,10 +59,47 @@ class SynchronousMPIRunner : public MPIRunner, public Loggable {
   bool simulation_done_;
 
   /*!
-   * @brief Distribute cases to be evaluated to all but one worker.
+   * @brief Distribute cases to be evaluated to all but one worker slot.
    */
   void initialDistribution();
 
+  /*!
+   * @brief A simulation slot on a worker. The case is evaluated in a separate thread.
+   */
+  struct Slot {
+    Model::Model *model;
+    Simulation::Simulator *simulator;
+    Optimization::Objective::Objective *objective;
+    Optimization::Case *c = nullptr; //!< The case being evaluated. Null when the slot is free.
+    int timeout = 0; //!< Timeout for the simulation of c in seconds.
+    std::thread thread;
+    std::atomic<bool> cancelled{false}; //!< Set when the overseer cancels c.
+    std::atomic<bool> done{false}; //!< Set by the thread when the evaluation of c is finished.
+    MPIRunner::MsgTag tag = MPIRunner::MsgTag::CASE_EVAL_SUCCESS; //!< Tag to send c back with.
+  };
+  std::vector<Slot *> slots_; //!< Only used when the worker has more than one slot.
+
+  /*!
+   * @brief Create the simulation slots for a worker. The first slot uses the runner's own model,
+   * simulator and objective function; the others get their own, sharing the runner model's grid.
+   */
+  void initializeSlots(int slots);
+
+  /*!
+   * @brief The worker loop when running several simulations concurrently: start received cases in
+   * free slots, forward cancellations to the slots and send cases back as their evaluations finish.
+   */
+  void executeSlots();
+
+  /*!
+   * @brief Evaluate the case in a slot. Runs in the slot's thread.
+   */
+  void evaluateInSlot(Slot *slot);
+
+  /*!
+   * @brief Get the simulation timeout for a case evaluated in a slot, chosen as for a single-slot worker.
+   */
+  int slotTimeout(Optimization::Case *c) const;
 
 };
 
@@ -22,9 +22,13 @@
 namespace Runner {
 namespace MPI {
 
-Worker::Worker(MPIRunner *runner) {
+Worker::Worker(MPIRunner *runner, int slots) {
     runner_ = runner;
+    current_case_ = nullptr;
+    cancelled_ = false;
+    slots_ = slots;
     runner_->RecvModelSynchronizationObject();
+    runner_->world().send(runner_->scheduler_rank_, MPIRunner::MsgTag::WORKER_SLOTS, slots_);
     std::cout << "Initialized Worker on " << runner_->world().rank() << std::endl;
 }
 
@@ -33,6 +37,13 @@ void Worker::RecvUnevaluatedCase() {
     msg.source = runner_->scheduler_rank_;
     msg.tag = MPIRunner::MsgTag::CASE_UNEVAL;
     runner_->RecvMessage(msg);
+    while (msg.get_tag() == MPIRunner::MsgTag::CANCEL_CASE) { // Cancellation arrived after the case was sent back
+        msg = MPIRunner::Message();
+        msg.source = runner_->scheduler_rank_;
+        msg.tag = MPIRunner::MsgTag::CASE_UNEVAL;
+        runner_->RecvMessage(msg);
+    }
+    cancelled_ = false;
     current_tag_ = msg.get_tag();
     if (msg.get_tag() != MPIRunner::MsgTag::TERMINATE)
         current_case_ = msg.c;
@@ -45,10 +56,51 @@ void Worker::SendEvaluatedCase(MPIRunner::MsgTag tag) {
     auto msg = MPIRunner::Message();
     msg.destination = runner_->scheduler_rank_;
     msg.c = current_case_;
-    msg.tag = MPIRunner::MsgTag::CASE_EVAL_SUCCESS;
+    msg.tag = tag;
     runner_->SendMessage(msg);
 }
 
+void Worker::SendEvaluatedCase(Optimization::Case *c, MPIRunner::MsgTag tag) {
+    auto msg = MPIRunner::Message();
+    msg.destination = runner_->scheduler_rank_;
+    msg.c = c;
+    msg.tag = tag;
+    runner_->SendMessage(msg);
+}
+
+bool Worker::MessageWaiting() {
+    return (bool)runner_->world().iprobe(runner_->scheduler_rank_, MPIRunner::MsgTag::ANY_TAG);
+}
+
+MPIRunner::MsgTag Worker::RecvSlotMessage(Optimization::Case *&c, QUuid &cancel_id) {
+    c = nullptr;
+    auto status = runner_->world().probe(runner_->scheduler_rank_, MPIRunner::MsgTag::ANY_TAG);
+    if (status.tag() == MPIRunner::MsgTag::CANCEL_CASE) { // Sent as a raw id; see Overseer::CancelCase
+        std::string id;
+        runner_->world().recv(runner_->scheduler_rank_, MPIRunner::MsgTag::CANCEL_CASE, id);
+        cancel_id = QUuid(QString::fromStdString(id));
+        return MPIRunner::MsgTag::CANCEL_CASE;
+    }
+    auto msg = MPIRunner::Message();
+    msg.source = runner_->scheduler_rank_;
+    runner_->RecvMessage(msg);
+    if (msg.get_tag() == MPIRunner::MsgTag::CASE_UNEVAL)
+        c = msg.c;
+    return msg.get_tag();
+}
+
+bool Worker::CancellationRequested() {
+    if (cancelled_ || current_case_ == nullptr)
+        return cancelled_;
+    while (runner_->world().iprobe(runner_->scheduler_rank_, MPIRunner::MsgTag::CANCEL_CASE)) {
+        std::string id;
+        runner_->world().recv(runner_->scheduler_rank_, MPIRunner::MsgTag::CANCEL_CASE, id);
+        if (QUuid(QString::fromStdString(id)) == current_case_->id())
+            cancelled_ = true;
+    }
+    return cancelled_;
+}
+
 void Worker::ConfirmFinalization() {
     auto msg = MPIRunner::Message();
     msg.destination = runner_->scheduler_rank_;
@@ -27,10 +27,19 @@ namespace MPI {
 /*!
  * @brief The Worker class is responsible for receiving and sending from/to an overseer object.
  * The runner taken as a parameter in the constructor is primarily used for the common MPI helpers.
+ *
+ * A worker with more than one slot evaluates several cases concurrently. It then receives and
+ * sends cases with RecvSlotMessage and the SendEvaluatedCase overload taking a case, instead
+ * of going through current_case_.
  */
 class Worker {
  public:
-  Worker(MPIRunner *runner);
+  /*!
+   * @param runner The runner used for the MPI helpers.
+   * @param slots The number of cases this worker evaluates concurrently. This is sent to the
+   * overseer after the model synchronization.
+   */
+  Worker(MPIRunner *runner, int slots=1);
 
   /*!
    * @brief Receive an unevaluated case from the Scheduler and set it as the current_case_.
@@ -43,6 +52,35 @@ class Worker {
    */
   void SendEvaluatedCase(MPIRunner::MsgTag tag);
 
+  /*!
+   * @brief Send an evaluated case back to the Scheduler.
+   * @param c The evaluated case.
+   * @param tag The tag the message should be sent with, indicating whether the evaluation was successful.
+   */
+  void SendEvaluatedCase(Optimization::Case *c, MPIRunner::MsgTag tag);
+
+  /*!
+   * @brief Check, without blocking, whether a message from the Scheduler is waiting.
+   */
+  bool MessageWaiting();
+
+  /*!
+   * @brief Receive the next message from the Scheduler in slot mode.
+   * @param c Set to the received case if the tag is CASE_UNEVAL; otherwise nullptr.
+   * @param cancel_id Set to the id of the case to cancel if the tag is CANCEL_CASE.
+   * @return The tag of the received message (CASE_UNEVAL, CANCEL_CASE or TERMINATE).
+   */
+  MPIRunner::MsgTag RecvSlotMessage(Optimization::Case *&c, QUuid &cancel_id);
+
+  /*!
+   * @brief Check, without blocking, whether the overseer has asked to cancel the
+   * evaluation of the current_case_. Cancellations of other cases are discarded.
+   *
+   * Once a cancellation for the current case has been received, this returns true
+   * until the next case is received.
+   */
+  bool CancellationRequested();
+
   /*!
    * @brief Send a message to the overseer confirming finalization.
    */
@@ -50,11 +88,14 @@ class Worker {
 
   Optimization::Case *GetCurrentCase();
   MPIRunner::MsgTag GetCurrentTag() { return current_tag_; }
+  int slots() const { return slots_; }
 
  private:
   MPIRunner *runner_;
   Optimization::Case *current_case_;
   MPIRunner::MsgTag current_tag_;
+  bool cancelled_; //!< Whether the evaluation of current_case_ has been cancelled.
+  int slots_; //!< Number of cases evaluated concurrently.
 };
 }
 }
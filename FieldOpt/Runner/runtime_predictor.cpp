@@ -0,0 +1,189 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include "runtime_predictor.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <Eigen/Dense>
+#include <boost/math/distributions/normal.hpp>
+
+namespace Runner {
+
+RuntimePredictor::RuntimePredictor(double quantile, int min_observations, int window) {
+    if (quantile <= 0.0 || quantile >= 1.0)
+        throw std::runtime_error("The runtime prediction quantile must be between 0 and 1.");
+    quantile_ = quantile;
+    z_ = boost::math::quantile(boost::math::normal(0.0, 1.0), quantile);
+    min_observations_ = std::max(2, min_observations);
+    window_ = std::max(min_observations_, window);
+    dirty_ = true;
+    intercept_ = 0;
+    residual_rms_ = 0;
+}
+
+void RuntimePredictor::AddObservation(Optimization::Case *c, double seconds) {
+    seconds = std::max(seconds, 1.0); // Runtimes are measured in whole seconds
+    if (IsTrained()) {
+        double log_prediction = predictLog(c);
+        double prediction = std::exp(log_prediction);
+        double error = std::log(seconds) - log_prediction;
+        accuracy_.predictions++;
+        accuracy_.abs_pct_error_sum += std::abs(prediction - seconds) / seconds;
+        accuracy_.log_sq_error_sum += error * error;
+        if (seconds <= std::exp(log_prediction + z_ * sigma())) accuracy_.covered++;
+        errors_.push_back(error);
+        if ((int)errors_.size() > window_) errors_.pop_front();
+    }
+    add(c, seconds);
+}
+
+void RuntimePredictor::AddTimeout(Optimization::Case *c, double timeout_seconds) {
+    accuracy_.timeouts++;
+    add(c, timeout_seconds);
+}
+
+double RuntimePredictor::Predict(Optimization::Case *c) {
+    if (!IsTrained())
+        throw std::runtime_error("The runtime predictor needs more observations before it can predict.");
+    return std::exp(predictLog(c));
+}
+
+double RuntimePredictor::PredictQuantile(Optimization::Case *c) {
+    if (!IsTrained())
+        throw std::runtime_error("The runtime predictor needs more observations before it can predict.");
+    return std::exp(predictLog(c) + z_ * sigma());
+}
+
+double RuntimePredictor::sigma() {
+    if ((int)errors_.size() >= min_errors_) {
+        double sum = 0;
+        for (double e : errors_) sum += e * e;
+        return std::max(0.05, std::sqrt(sum / errors_.size()));
+    }
+    if (dirty_) fit();
+    return std::max(prior_sigma_, residual_rms_);
+}
+
+double RuntimePredictor::Accuracy::log_rmse() const {
+    return predictions > 0 ? std::sqrt(log_sq_error_sum / predictions) : 0.0;
+}
+
+std::string RuntimePredictor::SummaryTable() {
+    std::stringstream sum;
+    sum << std::fixed << std::setprecision(2);
+    sum << "| Metric                         | Value           |\n";
+    sum << "| ------------------------------ | --------------- |\n";
+    sum << "| Observations                   | " << std::setw(15) << observations_.size() << " |\n";
+    sum << "| Predictions                    | " << std::setw(15) << accuracy_.predictions << " |\n";
+    sum << "| Mean abs. error                | " << std::setw(14) << accuracy_.mape() << "% |\n";
+    sum << "| RMSE of log runtime            | " << std::setw(15) << accuracy_.log_rmse() << " |\n";
+    sum << "| Timeout quantile               | " << std::setw(15) << quantile_ << " |\n";
+    sum << "| Within predicted timeout       | " << std::setw(14) << 100.0 * accuracy_.coverage() << "% |\n";
+    sum << "| Predicted timeouts             | " << std::setw(15) << accuracy_.timeouts << " |\n";
+    if (IsTrained())
+        sum << "| Sigma of log runtime           | " << std::setw(15) << sigma() << " |\n";
+    return sum.str();
+}
+
+Eigen::VectorXd RuntimePredictor::variableValues(Optimization::Case *c) {
+    if (variable_ids_.empty() && observations_.empty()) {
+        variable_ids_ = c->real_variables().keys() + c->integer_variables().keys() + c->binary_variables().keys();
+        std::sort(variable_ids_.begin(), variable_ids_.end());
+    }
+    Eigen::VectorXd x(variable_ids_.size());
+    for (int i = 0; i < variable_ids_.size(); ++i) {
+        QUuid id = variable_ids_[i];
+        if (c->real_variables().contains(id)) x(i) = c->real_variables()[id];
+        else if (c->integer_variables().contains(id)) x(i) = c->integer_variables()[id];
+        else if (c->binary_variables().contains(id)) x(i) = c->binary_variables()[id] ? 1.0 : 0.0;
+        else x(i) = 0.0;
+    }
+    return x;
+}
+
+Eigen::VectorXd RuntimePredictor::features(const Eigen::VectorXd &x, const QString &realization) const {
+    Eigen::VectorXd f = Eigen::VectorXd::Zero(x.size() + realizations_.size());
+    f.head(x.size()) = (x - mean_).cwiseQuotient(scale_);
+    auto column = realizations_.find(realization);
+    if (column != realizations_.end()) f(x.size() + column->second) = 1.0;
+    return f;
+}
+
+void RuntimePredictor::add(Optimization::Case *c, double seconds) {
+    Observation observation;
+    observation.x = variableValues(c);
+    observation.realization = c->GetEnsembleRealization();
+    observation.log_seconds = std::log(std::max(seconds, 1.0));
+    if (realizations_.count(observation.realization) == 0) {
+        int column = realizations_.size();
+        realizations_[observation.realization] = column;
+    }
+    observations_.push_back(observation);
+    if ((int)observations_.size() > window_) observations_.pop_front();
+    dirty_ = true;
+}
+
+void RuntimePredictor::fit() {
+    int n = observations_.size();
+    int d = variable_ids_.size();
+    mean_ = Eigen::VectorXd::Zero(d);
+    scale_ = Eigen::VectorXd::Ones(d);
+    intercept_ = 0;
+    for (auto &o : observations_) {
+        mean_ += o.x;
+        intercept_ += o.log_seconds;
+    }
+    mean_ /= n;
+    intercept_ /= n;
+    if (n > 1) {
+        Eigen::VectorXd var = Eigen::VectorXd::Zero(d);
+        for (auto &o : observations_) var += (o.x - mean_).cwiseAbs2();
+        for (int j = 0; j < d; ++j) {
+            double sd = std::sqrt(var(j) / (n - 1));
+            scale_(j) = sd > 1e-12 ? sd : 1.0;
+        }
+    }
+
+    int p = d + realizations_.size();
+    Eigen::MatrixXd Z(n, p);
+    Eigen::VectorXd y(n);
+    for (int i = 0; i < n; ++i) {
+        Z.row(i) = features(observations_[i].x, observations_[i].realization).transpose();
+        y(i) = observations_[i].log_seconds - intercept_;
+    }
+    // Solve in whichever of the primal (p x p) and dual (n x n) forms is smaller
+    if (p <= n) {
+        Eigen::MatrixXd A = Z.transpose() * Z + lambda_ * Eigen::MatrixXd::Identity(p, p);
+        weights_ = A.ldlt().solve(Z.transpose() * y);
+    } else {
+        Eigen::MatrixXd K = Z * Z.transpose() + lambda_ * Eigen::MatrixXd::Identity(n, n);
+        weights_ = Z.transpose() * K.ldlt().solve(y);
+    }
+    residual_rms_ = std::sqrt((y - Z * weights_).squaredNorm() / n);
+    dirty_ = false;
+}
+
+double RuntimePredictor::predictLog(Optimization::Case *c) {
+    if (dirty_) fit();
+    return intercept_ + weights_.dot(features(variableValues(c), c->GetEnsembleRealization()));
+}
+
+}
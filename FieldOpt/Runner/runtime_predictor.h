@@ -0,0 +1,150 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef FIELDOPT_RUNTIME_PREDICTOR_H
+#define FIELDOPT_RUNTIME_PREDICTOR_H
+
+#include <deque>
+#include <map>
+#include <string>
+#include <Eigen/Core>
+#include <QList>
+#include <QString>
+#include <QUuid>
+#include "Optimization/case.h"
+
+namespace Runner {
+
+/*!
+ * @brief The RuntimePredictor class predicts how long the simulation of a case will take,
+ * from the variable values and realization of the case.
+ *
+ * The model is a ridge regression of the log of the simulation time on the standardized
+ * variable values and a one-hot encoding of the realization, trained online on the last
+ * window observed runtimes. The log runtime is assumed to be normally distributed around
+ * the prediction, with a standard deviation estimated from the errors of the predictions
+ * made before each observation was added (i.e. out of sample). This gives a log-normal
+ * predictive distribution, from which quantiles are used as per-case timeouts.
+ *
+ * The accuracy of the predictions made before each observation is recorded and can be
+ * summarized with SummaryTable.
+ *
+ * Runtimes are measured by the runners in whole seconds (Case::GetSimTime), and timeouts
+ * are passed to the simulators in whole seconds, so the predictor has a resolution of 1 s.
+ * Observed runtimes are floored at 1 s: simulations finishing in under a second are added
+ * as 1 s runs rather than being dropped.
+ */
+class RuntimePredictor {
+ public:
+  /*!
+   * @param quantile Quantile of the predictive distribution returned by PredictQuantile.
+   * @param min_observations Number of observations needed before predictions are made.
+   * @param window Maximum number of (most recent) observations the model is fitted to.
+   */
+  RuntimePredictor(double quantile, int min_observations=8, int window=500);
+
+  /*!
+   * @brief Add the observed simulation time of a successfully simulated case. Times
+   * below 1 s are counted as 1 s.
+   */
+  void AddObservation(Optimization::Case *c, double seconds);
+
+  /*!
+   * @brief Record that the simulation of a case was stopped by its predicted timeout.
+   * The timeout is added as an observation, as it is a lower bound on the runtime;
+   * leaving such cases out would bias the model towards short runtimes.
+   */
+  void AddTimeout(Optimization::Case *c, double timeout_seconds);
+
+  /*!
+   * @brief Whether enough observations have been added for predictions to be made.
+   */
+  bool IsTrained() const { return (int)observations_.size() >= min_observations_; }
+
+  /*!
+   * @brief Get the predicted (median) simulation time for a case in seconds.
+   */
+  double Predict(Optimization::Case *c);
+
+  /*!
+   * @brief Get the quantile of the predicted simulation time for a case in seconds.
+   */
+  double PredictQuantile(Optimization::Case *c);
+
+  double quantile() const { return quantile_; }
+  double sigma(); //!< Standard deviation of the log runtime around the prediction.
+  int observations() const { return (int)observations_.size(); }
+
+  /*!
+   * @brief Accuracy of the predictions made before observations were added.
+   */
+  struct Accuracy {
+    int predictions = 0;
+    double abs_pct_error_sum = 0; //!< Sum of |predicted - observed| / observed.
+    double log_sq_error_sum = 0; //!< Sum of squared errors of the log runtime.
+    int covered = 0; //!< Number of observations not exceeding the predicted quantile.
+    int timeouts = 0; //!< Number of simulations stopped by the predicted timeout.
+    double mape() const { return predictions > 0 ? 100.0 * abs_pct_error_sum / predictions : 0.0; }
+    double log_rmse() const;
+    double coverage() const { return predictions > 0 ? (double)covered / predictions : 0.0; }
+  };
+  const Accuracy &accuracy() const { return accuracy_; }
+
+  /*!
+   * @brief Get a markdown summary of the prediction accuracy.
+   */
+  std::string SummaryTable();
+
+ private:
+  struct Observation {
+    Eigen::VectorXd x; //!< Variable values, ordered as the ids in variable_ids_.
+    QString realization;
+    double log_seconds;
+  };
+
+  double quantile_;
+  double z_; //!< Standard normal quantile corresponding to quantile_.
+  int min_observations_;
+  int window_;
+  const double lambda_ = 1.0; //!< Ridge regularization on the standardized variables.
+  const double prior_sigma_ = 0.5; //!< Sigma used until enough out-of-sample errors are available.
+  const int min_errors_ = 5; //!< Out-of-sample errors needed before they are used to estimate sigma.
+
+  QList<QUuid> variable_ids_; //!< Ids of the variables used as features, fixed by the first observation.
+  std::map<QString, int> realizations_; //!< One-hot column of each realization seen.
+  std::deque<Observation> observations_;
+  std::deque<double> errors_; //!< Recent out-of-sample errors of the log runtime.
+  Accuracy accuracy_;
+
+  bool dirty_; //!< Whether the model must be refitted before the next prediction.
+  double intercept_;
+  Eigen::VectorXd mean_;
+  Eigen::VectorXd scale_;
+  Eigen::VectorXd weights_;
+  double residual_rms_;
+
+  Eigen::VectorXd variableValues(Optimization::Case *c);
+  Eigen::VectorXd features(const Eigen::VectorXd &x, const QString &realization) const;
+  void add(Optimization::Case *c, double seconds);
+  void fit();
+  double predictLog(Optimization::Case *c);
+};
+
+}
+
+#endif //FIELDOPT_RUNTIME_PREDICTOR_H
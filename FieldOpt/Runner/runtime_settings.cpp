@@ -56,10 +56,26 @@ RuntimeSettings::RuntimeSettings(int argc, const char *argv[])
         threads_per_sim_ = vm["threads-per-simulation"].as<int>();
     } else threads_per_sim_ = 1;
 
+    if (vm.count("slots-per-worker")) {
+        slots_per_worker_ = vm["slots-per-worker"].as<int>();
+        if (slots_per_worker_ < 0)
+            throw std::runtime_error("The number of slots per worker can not be negative.");
+    } else slots_per_worker_ = 1;
+
     if (vm.count("simulation-timeout")) {
         simulation_timeout_ = vm["simulation-timeout"].as<int>();
     } else simulation_timeout_ = 0;
 
+    if (vm.count("timeout-quantile")) {
+        timeout_quantile_ = vm["timeout-quantile"].as<double>();
+        if (timeout_quantile_ < 0.0 || timeout_quantile_ >= 1.0)
+            throw std::runtime_error("The timeout quantile must be in [0, 1).");
+    } else timeout_quantile_ = 0.0;
+
+    if (vm.count("trace-file")) {
+        trace_file_ = vm["trace-file"].as<std::string>();
+    } else trace_file_ = "";
+
     if (vm.count("runner-type")) {
         QString runner_str = QString::fromStdString(vm["runner-type"].as<std::string>());
         if (QString::compare(runner_str, "serial") == 0)
@@ -131,6 +147,9 @@ RuntimeSettings::RuntimeSettings(int argc, const char *argv[])
         std::cout << "Max parallel sims:   " << (max_parallel_sims_ > 0 ? boost::lexical_cast<std::string>(max_parallel_sims_) : "default") << std::endl;
         std::cout << "Simulation delay:    " << simulation_delay_ << " seconds" << std::endl;
         std::cout << "Threads pr sim:      " << boost::lexical_cast<std::string>(threads_per_sim_) << std::endl;
+        std::cout << "Slots pr worker:     " << (slots_per_worker_ > 0 ? boost::lexical_cast<std::string>(slots_per_worker_) : "auto") << std::endl;
+        std::cout << "Timeout quantile:    " << (timeout_quantile_ > 0 ? boost::lexical_cast<std::string>(timeout_quantile_) : "off") << std::endl;
+        std::cout << "Trace file:          " << (trace_file_.empty() ? "none" : trace_file_) << std::endl;
         str_out = "Current/specified paths:";
         std::cout << "\n" << str_out << "\n" << std::string(str_out.length(),'-') << std::endl;
         std::cout << "Current dir:-------" << GetCurrentDirectoryPath().toStdString() << std::endl;
@@ -185,6 +204,9 @@ po::variables_map RuntimeSettings::createVariablesMap(int argc, const char **arg
          "start max <arg> parallel simulations")
         ("threads-per-simulation,n", po::value<int>(&thr_per_sim)->default_value(1),
          "number of threads allocated to each simulation")
+        ("slots-per-worker,k", po::value<int>()->default_value(1),
+         "number of simulations each MPI worker runs concurrently, sharing one copy of the grid "
+         "(0: as many as there are cores for the threads per simulation)")
         ("runner-type,r", po::value<std::string>(),
          "type of runner (serial/oneoff/mpisync)")
         ("grid-path,g", po::value<std::string>(),
@@ -205,6 +227,11 @@ po::variables_map RuntimeSettings::createVariablesMap(int argc, const char **arg
          "path to simulator driver file (e.g. *.DATA)")
         ("simulation-timeout,t", po::value<int>(&simulation_timeout)->default_value(0),
          "Simulations will be terminated after running for t*(lowest_recorded_time)")
+        ("timeout-quantile", po::value<double>()->default_value(0.0),
+         "predict the runtime of each case, dispatch the longest first and terminate simulations "
+         "running longer than this quantile of the prediction (e.g. 0.99; 0 to disable)")
+        ("trace-file", po::value<std::string>(),
+         "path to write a Chrome/Perfetto trace of the run phases to (one file per MPI rank)")
         ("well-prod-points,p", po::value<std::vector<double>>()->multitoken(),
          "Production well position coordinates")
         ("well-inj-points,i", po::value<std::vector<double>>()->multitoken(),
@@ -242,7 +269,9 @@ map<string, string> RuntimeSettings::GetState() {
     statemap["verbosity"] = boost::lexical_cast<string>(verbosity_level_);
     statemap["Max. parallel sims"] = boost::lexical_cast<string>(max_parallel_sims_);
     statemap["Threads pr. sim"] = boost::lexical_cast<string>(threads_per_sim_);
+    statemap["Slots pr. worker"] = boost::lexical_cast<string>(slots_per_worker_);
     statemap["Simulator timeout"] = boost::lexical_cast<string>(simulation_timeout_);
+    statemap["Timeout quantile"] = boost::lexical_cast<string>(timeout_quantile_);
 
     statemap["Overwrite existing files"] = overwrite_existing_ ? "Yes" : "No";
 
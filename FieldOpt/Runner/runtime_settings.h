@@ -54,8 +54,11 @@ class RuntimeSettings : public Loggable
   bool overwrite_existing() const { return overwrite_existing_; }
   int max_parallel_sims() const { return max_parallel_sims_; }
   int threads_per_sim() const { return threads_per_sim_; }
+  int slots_per_worker() const { return slots_per_worker_; }
   int simulation_timeout() const { return simulation_timeout_; }
+  double timeout_quantile() const { return timeout_quantile_; }
   int simulation_delay() const { return simulation_delay_; }
+  std::string trace_file() const { return trace_file_; }
   RunnerType runner_type() const { return runner_type_; }
   QPair<QVector<double>, QVector<double>> prod_coords() const { return prod_coords_; }
   QPair<QVector<double>, QVector<double>> inje_coords() const { return inje_coords_; }
@@ -72,7 +75,10 @@ class RuntimeSettings : public Loggable
   int simulation_delay_; //!< Minimum delay between start of each simulation (in seconds).
   int max_parallel_sims_; //!< Maximum number of parallel simulations to start. This is important to define if you for example have a limited number of simulator licenses.
   int threads_per_sim_; //!< Number of threads to be used pr. simulation. Only works for ADGPRS.
+  int slots_per_worker_; //!< Number of simulations each MPI worker runs concurrently. 0: as many as the cores allow with threads_per_sim_ threads each.
   int simulation_timeout_; //!< Simulations will be terminated after running for simulation_timeout_ times the lowest recorded simulation time up to that point.
+  double timeout_quantile_; //!< Quantile of the predicted runtime used as the timeout for each simulation. 0 if runtimes should not be predicted.
+  std::string trace_file_; //!< Path to write a trace of the run phases to. Empty if no trace should be written.
   RunnerType runner_type_; //!< The type of runner to be used (e.g. serial or parallel).
   QPair<QVector<double>, QVector<double>> prod_coords_; //!< The spline coordinates for the production well
   QPair<QVector<double>, QVector<double>> inje_coords_; //!< The spline coordinates for the injection well
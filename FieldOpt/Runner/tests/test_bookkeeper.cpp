@@ -68,4 +68,50 @@ TEST_F(BookkeeperTest, Bookkeeping) {
     EXPECT_TRUE(bookkeeper_->IsEvaluated(c1));
 }
 
+TEST_F(BookkeeperTest, Fidelity) {
+    c1->set_objective_function_value(100);
+    compass_search_->SubmitEvaluatedCase(c1);
+    auto c1_low = new Optimization::Case(c1);
+    c1_low->SetFidelity(Optimization::Case::FID_LOW);
+    EXPECT_TRUE(bookkeeper_->IsEvaluated(c1_low, true));
+    EXPECT_DOUBLE_EQ(100, c1_low->objective_function_value());
+
+    // Treat c2 as having been evaluated on the low-fidelity deck
+    c2->set_objective_function_value(50);
+    compass_search_->SubmitEvaluatedCase(c2);
+    c2->SetFidelity(Optimization::Case::FID_LOW);
+    auto c2_low = new Optimization::Case(c2);
+    c2_low->SetFidelity(Optimization::Case::FID_LOW);
+    auto c2_high = new Optimization::Case(c2);
+    EXPECT_TRUE(bookkeeper_->IsEvaluated(c2_low));
+    EXPECT_FALSE(bookkeeper_->IsEvaluated(c2_high));
+}
+
+TEST_F(BookkeeperTest, Screened) {
+    // A screened case only has a surrogate prediction as its value
+    Optimization::CaseHandler case_handler;
+    auto screened = new Optimization::Case(c1);
+    screened->set_objective_function_value(1e6);
+    case_handler.AddNewCase(screened);
+    case_handler.SetCaseScreened(screened->id());
+    auto evaluated = new Optimization::Case(c2);
+    evaluated->set_objective_function_value(100);
+    case_handler.AddNewCase(evaluated);
+    case_handler.GetNextCaseForEvaluation();
+    case_handler.SetCaseEvaluated(evaluated->id());
+
+    Runner::Bookkeeper bookkeeper(settings_full_, &case_handler);
+    EXPECT_FALSE(bookkeeper.IsEvaluated(new Optimization::Case(c1), true));
+    EXPECT_TRUE(bookkeeper.IsEvaluated(new Optimization::Case(c2), true));
+}
+
+TEST_F(BookkeeperTest, EarlyTerminated) {
+    // c1 was stopped early; its value is only an optimistic bound
+    c1->set_objective_function_value(1e6);
+    c1->state.eval = Optimization::Case::CaseState::EvalStatus::E_TERMINATED;
+    compass_search_->SubmitEvaluatedCase(c1);
+    auto c1_copy = new Optimization::Case(c1);
+    EXPECT_FALSE(bookkeeper_->IsEvaluated(c1_copy, true));
+}
+
 }
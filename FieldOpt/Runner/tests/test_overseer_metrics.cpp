@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QTemporaryDir>
+#include "Runner/runners/overseer_metrics.h"
+
+using namespace Runner::MPI;
+
+namespace {
+
+class OverseerMetricsTest : public ::testing::Test {
+ protected:
+  OverseerMetricsTest() {}
+  void sleep() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }
+  QTemporaryDir dir_;
+  QString path_ = dir_.path() + "/metrics_overseer.json";
+};
+
+TEST_F(OverseerMetricsTest, Utilization) {
+    OverseerMetrics metrics({1, 2}, path_, 3600);
+    metrics.SetQueueDepth(2);
+    metrics.WorkerStarted(1);
+    metrics.WorkerStarted(2);
+    metrics.SetQueueDepth(0);
+    metrics.BeginWait();
+    sleep();
+    metrics.EndWait();
+    metrics.WorkerStopped(1);
+    sleep(); // Worker 1 is idle on an empty queue
+    metrics.SetQueueDepth(1);
+    metrics.RecordBookkeeperLookup(true);
+    metrics.RecordBookkeeperLookup(false);
+
+    auto w1 = metrics.workers().at(1);
+    auto w2 = metrics.workers().at(2);
+    EXPECT_EQ(1, w1.cases);
+    EXPECT_GE(w1.busy_seconds, 0.02);
+    EXPECT_GE(w1.barrier_idle_seconds, 0.02);
+    EXPECT_NEAR(w1.idle_seconds, w1.barrier_idle_seconds, 0.005);
+    EXPECT_GE(w2.busy_seconds, 0.04);
+    EXPECT_LT(w2.idle_seconds, 0.01);
+    EXPECT_GE(metrics.wait_seconds(), 0.02);
+    EXPECT_GE(metrics.work_seconds(), 0.0);
+    EXPECT_EQ(2, metrics.max_queue_depth());
+    EXPECT_DOUBLE_EQ(0.5, metrics.bookkeeper_hit_rate());
+    EXPECT_NE(std::string::npos, metrics.SummaryTable().find("Bookkeeper hit rate"));
+
+    metrics.Write();
+    QFile file(path_);
+    ASSERT_TRUE(file.open(QFile::ReadOnly));
+    QJsonObject json = QJsonDocument::fromJson(file.readAll()).object();
+    EXPECT_EQ(2, json["Workers"].toArray().size());
+    EXPECT_EQ(1, json["QueueDepth"].toObject()["Current"].toInt());
+    EXPECT_EQ(1, json["Samples"].toArray().size());
+}
+
+TEST_F(OverseerMetricsTest, Slots) {
+    OverseerMetrics metrics({1}, "", 3600);
+    metrics.SetSlots(1, 4);
+    metrics.SetQueueDepth(1);
+    metrics.WorkerStarted(1);
+    metrics.WorkerStarted(1);
+    sleep(); // Two of four slots busy
+    metrics.WorkerStopped(1);
+    metrics.WorkerStopped(1);
+
+    auto w1 = metrics.workers().at(1);
+    EXPECT_EQ(4, w1.slots);
+    EXPECT_EQ(0, w1.busy_slots);
+    EXPECT_EQ(2, w1.cases);
+    EXPECT_GE(w1.busy_seconds, 0.04);
+    EXPECT_NEAR(w1.busy_seconds, w1.idle_seconds, 0.005);
+    EXPECT_NE(std::string::npos, metrics.SummaryTable().find("Slots"));
+}
+
+}
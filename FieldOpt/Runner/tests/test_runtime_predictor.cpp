@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/normal_distribution.hpp>
+#include "Runner/runtime_predictor.h"
+
+using namespace Runner;
+using Optimization::Case;
+
+namespace {
+
+class RuntimePredictorTest : public ::testing::Test {
+ protected:
+  RuntimePredictorTest() {
+      rate_id_ = QUuid::createUuid();
+      wells_id_ = QUuid::createUuid();
+  }
+  virtual ~RuntimePredictorTest() {
+      for (auto c : cases_) delete c;
+  }
+
+  /*!
+   * @brief Create a case whose "true" runtime is exp(2 + 0.5 * rate + 0.2 * wells) seconds,
+   * doubled on realization "R2".
+   */
+  Case *createCase(double rate, int wells, QString realization="") {
+      QHash<QUuid, double> real_variables;
+      real_variables[rate_id_] = rate;
+      QHash<QUuid, int> integer_variables;
+      integer_variables[wells_id_] = wells;
+      auto c = new Case(QHash<QUuid, bool>(), integer_variables, real_variables);
+      c->SetEnsembleRealization(realization);
+      cases_.append(c);
+      return c;
+  }
+  double runtime(double rate, int wells, QString realization="") const {
+      return std::exp(2.0 + 0.5 * rate + 0.2 * wells) * (realization == "R2" ? 2.0 : 1.0);
+  }
+
+  QUuid rate_id_;
+  QUuid wells_id_;
+  QList<Case *> cases_;
+};
+
+TEST_F(RuntimePredictorTest, Untrained) {
+    RuntimePredictor predictor(0.95, 8);
+    auto c = createCase(1.0, 2);
+    EXPECT_FALSE(predictor.IsTrained());
+    EXPECT_THROW(predictor.Predict(c), std::runtime_error);
+    for (int i = 0; i < 7; ++i) predictor.AddObservation(createCase(i, 1), runtime(i, 1));
+    EXPECT_FALSE(predictor.IsTrained());
+    predictor.AddObservation(createCase(7, 1), runtime(7, 1));
+    EXPECT_TRUE(predictor.IsTrained());
+    EXPECT_EQ(0, predictor.accuracy().predictions);
+    EXPECT_THROW(RuntimePredictor(1.0), std::runtime_error);
+}
+
+TEST_F(RuntimePredictorTest, LearnsLogLinearRuntime) {
+    RuntimePredictor predictor(0.95);
+    for (int i = 0; i < 60; ++i) {
+        double rate = (i % 10) / 2.0;
+        int wells = i % 7;
+        predictor.AddObservation(createCase(rate, wells), runtime(rate, wells));
+    }
+    auto slow = createCase(4.0, 6);
+    auto fast = createCase(0.5, 1);
+    EXPECT_GT(predictor.Predict(slow), predictor.Predict(fast));
+    EXPECT_NEAR(std::log(runtime(4.0, 6)), std::log(predictor.Predict(slow)), 0.2);
+    EXPECT_NEAR(std::log(runtime(0.5, 1)), std::log(predictor.Predict(fast)), 0.2);
+    EXPECT_GT(predictor.PredictQuantile(slow), predictor.Predict(slow));
+    EXPECT_GT(predictor.accuracy().predictions, 0);
+    EXPECT_LT(predictor.accuracy().log_rmse(), 0.5);
+}
+
+TEST_F(RuntimePredictorTest, QuantileCoverage) {
+    RuntimePredictor predictor(0.9);
+    boost::random::mt19937 gen(7);
+    boost::random::normal_distribution<> noise(0.0, 0.3);
+    for (int i = 0; i < 400; ++i) {
+        double rate = (i % 13) / 3.0;
+        int wells = i % 5;
+        predictor.AddObservation(createCase(rate, wells), runtime(rate, wells) * std::exp(noise(gen)));
+    }
+    EXPECT_NEAR(0.3, predictor.sigma(), 0.1);
+    EXPECT_NEAR(0.9, predictor.accuracy().coverage(), 0.06);
+    EXPECT_NE(std::string::npos, predictor.SummaryTable().find("Within predicted timeout"));
+}
+
+TEST_F(RuntimePredictorTest, Realizations) {
+    RuntimePredictor predictor(0.95);
+    for (int i = 0; i < 40; ++i) {
+        QString realization = i % 2 == 0 ? "R1" : "R2";
+        predictor.AddObservation(createCase(1.0, 2, realization), runtime(1.0, 2, realization));
+    }
+    double r1 = predictor.Predict(createCase(1.0, 2, "R1"));
+    double r2 = predictor.Predict(createCase(1.0, 2, "R2"));
+    EXPECT_NEAR(2.0, r2 / r1, 0.2);
+}
+
+TEST_F(RuntimePredictorTest, SubSecondRuntimes) {
+    // Simulations finishing in under a second are recorded with a runtime of 0 s
+    RuntimePredictor predictor(0.95, 4);
+    for (int i = 0; i < 8; ++i) predictor.AddObservation(createCase(i, 1), 0);
+    EXPECT_TRUE(predictor.IsTrained());
+    EXPECT_NEAR(1.0, predictor.Predict(createCase(3.0, 1)), 1e-6);
+    EXPECT_EQ(4, predictor.accuracy().predictions);
+    EXPECT_NEAR(0.0, predictor.accuracy().log_rmse(), 1e-6);
+}
+
+TEST_F(RuntimePredictorTest, Timeouts) {
+    RuntimePredictor predictor(0.95, 4);
+    for (int i = 0; i < 4; ++i) predictor.AddObservation(createCase(i, 1), runtime(i, 1));
+    predictor.AddTimeout(createCase(5.0, 1), 60.0);
+    EXPECT_EQ(1, predictor.accuracy().timeouts);
+    EXPECT_EQ(5, predictor.observations());
+    EXPECT_EQ(0, predictor.accuracy().predictions);
+}
+
+}
@@ -83,6 +83,14 @@ Model::Model(QJsonObject json_model, Paths &paths)
     }
     qSort(control_times_);
 
+    // Well index calculation threads
+    wic_threads_ = 0;
+    if (json_model.contains("WICThreads")) {
+        wic_threads_ = json_model["WICThreads"].toInt();
+        if (wic_threads_ < 0)
+            throw UnableToParseModelSectionException("WICThreads must be a non-negative integer.");
+    }
+
     // Wells
     wells_ = QList<Well>();
     if (json_model.contains("Import")) {
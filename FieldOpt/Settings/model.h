@@ -166,10 +166,12 @@ class Model
 
   QList<Well> wells() const { return wells_; }                //!< Get the struct containing settings for the well(s) in the model.
   QList<int> control_times() const { return control_times_; } //!< Get the control times for the schedule
+  int wic_threads() const { return wic_threads_; }            //!< Number of threads to use for well index calculations (0: hardware concurrency).
 
  private:
   QList<Well> wells_;
   QList<int> control_times_;
+  int wic_threads_;
 
   void readReservoir(QJsonObject json_reservoir, Paths &paths);
   Well readSingleWell(QJsonObject json_well);
@@ -313,6 +313,8 @@ Optimizer::Parameters Optimizer::parseParameters(QJsonObject &json_parameters) {
         if (json_parameters.contains("Pattern"))
             params.pattern = json_parameters["Pattern"].toString();
         else params.pattern = "Compass";
+        if (json_parameters.contains("OpportunisticPolling"))
+            params.opportunistic_polling = json_parameters["OpportunisticPolling"].toBool();
 
         // GA parameters
         if (json_parameters.contains("MaxGenerations"))
@@ -342,6 +344,8 @@ Optimizer::Parameters Optimizer::parseParameters(QJsonObject &json_parameters) {
         if (json_parameters.contains("UpperBound"))
             params.upper_bound = json_parameters["UpperBound"].toDouble();
         else params.upper_bound = 10;
+        if (json_parameters.contains("SteadyState"))
+            params.steady_state = json_parameters["SteadyState"].toBool();
 
         // PSO parameters
         if(json_parameters.contains("PSO-LearningFactor1")){
@@ -407,6 +411,31 @@ Optimizer::Parameters Optimizer::parseParameters(QJsonObject &json_parameters) {
             }
         }
 
+        // Surrogate screening parameters
+        if (json_parameters.contains("SurrogateScreening")) {
+            params.surrogate_screening = json_parameters["SurrogateScreening"].toBool();
+        }
+        if (json_parameters.contains("SurrogateOversampling")) {
+            params.surrogate_oversampling = json_parameters["SurrogateOversampling"].toDouble();
+            if (params.surrogate_oversampling < 1.0) {
+                throw std::runtime_error("SurrogateOversampling must be at least 1.0.");
+            }
+        }
+        if (json_parameters.contains("SurrogateMinCases")) {
+            params.surrogate_min_cases = json_parameters["SurrogateMinCases"].toInt();
+        }
+
+        // Multi-fidelity parameters
+        if (json_parameters.contains("MultiFidelity")) {
+            params.multi_fidelity = json_parameters["MultiFidelity"].toBool();
+        }
+        if (json_parameters.contains("MultiFidelityPromotion")) {
+            params.multi_fidelity_promotion = json_parameters["MultiFidelityPromotion"].toDouble();
+            if (params.multi_fidelity_promotion <= 0.0 || params.multi_fidelity_promotion > 1.0) {
+                throw std::runtime_error("MultiFidelityPromotion must be in the interval (0, 1].");
+            }
+        }
+
         // CMA-ES Parameters
         if (json_parameters.contains("ImproveBaseCase")) {
             params.improve_base_case = json_parameters["ImproveBaseCase"].toBool();
@@ -69,6 +69,7 @@ class Optimizer
     double auto_step_init_scale = 0.25; //!< Scaling factor for auto-determined initial step lengths (e.g. 0.25*(upper-lower)
     double auto_step_conv_scale = 0.01; //!< Scaling factor for auto-determined convergence step lengths (e.g. 0.01*(upper-lower)
     QString pattern;                     //!< The pattern to be used for GSS algorithms.
+    bool opportunistic_polling = false;  //!< Abandon the rest of a poll (dequeue and cancel trial points) once an improving trial point is found.
 
     // GA parameters
     int max_generations;      //!< Max iterations. Default: 50
@@ -80,6 +81,7 @@ class Optimizer
     double stagnation_limit;  //!< Stagnation limit. Default: 1e-10.
     double lower_bound;       //!< Simple lower bound. This is applied to _all_ variables. Default: -10.0.
     double upper_bound;       //!< Simple upper bound. This is applied to _all_ variables. Default: +10.0.
+    bool steady_state = false; //!< Use the asynchronous steady-state variant of RGARDD and PSO. Default: false.
 
     // PSO parameters
     double pso_learning_factor_1; //!< Learning factor (c1), from the swarms best known perturbation. Default: 1.5
@@ -97,6 +99,15 @@ class Optimizer
     std::string ego_kernel = "CovMatern5iso";        //!< Which kernel function to use for the gaussian process model.
     std::string ego_af = "ExpectedImprovement";      //!< Which acquisiton function to use.
 
+    // Surrogate screening parameters (uses ego_kernel and ego_af)
+    bool surrogate_screening = false;    //!< Screen batches of generated cases with a GP model and only simulate the most promising. Default: false.
+    double surrogate_oversampling = 2.0; //!< Number of generated cases per simulated case in a screened batch. Default: 2.0.
+    int surrogate_min_cases = -1;        //!< Number of simulated cases needed before screening starts. Default: 2 * number of continuous variables.
+
+    // Multi-fidelity parameters (requires a LowFidelity deck in the Simulator section)
+    bool multi_fidelity = false;            //!< Evaluate generated batches on the low-fidelity deck and only promote the best to the high-fidelity deck. Default: false.
+    double multi_fidelity_promotion = 0.25; //!< Fraction of each low-fidelity batch promoted to high fidelity. Default: 0.25.
+
     // VFSA Parameters
     int vfsa_evals_pr_iteration = 1; //!< Number of evaluations to be performed pr. iteration (temperature). Default: 1.
     int vfsa_max_iterations = 50;    //!< Maximum number of iterations to be performed. Default: 50.
@@ -211,6 +222,10 @@ class Optimizer
   QList<Constraint> constraints() const { return constraints_; } //!< Get the optimizer constraints.
   QList<HybridComponent> HybridComponents() { return hybrid_components_; } // Get the list of hybrid-optimizer components when using the HYBRID type.
   void SetRngSeed(const int seed) { parameters_.rng_seed = seed; } //!< Change the RNG seed (used by HybridOptimizer).
+  void SetSteadyState(const bool steady_state) { parameters_.steady_state = steady_state; } //!< Toggle the steady-state variant of RGARDD and PSO.
+  void SetSurrogateScreening(const bool screening) { parameters_.surrogate_screening = screening; } //!< Toggle surrogate screening of generated cases.
+  void SetMultiFidelity(const bool multi_fidelity) { parameters_.multi_fidelity = multi_fidelity; } //!< Toggle low-fidelity pre-evaluation of generated cases.
+  void SetOpportunisticPolling(const bool opportunistic) { parameters_.opportunistic_polling = opportunistic; } //!< Toggle opportunistic polling in GSS algorithms.
 
 
  private:
@@ -29,14 +29,23 @@ namespace Settings {
 
 Simulator::Simulator(QJsonObject json_simulator, Paths &paths)
 {
-    setPaths(json_simulator, paths);
     setType(json_simulator);
+    setPaths(json_simulator, paths);
     setParams(json_simulator);
     setCommands(json_simulator);
     setFluidModel(json_simulator);
+    setLowFidelity(json_simulator, paths);
+    setEarlyTermination(json_simulator);
+    setRestartCache(json_simulator);
+    setWorkDirectories(json_simulator);
+    setSynthetic(json_simulator);
 }
 
 void Simulator::setPaths(QJsonObject json_simulator, Paths &paths) {
+    if (type_ == SimulatorType::Synthetic && !paths.IsSet(Paths::SIM_DRIVER_FILE)
+        && !json_simulator.contains("DriverPath")) {
+        return; // The synthetic simulator does not need a deck
+    }
     if (!paths.IsSet(Paths::ENSEMBLE_FILE)) {
         is_ensemble_ = false;
         if (!paths.IsSet(Paths::SIM_DRIVER_FILE) && json_simulator.contains("DriverPath")) {
@@ -72,6 +81,8 @@ void Simulator::setType(QJsonObject json_simulator) {
         type_ = SimulatorType::Flow;
     else if (QString::compare(type, "IX", Qt::CaseInsensitive) == 0)
         type_ = SimulatorType::INTERSECT;
+    else if (QString::compare(type, "Synthetic", Qt::CaseInsensitive) == 0)
+        type_ = SimulatorType::Synthetic;
     else throw SimulatorTypeNotRecognizedException(
             "The simulator type " + type.toStdString() + " was not recognized");
 }
@@ -95,7 +106,7 @@ void Simulator::setCommands(QJsonObject json_simulator) {
             commands_->append(commands[i].toString());
         }
     }
-    if (script_name_.length() == 0 && commands.size() == 0)
+    if (script_name_.length() == 0 && commands.size() == 0 && type_ != SimulatorType::Synthetic)
         Printer::ext_warn("No simulator commands or scripts given in driver file. "
                           "Relying on script path being passed as runtime argument.", "Settings", "Simulator");
 }
@@ -111,4 +122,156 @@ void Simulator::setFluidModel(QJsonObject json_simulator) {
     else fluid_model_ = SimulatorFluidModel::BlackOil;
 }
 
+void Simulator::setLowFidelity(QJsonObject json_simulator, Paths &paths) {
+    if (!json_simulator.contains("LowFidelity")) {
+        return;
+    }
+    if (type_ != SimulatorType::ECLIPSE) { // Only the ECLIPSE interface can switch decks (SetRealization)
+        throw std::runtime_error("A LowFidelity deck is only supported for the ECLIPSE simulator.");
+    }
+    if (is_ensemble_) {
+        throw std::runtime_error("A LowFidelity deck can not be combined with an ensemble.");
+    }
+    if (!paths.IsSet(Paths::GRID_FILE)) {
+        throw std::runtime_error("The grid file path must be set when using a LowFidelity deck.");
+    }
+    QJsonObject json_low_fidelity = json_simulator["LowFidelity"].toObject();
+    if (!json_low_fidelity.contains("DriverPath") || !json_low_fidelity.contains("ScheduleFile")
+        || !json_low_fidelity.contains("GridPath")) {
+        throw std::runtime_error("The LowFidelity section must contain DriverPath, ScheduleFile and GridPath.");
+    }
+
+    // The low-fidelity deck path is relative to the high-fidelity deck directory;
+    // the schedule and grid paths are relative to the low-fidelity deck directory.
+    std::string data = json_low_fidelity["DriverPath"].toString().toStdString();
+    if (data[0] != '/') {
+        data = paths.GetPath(Paths::SIM_DRIVER_DIR) + "/" + data;
+    }
+    std::string schedule = GetParentDirectoryPath(data) + "/" + json_low_fidelity["ScheduleFile"].toString().toStdString();
+    std::string grid = GetParentDirectoryPath(data) + "/" + json_low_fidelity["GridPath"].toString().toStdString();
+    for (auto path : {data, schedule, grid}) {
+        if (!FileExists(path)) {
+            throw std::runtime_error("LowFidelity file not found: " + path);
+        }
+    }
+    low_fidelity_ = new Ensemble::Realization("low-fidelity", data, schedule, grid);
+    high_fidelity_ = new Ensemble::Realization("high-fidelity",
+                                               paths.GetPath(Paths::SIM_DRIVER_FILE),
+                                               paths.GetPath(Paths::SIM_SCH_FILE),
+                                               paths.GetPath(Paths::GRID_FILE));
+}
+
+void Simulator::setEarlyTermination(QJsonObject json_simulator) {
+    if (!json_simulator.contains("EarlyTermination")) {
+        return;
+    }
+    if (type_ == SimulatorType::INTERSECT) {
+        throw std::runtime_error("EarlyTermination is not supported for the IX simulator.");
+    }
+    QJsonObject json_early_termination = json_simulator["EarlyTermination"].toObject();
+    early_termination_.enabled = true;
+    set_opt_prop_double(early_termination_.rate_cap_factor, json_early_termination, "RateCapFactor");
+    set_opt_prop_int(early_termination_.min_report_steps, json_early_termination, "MinReportSteps");
+    set_opt_prop_int(early_termination_.check_interval, json_early_termination, "CheckInterval");
+    if (early_termination_.rate_cap_factor < 1.0) {
+        throw std::runtime_error("The EarlyTermination RateCapFactor must be at least 1.");
+    }
+    if (early_termination_.min_report_steps < 2) {
+        throw std::runtime_error("The EarlyTermination MinReportSteps must be at least 2.");
+    }
+}
+
+void Simulator::setRestartCache(QJsonObject json_simulator) {
+    if (!json_simulator.contains("RestartCache")) {
+        return;
+    }
+    if (type_ != SimulatorType::ECLIPSE) {
+        throw std::runtime_error("The RestartCache is only supported for the ECLIPSE simulator.");
+    }
+    if (ecl_use_actionx_) {
+        throw std::runtime_error("The RestartCache can not be used together with UseACTIONX.");
+    }
+    QJsonObject json_restart_cache = json_simulator["RestartCache"].toObject();
+    restart_cache_.enabled = true;
+    set_opt_prop_int(restart_cache_.max_entries, json_restart_cache, "MaxEntries");
+    if (restart_cache_.max_entries < 1) {
+        throw std::runtime_error("The RestartCache MaxEntries must be at least 1.");
+    }
+}
+
+void Simulator::setWorkDirectories(QJsonObject json_simulator) {
+    if (!json_simulator.contains("WorkDirectories")) {
+        return;
+    }
+    QJsonObject json_work_dirs = json_simulator["WorkDirectories"].toObject();
+    set_opt_prop_bool(work_directories_.per_case, json_work_dirs, "PerCase");
+    set_opt_prop_string(work_directories_.root, json_work_dirs, "Root");
+    set_opt_prop_bool(work_directories_.keep_case_directories, json_work_dirs, "KeepCaseDirectories");
+    if (json_work_dirs.contains("Link")) {
+        QString link = json_work_dirs["Link"].toString();
+        if (QString::compare(link, "Copy", Qt::CaseInsensitive) == 0)
+            work_directories_.link = WorkDirectories::Copy;
+        else if (QString::compare(link, "Hardlink", Qt::CaseInsensitive) == 0)
+            work_directories_.link = WorkDirectories::Hardlink;
+        else if (QString::compare(link, "Symlink", Qt::CaseInsensitive) == 0)
+            work_directories_.link = WorkDirectories::Symlink;
+        else if (QString::compare(link, "Reflink", Qt::CaseInsensitive) == 0)
+            work_directories_.link = WorkDirectories::Reflink;
+        else throw std::runtime_error("WorkDirectories Link type " + link.toStdString() + " not recognized.");
+    }
+    if (work_directories_.per_case && type_ != SimulatorType::ECLIPSE) {
+        throw std::runtime_error("Per-case work directories are only supported for the ECLIPSE simulator.");
+    }
+}
+
+void Simulator::setSynthetic(QJsonObject json_simulator) {
+    if (!json_simulator.contains("Synthetic")) {
+        return;
+    }
+    if (type_ != SimulatorType::Synthetic) {
+        throw std::runtime_error("The Synthetic section is only used with the Synthetic simulator type.");
+    }
+    QJsonObject json_synthetic = json_simulator["Synthetic"].toObject();
+    if (json_synthetic.contains("Function")) {
+        QString function = json_synthetic["Function"].toString();
+        if (QString::compare(function, "Sphere", Qt::CaseInsensitive) == 0)
+            synthetic_.function = Synthetic::Sphere;
+        else if (QString::compare(function, "Rosenbrock", Qt::CaseInsensitive) == 0)
+            synthetic_.function = Synthetic::Rosenbrock;
+        else throw std::runtime_error("Synthetic Function " + function.toStdString() + " not recognized.");
+    }
+    set_opt_prop_double(synthetic_.center, json_synthetic, "Center");
+    set_opt_prop_double(synthetic_.width, json_synthetic, "Width");
+    set_opt_prop_double(synthetic_.volume, json_synthetic, "Volume");
+    set_opt_prop_double(synthetic_.failure_rate, json_synthetic, "FailureRate");
+    set_opt_prop_int(synthetic_.seed, json_synthetic, "Seed");
+    if (json_synthetic.contains("Runtime")) {
+        QJsonObject json_runtime = json_synthetic["Runtime"].toObject();
+        QString distribution = json_runtime["Distribution"].toString("Constant");
+        if (QString::compare(distribution, "Constant", Qt::CaseInsensitive) == 0)
+            synthetic_.runtime_distribution = Synthetic::Constant;
+        else if (QString::compare(distribution, "Uniform", Qt::CaseInsensitive) == 0)
+            synthetic_.runtime_distribution = Synthetic::Uniform;
+        else if (QString::compare(distribution, "LogNormal", Qt::CaseInsensitive) == 0)
+            synthetic_.runtime_distribution = Synthetic::LogNormal;
+        else throw std::runtime_error("Synthetic Runtime Distribution " + distribution.toStdString() + " not recognized.");
+        set_opt_prop_double(synthetic_.runtime_mean, json_runtime, "Mean");
+        set_opt_prop_double(synthetic_.runtime_min, json_runtime, "Min");
+        set_opt_prop_double(synthetic_.runtime_max, json_runtime, "Max");
+        set_opt_prop_double(synthetic_.runtime_sigma, json_runtime, "Sigma");
+    }
+    if (synthetic_.width <= 0) {
+        throw std::runtime_error("The Synthetic Width must be positive.");
+    }
+    if (synthetic_.failure_rate < 0 || synthetic_.failure_rate >= 1) {
+        throw std::runtime_error("The Synthetic FailureRate must be in [0, 1).");
+    }
+    if (synthetic_.runtime_mean < 0 || synthetic_.runtime_min < 0 || synthetic_.runtime_sigma < 0) {
+        throw std::runtime_error("The Synthetic Runtime parameters must be non-negative.");
+    }
+    if (synthetic_.runtime_distribution == Synthetic::Uniform && synthetic_.runtime_min > synthetic_.runtime_max) {
+        throw std::runtime_error("The Synthetic Runtime Min must not be larger than Max.");
+    }
+}
+
 }
@@ -39,9 +39,85 @@ class Simulator
 
  public:
   Simulator(QJsonObject json_simulator, Paths &paths);
-  enum SimulatorType { ECLIPSE, ADGPRS, Flow, INTERSECT };
+  enum SimulatorType { ECLIPSE, ADGPRS, Flow, INTERSECT, Synthetic };
   enum SimulatorFluidModel { BlackOil, DeadOil };
 
+  /*!
+   * @brief Settings for terminating simulations of cases that cannot beat the tentative
+   * best case, read from the EarlyTermination section.
+   *
+   * While a simulation is running, the summary written so far is read every
+   * CheckInterval seconds and an optimistic bound on the objective is computed,
+   * assuming that each revenue component keeps producing at RateCapFactor times
+   * the highest rate seen so far until the end of the schedule.
+   */
+  struct EarlyTermination {
+    bool enabled = false;
+    double rate_cap_factor = 2.0; //!< Multiplier on the highest rate seen so far used to cap the remaining production.
+    int min_report_steps = 3; //!< Number of report steps that must be available before a case may be terminated.
+    int check_interval = 30; //!< Seconds between reads of the summary.
+  };
+
+  /*!
+   * @brief Settings for reusing simulations of cases whose controls share a prefix
+   * with a previously simulated case, read from the RestartCache section.
+   *
+   * Full simulations write a restart at every report step and are kept in up to
+   * MaxEntries cache slots in the work directory. A case whose schedule matches a
+   * cached one up to some control time is restarted from there, so only the tail
+   * of the schedule is simulated.
+   */
+  struct RestartCache {
+    bool enabled = false;
+    int max_entries = 8; //!< Number of simulations kept in the cache.
+  };
+
+  /*!
+   * @brief Settings for the simulation work directories, read from the
+   * WorkDirectories section.
+   *
+   * By default all cases are simulated in one copy of the deck directory. With
+   * PerCase, each case gets a directory of its own below Root (default: the
+   * output directory), where the input files are linked rather than copied and
+   * only the files FieldOpt writes are fresh copies. Case directories are deleted
+   * once the results have been read unless KeepCaseDirectories is set.
+   */
+  struct WorkDirectories {
+    enum LinkMode { Copy, Hardlink, Symlink, Reflink };
+    bool per_case = false;
+    LinkMode link = Hardlink; //!< How input files are materialised. Hardlinks fall back to symlinks across file systems; reflinks fall back to copies.
+    std::string root = ""; //!< Directory to create case directories in, e.g. on a node-local tmpfs.
+    bool keep_case_directories = false;
+  };
+
+  /*!
+   * @brief Settings for the in-process synthetic simulator (Type Synthetic), read from
+   * the Synthetic section.
+   *
+   * The synthetic simulator evaluates an analytic test function f of the continuous
+   * variables, scaled as (x - Center) / Width, and produces cumulative field
+   * production growing linearly over the control times: Volume / (1 + f) oil and
+   * the rest of Volume as water. Each evaluation sleeps for a runtime drawn from the
+   * Runtime distribution, and fails with probability FailureRate. Runtimes and
+   * failures are drawn from a stream seeded by Seed and the variable values, so a
+   * case always behaves the same.
+   */
+  struct Synthetic {
+    enum Function { Sphere, Rosenbrock };
+    enum RuntimeDistribution { Constant, Uniform, LogNormal };
+    Function function = Sphere;
+    double center = 0.0; //!< Location of the optimum in each (unscaled) variable.
+    double width = 1.0; //!< Scale of the variables.
+    double volume = 1.0e6; //!< Total liquid produced by the end of the schedule.
+    RuntimeDistribution runtime_distribution = Constant;
+    double runtime_mean = 0.0; //!< Mean runtime in seconds (Constant and LogNormal).
+    double runtime_min = 0.0; //!< Lower runtime bound in seconds (Uniform).
+    double runtime_max = 0.0; //!< Upper runtime bound in seconds (Uniform).
+    double runtime_sigma = 0.5; //!< Standard deviation of the log-runtime (LogNormal).
+    double failure_rate = 0.0; //!< Probability that an evaluation fails.
+    int seed = 1;
+  };
+
 
   /*!
    * Get the simulator type (e.g. ECLIPSE).
@@ -63,6 +139,25 @@ class Simulator
 
   Ensemble get_ensemble() const { return ensemble_; }
 
+  /*!
+   * @brief Check whether a low-fidelity (e.g. upscaled) version of the deck
+   * has been declared in the LowFidelity section. Only supported for ECLIPSE.
+   */
+  bool is_multi_fidelity() const { return low_fidelity_ != nullptr; }
+
+  /*!
+   * @brief Get the low-fidelity deck. Only valid if is_multi_fidelity() is true.
+   *
+   * The deck is described like an ensemble realization, so that it can be
+   * passed to Simulation::Simulator::Evaluate(realization, ...).
+   */
+  const Ensemble::Realization &low_fidelity() const { return *low_fidelity_; }
+
+  /*!
+   * @brief Get the (regular) high-fidelity deck. Only valid if is_multi_fidelity() is true.
+   */
+  const Ensemble::Realization &high_fidelity() const { return *high_fidelity_; }
+
   /*!
    * Get the fluid model.
    */
@@ -95,6 +190,26 @@ class Simulator
    */
   bool read_external_json_results() const { return read_external_json_results_; }
 
+  /*!
+   * @brief Get the early termination settings. See EarlyTermination.
+   */
+  const EarlyTermination &early_termination() const { return early_termination_; }
+
+  /*!
+   * @brief Get the restart cache settings. See RestartCache.
+   */
+  const RestartCache &restart_cache() const { return restart_cache_; }
+
+  /*!
+   * @brief Get the work directory settings. See WorkDirectories.
+   */
+  const WorkDirectories &work_directories() const { return work_directories_; }
+
+  /*!
+   * @brief Get the synthetic simulator settings. See Synthetic.
+   */
+  const Synthetic &synthetic() const { return synthetic_; }
+
  private:
   SimulatorType type_;
   SimulatorFluidModel fluid_model_;
@@ -106,6 +221,12 @@ class Simulator
   bool read_external_json_results_ = false;
   int max_minutes_ = -1;
   Ensemble ensemble_;
+  Ensemble::Realization *low_fidelity_ = nullptr;
+  Ensemble::Realization *high_fidelity_ = nullptr;
+  EarlyTermination early_termination_;
+  RestartCache restart_cache_;
+  WorkDirectories work_directories_;
+  Synthetic synthetic_;
 
 
   void setPaths(QJsonObject json_simulator, Paths &paths);
@@ -113,6 +234,11 @@ class Simulator
   void setParams(QJsonObject json_simulator);
   void setCommands(QJsonObject json_simulator);
   void setFluidModel(QJsonObject json_simulator);
+  void setLowFidelity(QJsonObject json_simulator, Paths &paths);
+  void setEarlyTermination(QJsonObject json_simulator);
+  void setRestartCache(QJsonObject json_simulator);
+  void setWorkDirectories(QJsonObject json_simulator);
+  void setSynthetic(QJsonObject json_simulator);
 
 };
 
@@ -25,6 +25,8 @@
 
 #include <gtest/gtest.h>
 #include <QString>
+#include <QJsonArray>
+#include <QJsonObject>
 
 #include "Settings/tests/test_resource_settings.hpp"
 
@@ -46,6 +48,107 @@ protected:
 TEST_F(SimulatorSettingsTest, Fields) {
     EXPECT_EQ(settings_simulator_->type(), Simulator::SimulatorType::ECLIPSE);
     EXPECT_EQ(settings_simulator_->commands()->size(), 1);
+    EXPECT_FALSE(settings_simulator_->early_termination().enabled);
+    EXPECT_FALSE(settings_simulator_->restart_cache().enabled);
+    EXPECT_FALSE(settings_simulator_->work_directories().per_case);
+}
+
+TEST_F(SimulatorSettingsTest, EarlyTermination) {
+    QJsonObject json_simulator;
+    json_simulator["Type"] = "ECLIPSE";
+    json_simulator["Commands"] = QJsonArray({"eclipse"});
+    QJsonObject json_early_termination;
+    json_early_termination["RateCapFactor"] = 1.5;
+    json_simulator["EarlyTermination"] = json_early_termination;
+
+    auto simulator = Simulator(json_simulator, paths_);
+    EXPECT_TRUE(simulator.early_termination().enabled);
+    EXPECT_DOUBLE_EQ(1.5, simulator.early_termination().rate_cap_factor);
+    EXPECT_EQ(3, simulator.early_termination().min_report_steps);
+
+    json_early_termination["RateCapFactor"] = 0.5; // Would not be an upper bound
+    json_simulator["EarlyTermination"] = json_early_termination;
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error);
+}
+
+TEST_F(SimulatorSettingsTest, LowFidelity) {
+    QJsonObject json_simulator;
+    json_simulator["Type"] = "Flow";
+    json_simulator["Commands"] = QJsonArray({"flow"});
+    QJsonObject json_low_fidelity;
+    json_low_fidelity["DriverPath"] = "COARSE.DATA";
+    json_low_fidelity["ScheduleFile"] = "include/schedule.inc";
+    json_low_fidelity["GridPath"] = "COARSE.EGRID";
+    json_simulator["LowFidelity"] = json_low_fidelity;
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error); // Flow can not switch decks
+}
+
+TEST_F(SimulatorSettingsTest, RestartCache) {
+    QJsonObject json_simulator;
+    json_simulator["Type"] = "ECLIPSE";
+    json_simulator["Commands"] = QJsonArray({"eclipse"});
+    QJsonObject json_restart_cache;
+    json_restart_cache["MaxEntries"] = 4;
+    json_simulator["RestartCache"] = json_restart_cache;
+
+    auto simulator = Simulator(json_simulator, paths_);
+    EXPECT_TRUE(simulator.restart_cache().enabled);
+    EXPECT_EQ(4, simulator.restart_cache().max_entries);
+
+    json_simulator["UseACTIONX"] = true; // Controls are not written per control time
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error);
+}
+
+TEST_F(SimulatorSettingsTest, WorkDirectories) {
+    QJsonObject json_simulator;
+    json_simulator["Type"] = "ECLIPSE";
+    json_simulator["Commands"] = QJsonArray({"eclipse"});
+    QJsonObject json_work_dirs;
+    json_work_dirs["PerCase"] = true;
+    json_work_dirs["Link"] = "Symlink";
+    json_work_dirs["Root"] = "/dev/shm/fieldopt";
+    json_simulator["WorkDirectories"] = json_work_dirs;
+
+    auto simulator = Simulator(json_simulator, paths_);
+    EXPECT_TRUE(simulator.work_directories().per_case);
+    EXPECT_EQ(Simulator::WorkDirectories::Symlink, simulator.work_directories().link);
+    EXPECT_EQ("/dev/shm/fieldopt", simulator.work_directories().root);
+    EXPECT_FALSE(simulator.work_directories().keep_case_directories);
+
+    json_work_dirs["Link"] = "Overlay";
+    json_simulator["WorkDirectories"] = json_work_dirs;
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error);
+}
+
+TEST_F(SimulatorSettingsTest, Synthetic) {
+    QJsonObject json_simulator;
+    json_simulator["Type"] = "Synthetic";
+    QJsonObject json_synthetic;
+    json_synthetic["Function"] = "Rosenbrock";
+    json_synthetic["FailureRate"] = 0.1;
+    QJsonObject json_runtime;
+    json_runtime["Distribution"] = "LogNormal";
+    json_runtime["Mean"] = 0.01;
+    json_synthetic["Runtime"] = json_runtime;
+    json_simulator["Synthetic"] = json_synthetic;
+
+    auto simulator = Simulator(json_simulator, paths_);
+    EXPECT_EQ(Simulator::SimulatorType::Synthetic, simulator.type());
+    EXPECT_EQ(Simulator::Synthetic::Rosenbrock, simulator.synthetic().function);
+    EXPECT_EQ(Simulator::Synthetic::LogNormal, simulator.synthetic().runtime_distribution);
+    EXPECT_DOUBLE_EQ(0.01, simulator.synthetic().runtime_mean);
+    EXPECT_DOUBLE_EQ(0.1, simulator.synthetic().failure_rate);
+    EXPECT_DOUBLE_EQ(1.0, simulator.synthetic().width);
+
+    json_synthetic["FailureRate"] = 1.0; // Nothing would ever be evaluated
+    json_simulator["Synthetic"] = json_synthetic;
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error);
+
+    json_simulator["Type"] = "ECLIPSE";
+    json_simulator["Commands"] = QJsonArray({"eclipse"});
+    json_synthetic["FailureRate"] = 0.1;
+    json_simulator["Synthetic"] = json_synthetic;
+    EXPECT_THROW(Simulator(json_simulator, paths_), std::runtime_error);
 }
 
 }
@@ -6,6 +6,7 @@ SET(SIMULATION_HEADERS
 	results/results.h
 	results/results_exceptions.h
     results/json_results.h
+	results/synthetic_results.h
 	simulator_interfaces/adgprssimulator.h
 	simulator_interfaces/driver_file_writers/adgprsdriverfilewriter.h
 	simulator_interfaces/driver_file_writers/driver_parts/adgprs_driver_parts/adgprs_wellcontrols.h
@@ -15,6 +16,7 @@ SET(SIMULATION_HEADERS
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/compsegs.h
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/ecldriverpart.h
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_section.h
+	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_fragment_cache.h
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/wellcontrols.h
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/welsegs.h
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/welspecs.h
@@ -30,8 +32,11 @@ SET(SIMULATION_HEADERS
 	simulator_interfaces/eclsimulator.h
 	simulator_interfaces/flowsimulator.h
 	simulator_interfaces/ix_simulator.h
+	simulator_interfaces/restart_cache.h
+	simulator_interfaces/work_dir_manager.h
 	simulator_interfaces/simulator.h
 	simulator_interfaces/simulator_exceptions.h
+	simulator_interfaces/synthetic_simulator.h
 )
 
 SET(SIMULATION_SOURCES
@@ -46,6 +51,7 @@ SET(SIMULATION_SOURCES
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/compsegs.cpp
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/ecldriverpart.cpp
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_section.cpp
+	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_fragment_cache.cpp
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/wellcontrols.cpp
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/welsegs.cpp
 	simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/welspecs.cpp
@@ -57,17 +63,24 @@ SET(SIMULATION_SOURCES
 	simulator_interfaces/eclsimulator.cpp
 	simulator_interfaces/flowsimulator.cpp
 	simulator_interfaces/ix_simulator.cpp
+	simulator_interfaces/restart_cache.cpp
+	simulator_interfaces/work_dir_manager.cpp
 	simulator_interfaces/simulator.cpp
+	simulator_interfaces/synthetic_simulator.cpp
     results/json_results.cpp
+	results/synthetic_results.cpp
 )
 
 SET(SIMULATION_TESTS
 	tests/test_resource_results.h
+	tests/test_resource_synthetic_simulator.h
 	tests/results/test_adgprsresults.cpp
 	tests/results/test_eclresults.cpp
+	tests/results/test_synthetic_results.cpp
 	tests/simulator_interfaces/driver_file_writers/adgprs_driver_file_writer.cpp
 	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_compdat.cpp
 	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_schedule_section.cpp
+	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_schedule_fragment_cache.cpp
 	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_wellcontrols.cpp
 	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_welspecs.cpp
 	tests/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/test_schedule_inset.cpp
@@ -75,4 +88,7 @@ SET(SIMULATION_TESTS
 	tests/simulator_interfaces/test_adgprssimulator.cpp
 	tests/simulator_interfaces/test_eclsimulator.cpp
 	tests/simulator_interfaces/test_ix_simulator.cpp
+	tests/simulator_interfaces/test_restart_cache.cpp
+	tests/simulator_interfaces/test_synthetic_simulator.cpp
+	tests/simulator_interfaces/test_work_dir_manager.cpp
 )
@@ -4,6 +4,7 @@
 #include <boost/lexical_cast.hpp>
 #include <Utilities/verbosity.h>
 #include <Utilities/printer.hpp>
+#include <Utilities/trace.hpp>
 
 namespace Simulation {
 namespace Results {
@@ -16,6 +17,7 @@ ECLResults::ECLResults()
 
 void ECLResults::ReadResults(QString file_path)
 {
+    Utilities::Trace::Span span("sim.read_results");
     if (VERB_SIM >= 2) {
         Printer::ext_info("Attempting to read results from" + file_path.toStdString(), "Simulation", "ECLResults");
     }
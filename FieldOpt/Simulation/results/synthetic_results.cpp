@@ -0,0 +1,61 @@
+#include "synthetic_results.h"
+
+namespace Simulation {
+namespace Results {
+
+SyntheticResults::SyntheticResults()
+    : Results()
+{
+}
+
+void SyntheticResults::SetValueVectors(const std::map<Property, std::vector<double>> &values)
+{
+    values_ = values;
+    setAvailable();
+}
+
+void SyntheticResults::ReadResults(QString file_path)
+{
+    throw std::runtime_error("Synthetic results are computed by the SyntheticSimulator and can not be read from file.");
+}
+
+void SyntheticResults::DumpResults()
+{
+    values_.clear();
+    setUnavailable();
+}
+
+double SyntheticResults::GetValue(Results::Property prop)
+{
+    return GetValueVector(prop).back();
+}
+
+double SyntheticResults::GetValue(Results::Property prop, int time_index)
+{
+    auto values = GetValueVector(prop);
+    if (time_index < 0 || time_index >= (int)values.size())
+        throw ResultTimeIndexInvalidException(time_index);
+    return values[time_index];
+}
+
+double SyntheticResults::GetValue(Results::Property prop, QString well)
+{
+    throw std::runtime_error("Well properties are not available for synthetic results.");
+}
+
+double SyntheticResults::GetValue(Results::Property prop, QString well, int time_index)
+{
+    throw std::runtime_error("Well properties are not available for synthetic results.");
+}
+
+std::vector<double> SyntheticResults::GetValueVector(Results::Property prop)
+{
+    if (!isAvailable()) throw ResultsNotAvailableException();
+    auto it = values_.find(prop);
+    if (it == values_.end())
+        throw std::runtime_error("Property type not recognized by SyntheticResults::GetValueVector");
+    return it->second;
+}
+
+}
+}
@@ -0,0 +1,41 @@
+#ifndef SYNTHETIC_RESULTS_H
+#define SYNTHETIC_RESULTS_H
+
+#include "results.h"
+#include <map>
+
+namespace Simulation {
+namespace Results {
+
+/*!
+ * \brief The SyntheticResults class holds the field properties computed by the
+ * SyntheticSimulator. Nothing is read from file; the simulator sets the values
+ * directly with SetValueVectors.
+ */
+class SyntheticResults : public Results
+{
+ public:
+  SyntheticResults();
+
+  /*!
+   * \brief Set the value vectors (one value per report time) and mark the results as available.
+   */
+  void SetValueVectors(const std::map<Property, std::vector<double>> &values);
+
+  void ReadResults(QString file_path);
+  void DumpResults();
+
+  double GetValue(Property prop);
+  double GetValue(Property prop, int time_index);
+  double GetValue(Property prop, QString well);
+  double GetValue(Property prop, QString well, int time_index);
+  std::vector<double> GetValueVector(Property prop);
+
+ private:
+  std::map<Property, std::vector<double>> values_;
+};
+
+}
+}
+
+#endif // SYNTHETIC_RESULTS_H
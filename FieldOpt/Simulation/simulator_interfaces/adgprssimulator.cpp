@@ -98,7 +98,7 @@ bool AdgprsSimulator::Evaluate(int timeout, int threads) {
     std::cout << "Starting monitored simulation with timeout " << timeout << std::endl;
     bool success = ::Utilities::Unix::ExecShellScriptTimeout(
         QString::fromStdString(paths_.GetPath(Paths::SIM_EXEC_SCRIPT_FILE)),
-        script_args_, t);
+        script_args_, t, cancellation_check_);
     if (success) {
         paths_.SetPath(Paths::SIM_HDF5_FILE,
                        paths_.GetPath(Paths::SIM_WORK_DIR) + "/"
@@ -117,4 +117,13 @@ bool AdgprsSimulator::Evaluate(const Settings::Ensemble::Realization &realizatio
     throw std::runtime_error("Ensemble optimization not yet implemented for the AD-GPRS reservoir simulator.");
 }
 
+bool AdgprsSimulator::ReadPartialResults() {
+    try { // AD-GPRS may keep the summary locked until the simulation is done
+        results_->ReadResults(output_h5_summary_file_path_);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
 }
@@ -53,6 +53,7 @@ class AdgprsSimulator : public Simulator
   void CleanUp() override;
   bool Evaluate(int timeout, int threads=1) override;
   bool Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads=1) override;
+  bool ReadPartialResults() override;
 
  private:
   QString output_h5_summary_file_path_;
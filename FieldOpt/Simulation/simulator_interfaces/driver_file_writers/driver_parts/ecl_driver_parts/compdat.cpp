@@ -51,11 +51,14 @@ QString Compdat::GetPartString() const {
         return "";
     }
 
-    QString entries = head_ + "\n";
+    return head_ + "\n" + GetEntryString() + "\n" + foot_;
+}
+
+QString Compdat::GetEntryString() const {
+    QString entries = "";
     for (QStringList entry : entries_) {
         entries.append("    " + entry.join(" ") + " /\n");
     }
-    entries.append("\n" + foot_);
     return entries;
 }
 
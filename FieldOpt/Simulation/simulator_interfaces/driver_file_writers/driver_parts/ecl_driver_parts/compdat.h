@@ -52,6 +52,11 @@ class Compdat : public ECLDriverPart
 
   QString GetPartString() const;
 
+  /*!
+   * @brief Get the entry lines only, without the keyword and the terminator.
+   */
+  QString GetEntryString() const;
+
  private:
   QList<QStringList> createWellEntries(Model::Wells::Well *well);
   QStringList createBlockEntry(QString well_name, double wellbore_radius, Model::Wells::Wellbore::WellBlock *well_block);
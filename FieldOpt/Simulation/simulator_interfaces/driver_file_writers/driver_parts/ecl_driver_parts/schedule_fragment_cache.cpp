@@ -0,0 +1,57 @@
+/******************************************************************************
+ * This file is part of the FieldOpt project.
+ *
+ * Copyright (C) 2015-2019 Einar J.M. Baumann <einar.baumann@ntnu.no>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+ *****************************************************************************/
+
+#include "schedule_fragment_cache.h"
+
+namespace Simulation {
+namespace ECLDriverParts {
+
+QString ScheduleFragmentCache::Get(const QByteArray &key, const std::function<QString()> &build) {
+    if (key.isEmpty()) {
+        misses_++;
+        return build();
+    }
+    auto it = fragments_.find(key);
+    if (it != fragments_.end()) {
+        hits_++;
+        it->generation = generation_;
+        return it->text; // Implicitly shared; not copied
+    }
+    misses_++;
+    Fragment fragment;
+    fragment.text = build();
+    fragment.generation = generation_;
+    fragments_.insert(key, fragment);
+    return fragment.text;
+}
+
+void ScheduleFragmentCache::EndSchedule() {
+    for (auto it = fragments_.begin(); it != fragments_.end();) {
+        if (it->generation != generation_) {
+            it = fragments_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+}
+}
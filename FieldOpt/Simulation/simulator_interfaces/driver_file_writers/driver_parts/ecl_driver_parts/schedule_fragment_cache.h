@@ -0,0 +1,91 @@
+/******************************************************************************
+ * This file is part of the FieldOpt project.
+ *
+ * Copyright (C) 2015-2019 Einar J.M. Baumann <einar.baumann@ntnu.no>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+ *****************************************************************************/
+
+#ifndef SCHEDULE_FRAGMENT_CACHE_H
+#define SCHEDULE_FRAGMENT_CACHE_H
+
+#include <functional>
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+
+namespace Simulation {
+namespace ECLDriverParts {
+
+/*!
+ * \brief The ScheduleFragmentCache class keeps generated schedule text between
+ * cases, so that only the parts of the schedule whose inputs changed are rebuilt.
+ *
+ * Fragments are looked up by a key encoding everything the fragment depends on
+ * (see Schedule). Fragments not used by the latest schedule are dropped when it
+ * is finished, so the cache never holds more than one schedule.
+ */
+class ScheduleFragmentCache
+{
+ public:
+  /*!
+   * @brief Start generating a new schedule.
+   */
+  void BeginSchedule() { generation_++; }
+
+  /*!
+   * @brief Get the fragment for a key, building and storing it if it is not cached.
+   * @param key The fragment key. An empty key means the fragment can not be cached.
+   * @param build Function building the fragment.
+   */
+  QString Get(const QByteArray &key, const std::function<QString()> &build);
+
+  /*!
+   * @brief Finish the current schedule, dropping fragments it did not use.
+   */
+  void EndSchedule();
+
+  int hits() const { return hits_; }
+  int misses() const { return misses_; }
+  int size() const { return fragments_.size(); }
+
+  /*!
+   * @brief Helpers for building keys: append the raw bytes of a value or a
+   * terminated string.
+   */
+  template<typename T>
+  static void AppendToKey(QByteArray &key, const T &value) {
+      key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  static void AppendToKey(QByteArray &key, const QString &value) {
+      key.append(value.toUtf8());
+      key.append('\0');
+  }
+
+ private:
+  struct Fragment {
+    QString text;
+    int generation;
+  };
+  QHash<QByteArray, Fragment> fragments_;
+  int generation_ = 0;
+  int hits_ = 0;
+  int misses_ = 0;
+};
+
+}
+}
+
+#endif // SCHEDULE_FRAGMENT_CACHE_H
@@ -45,25 +45,174 @@ Schedule::Schedule(QList<Model::Wells::Well *> *wells, QList<int> control_times,
     }
 
     if (insets.HasInset(-1)) {
-        schedule_.append(QString::fromStdString(insets.GetInset(-1)));
+        preamble_ = QString::fromStdString(insets.GetInset(-1));
     }
     for (auto time_entry : schedule_time_entries_) {
-        schedule_.append(time_entry.welspecs.GetPartString());
-        if (insets.HasInset(time_entry.control_time)) {
-            schedule_.append(QString::fromStdString(insets.GetInset(time_entry.control_time)));
+        structure_fragments_.append(buildStructureFragment(time_entry, insets));
+        control_fragments_.append(time_entry.well_controls.GetPartString());
+    }
+}
+
+Schedule::Schedule(QList<Model::Wells::Well *> *wells, QList<int> control_times, ScheduleInsets &insets,
+                   ScheduleFragmentCache &cache)
+{
+    cache.BeginSchedule();
+    if (insets.HasInset(-1)) {
+        preamble_ = QString::fromStdString(insets.GetInset(-1));
+    }
+    for (int ts : control_times) {
+        QString welspecs = "";
+        QString compdat = "";
+        QString controls = "";
+        bool segmented = false;
+        for (auto well : *wells) {
+            QList<Model::Wells::Well *> single_well = {well};
+            if (well->controls()->first()->time_step() == ts) {
+                welspecs.append(cache.Get(welspecsKey(well, ts), [&]() {
+                    return Welspecs(&single_well, ts).GetEntryString();
+                }));
+                compdat.append(cache.Get(compdatKey(well, ts), [&]() {
+                    return Compdat(&single_well, ts).GetEntryString();
+                }));
+                segmented = segmented || well->IsSegmented();
+            }
+            controls.append(cache.Get(controlsKey(well, ts), [&]() {
+                return WellControls(&single_well, control_times, ts).GetWellEntryList().join("");
+            }));
+        }
+
+        QString fragment = keyword("WELSPECS", welspecs);
+        if (insets.HasInset(ts)) {
+            fragment.append(QString::fromStdString(insets.GetInset(ts)));
         }
-        schedule_.append(time_entry.compdat.GetPartString());
-        schedule_.append(time_entry.welsegs.GetPartString());
-        schedule_.append(time_entry.compsegs.GetPartString());
-        schedule_.append(time_entry.wsegvalv.GetPartString());
-        schedule_.append(time_entry.well_controls.GetPartString());
+        fragment.append(keyword("COMPDAT", compdat));
+        if (segmented) { // Segment keywords are not cached
+            fragment.append(Welsegs(wells, ts).GetPartString());
+            fragment.append(Compsegs(wells, ts).GetPartString());
+            fragment.append(Wsegvalv(wells, ts).GetPartString());
+        }
+        structure_fragments_.append(fragment);
+
+        // With no wells, only the time step to the next control time is generated
+        QList<Model::Wells::Well *> no_wells;
+        controls.append(WellControls(&no_wells, control_times, ts).GetPartString());
+        control_fragments_.append(controls);
     }
-    schedule_.append("\n\n");
+    cache.EndSchedule();
 }
 
 QString Schedule::GetPartString() const
 {
-    return schedule_;
+    QString schedule = preamble_;
+    for (int i = 0; i < structure_fragments_.size(); ++i) {
+        schedule.append(structure_fragments_[i]);
+        schedule.append(control_fragments_[i]);
+    }
+    schedule.append("\n\n");
+    return schedule;
+}
+
+void Schedule::Write(QTextStream &out) const
+{
+    out << preamble_;
+    for (int i = 0; i < structure_fragments_.size(); ++i) {
+        out << structure_fragments_[i] << control_fragments_[i];
+    }
+    out << "\n\n";
+}
+
+QStringList Schedule::GetTimeEntryStrings() const
+{
+    QStringList time_entry_strings;
+    for (int i = 0; i < structure_fragments_.size(); ++i) {
+        time_entry_strings.append(structure_fragments_[i] + control_fragments_[i]);
+    }
+    return time_entry_strings;
+}
+
+QString Schedule::GetStructureString() const
+{
+    return structure_fragments_.join("");
+}
+
+QString Schedule::buildStructureFragment(const ScheduleTimeEntry &time_entry, ScheduleInsets &insets) const
+{
+    QString fragment = "";
+    fragment.append(time_entry.welspecs.GetPartString());
+    if (insets.HasInset(time_entry.control_time)) {
+        fragment.append(QString::fromStdString(insets.GetInset(time_entry.control_time)));
+    }
+    fragment.append(time_entry.compdat.GetPartString());
+    fragment.append(time_entry.welsegs.GetPartString());
+    fragment.append(time_entry.compsegs.GetPartString());
+    fragment.append(time_entry.wsegvalv.GetPartString());
+    return fragment;
+}
+
+QString Schedule::keyword(const QString &name, const QString &entries)
+{
+    if (entries.isEmpty()) {
+        return "";
+    }
+    return name + "\n" + entries + "\n/\n\n";
+}
+
+QByteArray Schedule::welspecsKey(Model::Wells::Well *well, int ts)
+{
+    QByteArray key;
+    ScheduleFragmentCache::AppendToKey(key, 'W');
+    ScheduleFragmentCache::AppendToKey(key, ts);
+    ScheduleFragmentCache::AppendToKey(key, well->name());
+    ScheduleFragmentCache::AppendToKey(key, well->group());
+    ScheduleFragmentCache::AppendToKey(key, well->heel_i());
+    ScheduleFragmentCache::AppendToKey(key, well->heel_j());
+    ScheduleFragmentCache::AppendToKey(key, well->preferred_phase());
+    return key;
+}
+
+QByteArray Schedule::compdatKey(Model::Wells::Well *well, int ts)
+{
+    QByteArray key;
+    ScheduleFragmentCache::AppendToKey(key, 'C');
+    ScheduleFragmentCache::AppendToKey(key, ts);
+    ScheduleFragmentCache::AppendToKey(key, well->name());
+    ScheduleFragmentCache::AppendToKey(key, well->wellbore_radius());
+    for (auto block : *well->trajectory()->GetWellBlocks()) {
+        ScheduleFragmentCache::AppendToKey(key, block->i());
+        ScheduleFragmentCache::AppendToKey(key, block->j());
+        ScheduleFragmentCache::AppendToKey(key, block->k());
+        ScheduleFragmentCache::AppendToKey(key, block->directionOfPenetration());
+        bool perforated = block->HasPerforation();
+        ScheduleFragmentCache::AppendToKey(key, perforated);
+        if (perforated) {
+            ScheduleFragmentCache::AppendToKey(key, block->GetPerforation()->transmissibility_factor());
+        }
+    }
+    return key;
+}
+
+QByteArray Schedule::controlsKey(Model::Wells::Well *well, int ts)
+{
+    QByteArray key;
+    ScheduleFragmentCache::AppendToKey(key, 'P');
+    ScheduleFragmentCache::AppendToKey(key, ts);
+    ScheduleFragmentCache::AppendToKey(key, well->name());
+    ScheduleFragmentCache::AppendToKey(key, well->IsInjector());
+    for (auto control : *well->controls()) {
+        if (control->time_step() != ts) {
+            continue;
+        }
+        ScheduleFragmentCache::AppendToKey(key, control->open());
+        ScheduleFragmentCache::AppendToKey(key, control->mode());
+        ScheduleFragmentCache::AppendToKey(key, control->injection_fluid());
+        ScheduleFragmentCache::AppendToKey(key, control->bhp());
+        ScheduleFragmentCache::AppendToKey(key, control->liquidRate());
+        ScheduleFragmentCache::AppendToKey(key, control->oilRate());
+        ScheduleFragmentCache::AppendToKey(key, control->gasRate());
+        ScheduleFragmentCache::AppendToKey(key, control->waterRate());
+        ScheduleFragmentCache::AppendToKey(key, control->reservoirRate());
+    }
+    return key;
 }
 
 Schedule::ScheduleTimeEntry::ScheduleTimeEntry(int control_time,
@@ -30,7 +30,9 @@
 #include "compsegs.h"
 #include "wsegvalv.h"
 #include "schedule_insets.h"
+#include "schedule_fragment_cache.h"
 #include <QStringList>
+#include <QTextStream>
 
 namespace Simulation {
 namespace ECLDriverParts {
@@ -45,8 +47,34 @@ class Schedule : public ECLDriverPart
    * @param insets Text snippets to be inserted at specific time steps in the schedule.
    */
   Schedule(QList<Model::Wells::Well *> *wells, QList<int> control_times, ScheduleInsets &insets);
+
+  /*!
+   * @brief Constructor. Build the schedule from cached fragments where possible.
+   *
+   * The WELSPECS entry, the COMPDAT entries and the control entries are cached per
+   * well and control time, and concatenated into the keywords for each control time,
+   * so a case that changes one well only regenerates the text for that well. A
+   * fragment is only rebuilt if the inputs it is generated from changed since the
+   * previous schedule built with the same cache. The insets, the time steps and the
+   * segment keywords (WELSEGS, COMPSEGS, WSEGVALV) are always generated. The time
+   * entry list is not populated by this constructor.
+   */
+  Schedule(QList<Model::Wells::Well *> *wells, QList<int> control_times, ScheduleInsets &insets,
+           ScheduleFragmentCache &cache);
+
   QString GetPartString() const;
 
+  /*!
+   * @brief Write the schedule to a stream, fragment by fragment, without building
+   * the complete schedule string.
+   */
+  void Write(QTextStream &out) const;
+
+  /*!
+   * @brief Get the well structure fragments (everything but the well controls).
+   */
+  QString GetStructureString() const;
+
   struct ScheduleTimeEntry {
     ScheduleTimeEntry(int control_time,
                       Welspecs welspecs,
@@ -74,10 +102,33 @@ class Schedule : public ECLDriverPart
    */
   QList<ScheduleTimeEntry> schedule_time_entries_;
 
-  QString schedule_;
+  QString preamble_; //!< The inset preceding the first control time.
+  QStringList structure_fragments_; //!< Well structure keywords for each control time.
+  QStringList control_fragments_; //!< Well controls and time step for each control time.
+
+  QString buildStructureFragment(const ScheduleTimeEntry &time_entry, ScheduleInsets &insets) const;
+
+  /*!
+   * @brief Wrap entry lines in a keyword. Returns an empty string if there are no entries.
+   */
+  static QString keyword(const QString &name, const QString &entries);
+
+  /*!
+   * @brief Keys identifying the inputs of the fragments for a well at a control time.
+   */
+  static QByteArray welspecsKey(Model::Wells::Well *well, int ts);
+  static QByteArray compdatKey(Model::Wells::Well *well, int ts);
+  static QByteArray controlsKey(Model::Wells::Well *well, int ts);
 
  public:
   QList<ScheduleTimeEntry> GetScheduleTimeEntries() { return schedule_time_entries_; }
+
+  /*!
+   * @brief Get the schedule text written for each control time, in order. Entry k
+   * holds the keywords for control time k and the time step to control time k+1;
+   * the text preceding the first entry (the -1 inset) is not included.
+   */
+  QStringList GetTimeEntryStrings() const;
 };
 
 }
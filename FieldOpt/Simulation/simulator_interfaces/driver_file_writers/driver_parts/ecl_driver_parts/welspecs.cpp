@@ -51,11 +51,14 @@ QString Welspecs::GetPartString() const {
         return "";
     }
 
-    QString entries = head_ + "\n";
+    return head_ + "\n" + GetEntryString() + "\n" + foot_;
+}
+
+QString Welspecs::GetEntryString() const {
+    QString entries = "";
     for (QStringList entry : entries_) {
         entries.append("    " + entry.join(" ") + " /\n");
     }
-    entries.append("\n" + foot_);
     return entries;
 }
 
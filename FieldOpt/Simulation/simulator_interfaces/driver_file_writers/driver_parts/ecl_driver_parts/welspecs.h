@@ -55,6 +55,11 @@ class Welspecs : public ECLDriverPart
 
   QString GetPartString() const;
 
+  /*!
+   * @brief Get the entry lines only, without the keyword and the terminator.
+   */
+  QString GetEntryString() const;
+
  private:
   QStringList createWellEntry(::Model::Wells::Well *well);
 };
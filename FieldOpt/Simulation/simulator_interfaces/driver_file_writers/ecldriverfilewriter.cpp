@@ -23,6 +23,7 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
  *****************************************************************************/
 
+#include <QFile>
 #include <Utilities/printer.hpp>
 #include "ecldriverfilewriter.h"
 #include "driver_parts/ecl_driver_parts/schedule_section.h"
@@ -55,10 +56,41 @@ void EclDriverFileWriter::WriteDriverFile(QString schedule_file_path)
     }
     assert(FileExists(schedule_file_path));
 
+    time_entry_strings_.clear();
+    report_steps_match_controls_ = false;
     if (use_actionx_ == false) {
-        Schedule schedule = ECLDriverParts::Schedule(model_->wells(), settings_->model()->control_times(), insets_);
-        model_->SetCompdatString(schedule.GetPartString());
-        Utilities::FileHandling::WriteStringToFile(schedule.GetPartString(), schedule_file_path);
+        QList<int> control_times = settings_->model()->control_times();
+        Schedule schedule = fragment_cache_ == nullptr
+                            ? ECLDriverParts::Schedule(model_->wells(), control_times, insets_)
+                            : ECLDriverParts::Schedule(model_->wells(), control_times, insets_, *fragment_cache_);
+        model_->SetCompdatString(schedule.GetStructureString());
+
+        if (write_restarts_) { // Needed by the restart cache
+            time_entry_strings_ = schedule.GetTimeEntryStrings();
+            if (insets_.HasInset(-1) && !time_entry_strings_.empty()) {
+                time_entry_strings_[0].prepend(QString::fromStdString(insets_.GetInset(-1)));
+            }
+            int time_steps = 0;
+            bool has_dates = false;
+            for (const QString &entry : time_entry_strings_) {
+                time_steps += entry.count("TSTEP");
+                has_dates = has_dates || entry.contains("DATES");
+            }
+            report_steps_match_controls_ = !control_times.empty() && control_times.first() == 0
+                && !has_dates && time_steps == control_times.size() - 1;
+        }
+
+        QFile file(schedule_file_path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            throw std::runtime_error("Unable to open schedule file for writing: " + schedule_file_path.toStdString());
+        }
+        QTextStream out(&file);
+        if (write_restarts_) {
+            out << "RPTRST\n 'BASIC=2' /\n\n";
+        }
+        schedule.Write(out);
+        out << endl;
+        file.close();
     }
     else {
         Utilities::FileHandling::WriteStringToFile(QString::fromStdString(buildActionStrings()), schedule_file_path);
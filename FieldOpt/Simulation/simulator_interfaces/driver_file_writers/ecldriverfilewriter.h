@@ -30,6 +30,7 @@
 #include "Settings/simulator.h"
 #include "Model/model.h"
 #include "driver_parts/ecl_driver_parts/schedule_insets.h"
+#include "driver_parts/ecl_driver_parts/schedule_fragment_cache.h"
 
 namespace Simulation {
     class ECLSimulator;
@@ -50,10 +51,41 @@ private:
     void WriteDriverFile(QString schedule_file_path);
     std::string buildActionStrings();
 
+    /*!
+     * @brief Request a restart file at every report step (RPTRST BASIC=2) from the
+     * schedules written after this call. Used to populate the restart cache.
+     */
+    void SetWriteRestarts(bool write_restarts) { write_restarts_ = write_restarts; }
+
+    /*!
+     * @brief Reuse the schedule fragments generated for earlier cases. The cache is
+     * owned by the simulator, which outlives the writer.
+     */
+    void SetFragmentCache(ECLDriverParts::ScheduleFragmentCache *cache) { fragment_cache_ = cache; }
+
+    /*!
+     * @brief Get the text written for each control time by the last call to
+     * WriteDriverFile. Text written ahead of the first control time is included in
+     * the first entry. Only set when restarts are written.
+     */
+    QStringList GetTimeEntryStrings() const { return time_entry_strings_; }
+
+    /*!
+     * @brief Check whether report step k+1 of the last written schedule is the end
+     * of control interval k, i.e. whether the schedule may be restarted at
+     * control times. This is not the case if insets add time steps of their own.
+     * Only checked when restarts are written.
+     */
+    bool ReportStepsMatchControlTimes() const { return report_steps_match_controls_; }
+
     Model::Model *model_;
     ::Settings::Settings *settings_;
     ECLDriverParts::ScheduleInsets insets_;
     bool use_actionx_;
+    bool write_restarts_ = false;
+    ECLDriverParts::ScheduleFragmentCache *fragment_cache_ = nullptr;
+    bool report_steps_match_controls_ = false;
+    QStringList time_entry_strings_;
 };
 
 }
@@ -17,9 +17,11 @@
    along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
 ******************************************************************************/
 #include <iostream>
+#include <unistd.h>
 #include <boost/algorithm/string.hpp>
 #include <Utilities/printer.hpp>
 #include <Utilities/verbosity.h>
+#include <Utilities/trace.hpp>
 #include "eclsimulator.h"
 #include "Utilities/execution.hpp"
 #include "simulator_exceptions.h"
@@ -51,10 +53,9 @@ void ECLSimulator::Evaluate()
     copyDriverFiles();
     if (VERB_SIM >= 2) { Printer::info("Updating file paths."); }
     UpdateFilePaths();
-    script_args_ = (QStringList() << QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR)) << deck_name_);
-    auto driver_file_writer = EclDriverFileWriter(settings_, model_);
     if (VERB_SIM >= 2) { Printer::info("Writing schedule."); }
-    driver_file_writer.WriteDriverFile(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_SCH_FILE)));
+    writeDriverFiles();
+    script_args_ = (QStringList() << QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR)) << run_deck_name_);
     if (VERB_SIM >= 2) { Printer::info("Starting unmonitored simulation."); }
     Utilities::Unix::ExecShellScript(
         QString::fromStdString(paths_.GetPath(Paths::SIM_EXEC_SCRIPT_FILE)),
@@ -62,16 +63,17 @@ void ECLSimulator::Evaluate()
     );
     if (VERB_SIM >= 2) { Printer::info("Unmonitored simulation done. Reading results."); }
     PostSimWork();
-    results_->ReadResults(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_DRIVER_FILE)));
+    results_->ReadResults(runDriverFilePath());
+    cacheRestart();
+    releaseWorkDir();
     updateResultsInModel();
 }
 
 bool ECLSimulator::Evaluate(int timeout, int threads) {
     copyDriverFiles();
     UpdateFilePaths();
-    script_args_ = (QStringList() << QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR)) << deck_name_ << QString::number(threads));
-    auto driver_file_writer = EclDriverFileWriter(settings_, model_);
-    driver_file_writer.WriteDriverFile(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_SCH_FILE)));
+    writeDriverFiles();
+    script_args_ = (QStringList() << QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR)) << run_deck_name_ << QString::number(threads));
     int t = timeout;
     if (timeout < 10) {
         t = 10; // Always let simulations run for at least 10 seconds
@@ -82,26 +84,32 @@ bool ECLSimulator::Evaluate(int timeout, int threads) {
     }
     bool success = ::Utilities::Unix::ExecShellScriptTimeout(
         QString::fromStdString(paths_.GetPath(Paths::SIM_EXEC_SCRIPT_FILE)),
-        script_args_, t);
+        script_args_, t, cancellation_check_);
     if (VERB_SIM >= 2) Printer::info("Monitored simulation done.");
     if (success) {
         if (VERB_SIM >= 2) Printer::info("Simulation successful. Reading results.");
         PostSimWork();
         results_->DumpResults();
-        results_->ReadResults(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_DRIVER_FILE)));
+        results_->ReadResults(runDriverFilePath());
+        cacheRestart();
     }
+    releaseWorkDir();
     updateResultsInModel();
     return success;
 }
 
 bool ECLSimulator::Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads) {
+    SetRealization(realization);
+    return Evaluate(timeout, threads);
+}
+
+void ECLSimulator::SetRealization(const Settings::Ensemble::Realization &realization) {
     driver_file_name_ = QString::fromStdString(FileName(realization.data()));
     driver_parent_dir_name_ = QString::fromStdString(ParentDirectoryName(realization.data()));
     deck_name_ = driver_file_name_.split(".").first();
     paths_.SetPath(Paths::SIM_DRIVER_FILE, realization.data());
     paths_.SetPath(Paths::SIM_DRIVER_DIR , GetParentDirectoryPath(realization.data()));
     paths_.SetPath(Paths::SIM_SCH_FILE   , realization.schedule());
-    return Evaluate(timeout, threads);
 }
 
 void ECLSimulator::CleanUp()
@@ -113,13 +121,20 @@ void ECLSimulator::CleanUp()
     QString base_file_path = QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_DRIVER_FILE)).split(".DATA").first();
 
     for (QString ending : file_endings_to_delete) {
-        DeleteFile(base_file_path + "." + ending);
+        for (QString file_path : {base_file_path + "." + ending, base_file_path + "_RST." + ending}) {
+            if (FileExists(file_path)) DeleteFile(file_path);
+        }
     }
 }
 
 void ECLSimulator::UpdateFilePaths()
 {
-    paths_.SetPath(Paths::SIM_WORK_DIR,        paths_.GetPath(Paths::OUTPUT_DIR) + "/" + driver_parent_dir_name_.toStdString());
+    if (case_work_dir_.empty()) {
+        paths_.SetPath(Paths::SIM_WORK_DIR, paths_.GetPath(Paths::OUTPUT_DIR) + "/" + driver_parent_dir_name_.toStdString());
+    }
+    else {
+        paths_.SetPath(Paths::SIM_WORK_DIR, case_work_dir_);
+    }
     paths_.SetPath(Paths::SIM_OUT_DRIVER_FILE, paths_.GetPath(Paths::SIM_WORK_DIR) + "/" + driver_file_name_.toStdString());
 
     std::string tmp = paths_.GetPath(Paths::SIM_SCH_FILE);
@@ -130,13 +145,16 @@ void ECLSimulator::UpdateFilePaths()
 void ECLSimulator::WriteDriverFilesOnly() {
     UpdateFilePaths();
     auto driver_file_writer = EclDriverFileWriter(settings_, model_);
+    driver_file_writer.SetFragmentCache(&schedule_fragments_);
     driver_file_writer.WriteDriverFile(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_SCH_FILE)));
 }
 
 void ECLSimulator::copyDriverFiles() {
+    Utilities::Trace::Span span("sim.prepare_work_dir");
     std::string workdir = paths_.GetPath(Paths::OUTPUT_DIR) + "/" + driver_parent_dir_name_.toStdString();
+    auto &work_dir_settings = settings_->simulator()->work_directories();
 
-    if (!DirectoryExists(workdir)) {
+    if (!work_dir_settings.per_case && !DirectoryExists(workdir)) {
         if (VERB_SIM >= 1) {
             Printer::ext_info("Output deck directory not found. Copying input deck:"
             + paths_.GetPath(Paths::SIM_DRIVER_DIR) + " -> " + workdir, "Simulation", "ECLSimulator" );
@@ -155,6 +173,27 @@ void ECLSimulator::copyDriverFiles() {
             CopyDirectory(paths_.GetPath(Paths::SIM_AUX_DIR), auxdir, false);
         }
     }
+
+    if (work_dir_settings.per_case) {
+        QString deck_dir = QString::fromStdString(paths_.GetPath(Paths::SIM_DRIVER_DIR));
+        if (!work_dir_managers_.contains(deck_dir)) {
+            std::string case_root = paths_.GetPath(Paths::OUTPUT_DIR) + "/cases";
+            if (!work_dir_settings.root.empty()) { // Shared between ranks on the node
+                case_root = work_dir_settings.root + "/fieldopt_" + std::to_string(getpid());
+            }
+            auto manager = new WorkDirManager(deck_dir.toStdString(), case_root, work_dir_settings.link);
+            std::string schedule_file = paths_.GetPath(Paths::SIM_SCH_FILE);
+            boost::algorithm::replace_first(schedule_file, paths_.GetPath(Paths::SIM_DRIVER_DIR) + "/", "");
+            manager->SetFreshFiles({schedule_file});
+            manager->SetOutputStem(deck_name_.toStdString());
+            if (paths_.IsSet(Paths::SIM_AUX_DIR)) {
+                manager->SetAuxDirectory(paths_.GetPath(Paths::OUTPUT_DIR) + "/" + FileName(paths_.GetPath(Paths::SIM_AUX_DIR)));
+            }
+            work_dir_managers_[deck_dir] = manager;
+        }
+        workdir = work_dir_managers_[deck_dir]->Materialize();
+        case_work_dir_ = workdir;
+    }
     paths_.SetPath(Paths::SIM_WORK_DIR, workdir);
     if (VERB_SIM >= 2) {
         Printer::ext_info("Done copying directories. Set working directory to: " + workdir,
@@ -163,4 +202,92 @@ void ECLSimulator::copyDriverFiles() {
     }
 }
 
+bool ECLSimulator::ReadPartialResults() {
+    try {
+        results_->ReadResults(runDriverFilePath());
+        return true;
+    } catch (...) { // The summary may not have been written yet
+        return false;
+    }
+}
+
+void ECLSimulator::writeDriverFiles() {
+    Utilities::Trace::Span span("sim.write_driver");
+    auto &cache_settings = settings_->simulator()->restart_cache();
+    run_deck_name_ = deck_name_;
+    prefix_hashes_.clear();
+
+    auto driver_file_writer = EclDriverFileWriter(settings_, model_);
+    driver_file_writer.SetWriteRestarts(cache_settings.enabled);
+    driver_file_writer.SetFragmentCache(&schedule_fragments_);
+    driver_file_writer.WriteDriverFile(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_SCH_FILE)));
+    if (!cache_settings.enabled || !driver_file_writer.ReportStepsMatchControlTimes()) {
+        return;
+    }
+
+    QString work_dir = QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR));
+    QString cache_dir = restartCacheDir();
+    if (!restart_caches_.contains(cache_dir)) {
+        restart_caches_[cache_dir] = new RestartCache(cache_dir, cache_settings.max_entries);
+    }
+    // Seeded with the input deck rather than the work directory, which differs between cases
+    prefix_hashes_ = RestartCache::PrefixHashes(driver_file_writer.GetTimeEntryStrings(),
+                                                QString::fromStdString(paths_.GetPath(Paths::SIM_DRIVER_FILE)));
+
+    auto entry = restart_caches_[cache_dir]->Lookup(prefix_hashes_, work_dir);
+    if (!entry.found) {
+        return;
+    }
+    QStringList *deck_lines = ReadFileToStringList(QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_DRIVER_FILE)));
+    QStringList restart_deck = RestartCache::RestartDeck(*deck_lines, entry.root, entry.report_step);
+    delete deck_lines;
+    if (restart_deck.empty()) {
+        if (VERB_SIM >= 1) {
+            Printer::ext_warn("SOLUTION or SCHEDULE section not found in deck. Running full simulation.",
+                              "Simulation", "ECLSimulator");
+        }
+        return;
+    }
+    run_deck_name_ = deck_name_ + "_RST";
+    WriteStringToFile(restart_deck.join("\n") + "\n", work_dir + "/" + run_deck_name_ + ".DATA");
+    if (VERB_SIM >= 2) {
+        Printer::ext_info("Restarting from " + entry.root.toStdString() + " at report step "
+                              + Printer::num2str(entry.report_step), "Simulation", "ECLSimulator");
+    }
+}
+
+void ECLSimulator::cacheRestart() {
+    if (prefix_hashes_.empty() || run_deck_name_ != deck_name_) {
+        return; // Restarted runs only hold the tail of the schedule
+    }
+    QString work_dir = QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR));
+    restart_caches_[restartCacheDir()]->Store(prefix_hashes_, work_dir + "/" + deck_name_);
+}
+
+void ECLSimulator::releaseWorkDir() {
+    if (case_work_dir_.empty()) {
+        return;
+    }
+    if (!settings_->simulator()->work_directories().keep_case_directories) {
+        QString deck_dir = QString::fromStdString(paths_.GetPath(Paths::SIM_DRIVER_DIR));
+        work_dir_managers_[deck_dir]->Release(case_work_dir_);
+    }
+    case_work_dir_ = "";
+}
+
+QString ECLSimulator::restartCacheDir() {
+    QString deck_dir = QString::fromStdString(paths_.GetPath(Paths::SIM_DRIVER_DIR));
+    if (work_dir_managers_.contains(deck_dir)) {
+        return QString::fromStdString(work_dir_managers_[deck_dir]->case_root());
+    }
+    return QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR));
+}
+
+QString ECLSimulator::runDriverFilePath() {
+    if (run_deck_name_.isEmpty() || run_deck_name_ == deck_name_) {
+        return QString::fromStdString(paths_.GetPath(Paths::SIM_OUT_DRIVER_FILE));
+    }
+    return QString::fromStdString(paths_.GetPath(Paths::SIM_WORK_DIR)) + "/" + run_deck_name_ + ".DATA";
+}
+
 }
@@ -20,9 +20,12 @@
 #define ECLSIMULATOR_H
 
 #include "simulator.h"
+#include "restart_cache.h"
+#include "work_dir_manager.h"
 #include "driver_file_writers/ecldriverfilewriter.h"
 #include "Model/model.h"
 #include <QStringList>
+#include <QHash>
 
 namespace Simulation {
 
@@ -53,6 +56,8 @@ class ECLSimulator : public Simulator
   void Evaluate() override;
   bool Evaluate(int timeout, int threads=1) override;
   bool Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads=1) override;
+  bool ReadPartialResults() override;
+  void SetRealization(const Settings::Ensemble::Realization &realization) override;
 
   void WriteDriverFilesOnly() override;
   /*!
@@ -63,9 +68,45 @@ class ECLSimulator : public Simulator
 
  private:
   QString deck_name_; //!< Driver file name without the final .DATA
+  QString run_deck_name_; //!< Name of the deck executed by the last evaluation; deck_name_ unless restarted.
   Settings::Settings *settings_;
+  QHash<QString, RestartCache *> restart_caches_; //!< Restart cache for each work directory.
+  QStringList prefix_hashes_; //!< Prefix hashes of the last written schedule.
+  ECLDriverParts::ScheduleFragmentCache schedule_fragments_; //!< Schedule text reused between cases.
+  QHash<QString, WorkDirManager *> work_dir_managers_; //!< Per-case work directory manager for each input deck directory.
+  std::string case_work_dir_; //!< Work directory of the current case when using per-case work directories.
+
+  /*!
+   * \brief Set up the work directory: either the shared copy of the deck directory,
+   * or a new case directory when per-case work directories are enabled.
+   */
   void copyDriverFiles();
 
+  /*!
+   * \brief Delete the current case directory, unless the case directories are to be kept.
+   */
+  void releaseWorkDir();
+
+  /*!
+   * \brief Directory the restart cache is kept in: the work directory, or the case root
+   * when using per-case work directories.
+   */
+  QString restartCacheDir();
+
+  /*!
+   * \brief Write the schedule. When the restart cache is enabled, restart output is
+   * requested and, if the cache holds a simulation sharing the first control steps
+   * with this one, a restart deck is written and run_deck_name_ set to it.
+   */
+  void writeDriverFiles();
+
+  /*!
+   * \brief Add the last evaluation to the restart cache if it was a full simulation.
+   */
+  void cacheRestart();
+
+  QString runDriverFilePath();
+
   // Simulator interface
  protected:
   void UpdateFilePaths() override;
@@ -100,7 +100,7 @@ bool FlowSimulator::Evaluate(int timeout, int threads) {
     std::cout << "Starting monitored simulation with timeout " << timeout << std::endl;
     bool success = ::Utilities::Unix::ExecShellScriptTimeout(
         QString::fromStdString(paths_.GetPath(Paths::SIM_EXEC_SCRIPT_FILE)),
-        script_args_, t);
+        script_args_, t, cancellation_check_);
     if (success) {
         results_->ReadResults(driver_file_writer_->output_driver_file_name_);
     }
@@ -113,4 +113,12 @@ void FlowSimulator::WriteDriverFilesOnly() {
 bool FlowSimulator::Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads) {
     throw std::runtime_error("Ensemble optimization not yet implemented for the FLOW reservoir simulator.");
 }
+bool FlowSimulator::ReadPartialResults() {
+    try {
+        results_->ReadResults(driver_file_writer_->output_driver_file_name_);
+        return true;
+    } catch (...) { // The summary may not have been written yet
+        return false;
+    }
+}
 }
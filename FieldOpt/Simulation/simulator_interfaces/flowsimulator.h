@@ -31,6 +31,7 @@ class FlowSimulator : public Simulator {
   void Evaluate() override;
   bool Evaluate(int timeout, int threads=1) override;
   bool Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads=1) override;
+  bool ReadPartialResults() override;
   void WriteDriverFilesOnly() override;
   void CleanUp() override;
   void UpdateFilePaths() override;
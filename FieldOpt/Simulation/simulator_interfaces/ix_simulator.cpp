@@ -73,7 +73,7 @@ bool IXSimulator::Evaluate(int timeout, int threads) {
     if (VERB_SIM >= 1) { Printer::info("Starting monitored simulation with timeout."); }
     bool success = ::Utilities::Unix::ExecShellScriptTimeout(
         QString::fromStdString(paths_.GetPath(Paths::SIM_EXEC_SCRIPT_FILE)),
-        script_args_, t);
+        script_args_, t, cancellation_check_);
     if (success) {
         results_->DumpResults();
         if (result_path_.size() == 0) {
@@ -0,0 +1,160 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <QCryptographicHash>
+#include <QDir>
+#include <Utilities/printer.hpp>
+#include <Utilities/verbosity.h>
+#include "restart_cache.h"
+#include "Utilities/filehandling.hpp"
+
+namespace Simulation {
+
+using namespace Utilities::FileHandling;
+
+RestartCache::RestartCache(const QString &cache_dir, int max_entries) {
+    cache_dir_ = cache_dir;
+    max_entries_ = max_entries;
+    next_slot_ = 0;
+}
+
+QStringList RestartCache::PrefixHashes(const QStringList &time_entries, const QString &seed) {
+    QStringList hashes;
+    QByteArray previous = seed.toUtf8();
+    for (const QString &entry : time_entries) {
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(previous);
+        hash.addData(entry.toUtf8());
+        previous = hash.result().toHex();
+        hashes.append(QString::fromLatin1(previous));
+    }
+    return hashes;
+}
+
+QStringList RestartCache::RestartDeck(const QStringList &deck_lines, const QString &root, int report_step) {
+    QStringList restart_deck;
+    bool in_solution = false;
+    bool found_solution = false;
+    bool found_schedule = false;
+    for (const QString &line : deck_lines) {
+        QString keyword = line.split("--").first().trimmed();
+        if (in_solution && (keyword == "SUMMARY" || keyword == "SCHEDULE")) {
+            in_solution = false;
+        }
+        if (in_solution) {
+            continue;
+        }
+        restart_deck.append(line);
+        if (keyword == "SOLUTION") {
+            in_solution = true;
+            found_solution = true;
+            restart_deck.append("RESTART");
+            restart_deck.append(QString(" '%1' %2 /").arg(root).arg(report_step));
+            restart_deck.append("");
+        }
+        else if (keyword == "SCHEDULE") {
+            found_schedule = true;
+            restart_deck.append("SKIPREST");
+            restart_deck.append("");
+        }
+    }
+    if (!found_solution || !found_schedule) {
+        return QStringList();
+    }
+    return restart_deck;
+}
+
+RestartCache::Entry RestartCache::Lookup(const QStringList &prefix_hashes, const QString &run_dir) {
+    Entry entry;
+    for (int k = prefix_hashes.size() - 1; k >= 0; --k) {
+        if (index_.contains(prefix_hashes[k])) {
+            auto slot_step = index_[prefix_hashes[k]];
+            entry.found = true;
+            // Relative to stay within the 72 character limit on restart roots.
+            entry.root = QDir(run_dir).relativeFilePath(cache_dir_ + "/" + slotRoot(slot_step.first));
+            entry.report_step = slot_step.second;
+            touch(slot_step.first);
+            break;
+        }
+    }
+    return entry;
+}
+
+void RestartCache::Store(const QStringList &prefix_hashes, const QString &case_path) {
+    if (prefix_hashes.size() < 2) {
+        return; // Nothing to restart from
+    }
+    if (!FileExists(case_path + ".UNRST") || !FileExists(case_path + ".SMSPEC") || !FileExists(case_path + ".UNSMRY")) {
+        if (VERB_SIM >= 1) {
+            Printer::ext_warn("Unified restart and summary files not found; not caching " + case_path.toStdString(),
+                              "Simulation", "RestartCache");
+        }
+        return;
+    }
+
+    int slot;
+    if (slot_hashes_.size() < max_entries_) {
+        slot = next_slot_++;
+    }
+    else {
+        slot = lru_.first();
+        evict(slot);
+    }
+
+    CreateDirectory(cache_dir_ + "/restart_cache");
+    CreateDirectory(cache_dir_ + "/restart_cache/" + QString::number(slot));
+    QString destination = cache_dir_ + "/" + slotRoot(slot);
+    for (QString ending : {"UNRST", "SMSPEC", "UNSMRY"}) {
+        CopyFile(case_path + "." + ending, destination + "." + ending, true);
+    }
+
+    // The last control time has no time step after it, so there is nothing to restart from there.
+    QStringList hashes;
+    for (int k = 0; k < prefix_hashes.size() - 1; ++k) {
+        if (index_.contains(prefix_hashes[k])) {
+            slot_hashes_[index_[prefix_hashes[k]].first].removeAll(prefix_hashes[k]);
+        }
+        index_[prefix_hashes[k]] = qMakePair(slot, k + 1);
+        hashes.append(prefix_hashes[k]);
+    }
+    slot_hashes_[slot] = hashes;
+    touch(slot);
+    if (VERB_SIM >= 2) {
+        Printer::ext_info("Cached restart of " + case_path.toStdString() + " in slot " + Printer::num2str(slot),
+                          "Simulation", "RestartCache");
+    }
+}
+
+QString RestartCache::slotRoot(int slot) const {
+    return "restart_cache/" + QString::number(slot) + "/BASE";
+}
+
+void RestartCache::touch(int slot) {
+    lru_.removeAll(slot);
+    lru_.append(slot);
+}
+
+void RestartCache::evict(int slot) {
+    for (const QString &hash : slot_hashes_[slot]) {
+        index_.remove(hash);
+    }
+    slot_hashes_.remove(slot);
+    lru_.removeAll(slot);
+}
+
+}
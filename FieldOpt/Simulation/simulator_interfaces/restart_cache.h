@@ -0,0 +1,107 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef RESTART_CACHE_H
+#define RESTART_CACHE_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QList>
+#include <QPair>
+
+namespace Simulation {
+
+/*!
+ * \brief The RestartCache class keeps the restart and summary files of recent
+ * simulations, indexed by the schedule they were run with, so that cases sharing
+ * the first control steps with one of them can be restarted instead of simulated
+ * from the start.
+ *
+ * A schedule is identified by its prefix hashes: hash k covers the schedule text
+ * of control times 0 through k. If a new case has the same hash k as a cached
+ * simulation, the two are identical up to report step k+1, and the case can be
+ * restarted from that report step.
+ *
+ * Cached simulations are stored in numbered slots below the cache directory. The
+ * least recently used slot is overwritten when the cache is full.
+ */
+class RestartCache
+{
+ public:
+  /*!
+   * @brief A restart point found in the cache.
+   */
+  struct Entry {
+    bool found = false;
+    QString root; //!< Path of the cached case (without extension), relative to the run directory.
+    int report_step = 0; //!< The report step to restart from.
+  };
+
+  /*!
+   * @param cache_dir Directory to keep the cache in, in a restart_cache subdirectory.
+   * This is the work directory, or the case root when each case has its own directory.
+   * @param max_entries Maximum number of simulations to keep.
+   */
+  RestartCache(const QString &cache_dir, int max_entries);
+
+  /*!
+   * @brief Compute the prefix hashes of a schedule.
+   * @param time_entries Schedule text for each control time.
+   * @param seed Text identifying everything else the simulation depends on (e.g. the deck path).
+   */
+  static QStringList PrefixHashes(const QStringList &time_entries, const QString &seed);
+
+  /*!
+   * @brief Create a restart deck from a full deck: the SOLUTION section is replaced
+   * with a RESTART keyword and SKIPREST is added to the SCHEDULE section.
+   * @return The restart deck, or an empty list if the sections could not be found.
+   */
+  static QStringList RestartDeck(const QStringList &deck_lines, const QString &root, int report_step);
+
+  /*!
+   * @brief Find the latest restart point shared with a cached simulation.
+   * @param run_dir Directory the restart deck will be run in.
+   */
+  Entry Lookup(const QStringList &prefix_hashes, const QString &run_dir);
+
+  /*!
+   * @brief Copy the restart and summary files of a finished full simulation into the cache.
+   * @param prefix_hashes Prefix hashes of the schedule the simulation was run with.
+   * @param case_path Path of the simulated case without extension.
+   */
+  void Store(const QStringList &prefix_hashes, const QString &case_path);
+
+  int size() const { return slot_hashes_.size(); }
+
+ private:
+  QString cache_dir_;
+  int max_entries_;
+  int next_slot_;
+  QHash<QString, QPair<int, int>> index_; //!< Prefix hash -> (slot, report step).
+  QHash<int, QStringList> slot_hashes_; //!< Hashes pointing to each slot.
+  QList<int> lru_; //!< Slots, least recently used first.
+
+  QString slotRoot(int slot) const;
+  void touch(int slot);
+  void evict(int slot);
+};
+
+}
+
+#endif // RESTART_CACHE_H
@@ -29,17 +29,18 @@ Simulator::Simulator(Settings::Settings *settings) {
     settings_ = settings;
     paths_ = settings_->paths();
 
-    if (!paths_.IsSet(Paths::ENSEMBLE_FILE)) { // single realization
+    if (!paths_.IsSet(Paths::ENSEMBLE_FILE) && paths_.IsSet(Paths::SIM_DRIVER_FILE)) { // single realization
         driver_file_name_ = QString::fromStdString(FileName(paths_.GetPath(Paths::SIM_DRIVER_FILE)));
         driver_parent_dir_name_ = QString::fromStdString(ParentDirectoryName(paths_.GetPath(Paths::SIM_DRIVER_FILE)));
     }
-    else { // multiple realizations
+    else { // multiple realizations, or a simulator without a deck
         driver_file_name_ = "";
         driver_parent_dir_name_ = "";
     }
 
     // Use custom execution script if provided in runtime settings, else use the one from json driver file
-    if (!paths_.IsSet(Paths::SIM_EXEC_SCRIPT_FILE)) {
+    if (!paths_.IsSet(Paths::SIM_EXEC_SCRIPT_FILE)
+        && settings->simulator()->type() != Settings::Simulator::SimulatorType::Synthetic) {
         std::string exec_script_path = paths_.GetPath(Paths::BUILD_DIR)
                                        + ExecutionScripts::GetScriptPath(settings->simulator()->script_name()).toStdString();
         paths_.SetPath(Paths::SIM_EXEC_SCRIPT_FILE, exec_script_path);
@@ -81,6 +82,14 @@ void Simulator::SetVerbosityLevel(int level) {
     verbosity_level_ = level;
 }
 
+void Simulator::SetRealization(const Settings::Ensemble::Realization &realization) {
+    throw std::runtime_error("Selecting a realization deck is not supported by this simulator interface.");
+}
+
+bool Simulator::ReadPartialResults() {
+    return false;
+}
+
 void Simulator::updateResultsInModel() {
     model_->SetResult("Time", results_->GetValueVector(Results::Results::Property::Time));
     model_->SetResult("FGPT", results_->GetValueVector(Results::Results::Property::CumulativeGasProduction));
@@ -20,6 +20,7 @@
 #define SIMULATOR
 
 #include <QString>
+#include <functional>
 #include "Model/model.h"
 #include "Simulation/results/results.h"
 #include "Settings/settings.h"
@@ -74,6 +75,25 @@ class Simulator {
    */
   virtual bool Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads=1) = 0;
 
+  /*!
+   * @brief Point the simulator at the deck of a realization without simulating it,
+   * e.g. before calling WriteDriverFilesOnly() after a multi-fidelity run.
+   *
+   * Only supported by interfaces that support realizations; the default
+   * implementation throws.
+   * @param realization The realization (or fidelity level) whose deck should be used.
+   */
+  virtual void SetRealization(const Settings::Ensemble::Realization &realization);
+
+  /*!
+   * @brief Read the results written so far by a simulation that is still running into
+   * results(), e.g. to monitor it from a cancellation check (see SetCancellationCheck).
+   *
+   * The results should be dumped when they have been used. The default implementation
+   * does not support this and returns false.
+   * @return True if (partial) results could be read; otherwise false.
+   */
+  virtual bool ReadPartialResults();
 
 
   /*!
@@ -92,6 +112,14 @@ class Simulator {
 
   void SetVerbosityLevel(int level);
 
+  /*!
+   * @brief Set a check that is polled while a simulation with timeout is running. When it
+   * returns true the simulation is killed and Evaluate(timeout) returns false.
+   *
+   * Used by the MPI workers to abandon simulations that the optimizer no longer needs.
+   */
+  void SetCancellationCheck(std::function<bool()> check) { cancellation_check_ = check; }
+
  protected:
   /*!
    * Set various path variables. Should only be called by child classes.
@@ -123,6 +151,7 @@ class Simulator {
   QList<int> control_times_;
   virtual void UpdateFilePaths() = 0;
   int verbosity_level_; //!< Verbosity level for runtime console logging.
+  std::function<bool()> cancellation_check_; //!< Polled during simulations; see SetCancellationCheck.
 };
 
 }
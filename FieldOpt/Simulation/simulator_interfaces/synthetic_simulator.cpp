@@ -0,0 +1,205 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <QByteArray>
+#include <QHash>
+#include <Utilities/printer.hpp>
+#include <Utilities/verbosity.h>
+#include <Utilities/random.hpp>
+#include <Utilities/trace.hpp>
+#include "synthetic_simulator.h"
+
+namespace Simulation {
+
+using Synthetic = ::Settings::Simulator::Synthetic;
+
+SyntheticSimulator::SyntheticSimulator(Settings::Settings *settings, Model::Model *model)
+    : Simulator(settings)
+{
+    model_ = model;
+    settings_synthetic_ = settings->simulator()->synthetic();
+    for (int t : control_times_) {
+        report_times_.push_back(t);
+    }
+    if (report_times_.size() < 2 || report_times_.back() <= 0) {
+        report_times_ = {0.0, 365.0};
+    }
+    results_ = new Results::SyntheticResults();
+}
+
+void SyntheticSimulator::Evaluate() {
+    results_->DumpResults();
+    sleep(Runtime());
+    setResults();
+    updateResultsInModel();
+}
+
+bool SyntheticSimulator::Evaluate(int timeout, int threads) {
+    results_->DumpResults();
+    int t = std::max(timeout, 10); // Always let simulations run for at least 10 seconds, like the other interfaces
+    double runtime;
+    bool failed;
+    draw(runtime, failed);
+
+    Utilities::Trace::Span span("sim.run");
+    if (!sleep(std::min(runtime, (double)t)) || runtime > t) {
+        if (VERB_SIM >= 2) Printer::ext_info("Synthetic evaluation cancelled or timed out.", "Simulation", "SyntheticSimulator");
+        return false;
+    }
+    span.End();
+    if (failed) {
+        if (VERB_SIM >= 2) Printer::ext_info("Synthetic evaluation failed.", "Simulation", "SyntheticSimulator");
+        return false;
+    }
+    setResults();
+    updateResultsInModel();
+    return true;
+}
+
+bool SyntheticSimulator::Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads) {
+    throw std::runtime_error("Ensembles are not supported by the synthetic simulator.");
+}
+
+void SyntheticSimulator::WriteDriverFilesOnly() {
+    // Nothing to write
+}
+
+void SyntheticSimulator::CleanUp() {
+    // Nothing to clean up
+}
+
+void SyntheticSimulator::UpdateFilePaths() {
+    // No files are used
+}
+
+std::vector<double> SyntheticSimulator::scaledVariables() const {
+    QList<QPair<QString, double>> variables;
+    auto continous_variables = model_->variables()->GetContinousVariables();
+    for (auto key : continous_variables->keys()) {
+        variables.append(qMakePair(continous_variables->value(key)->name() + key.toString(),
+                                   continous_variables->value(key)->value()));
+    }
+    std::sort(variables.begin(), variables.end());
+    std::vector<double> x;
+    for (auto var : variables) {
+        x.push_back((var.second - settings_synthetic_.center) / settings_synthetic_.width);
+    }
+    return x;
+}
+
+double SyntheticSimulator::FunctionValue() const {
+    auto x = scaledVariables();
+    double f = 0;
+    switch (settings_synthetic_.function) {
+        case Synthetic::Sphere:
+            for (double xi : x) {
+                f += xi * xi;
+            }
+            break;
+        case Synthetic::Rosenbrock: // Shifted so that the optimum is at x = 0 like for the sphere
+            for (int i = 0; i + 1 < x.size(); ++i) {
+                double xi = x[i] + 1.0;
+                double xn = x[i+1] + 1.0;
+                f += 100.0 * std::pow(xn - xi * xi, 2) + std::pow(1.0 - xi, 2);
+            }
+            break;
+    }
+    return f;
+}
+
+boost::random::mt19937 SyntheticSimulator::caseGenerator() const {
+    auto x = scaledVariables();
+    QByteArray bytes(reinterpret_cast<const char *>(x.data()), x.size() * sizeof(double));
+    return get_stream_generator(settings_synthetic_.seed, qHash(bytes), 0);
+}
+
+double SyntheticSimulator::Runtime() const {
+    double runtime;
+    bool failed;
+    draw(runtime, failed);
+    return runtime;
+}
+
+bool SyntheticSimulator::Fails() const {
+    double runtime;
+    bool failed;
+    draw(runtime, failed);
+    return failed;
+}
+
+void SyntheticSimulator::draw(double &runtime, bool &failed) const {
+    auto gen = caseGenerator();
+    runtime = sampleRuntime(gen);
+    failed = random_double(gen) < settings_synthetic_.failure_rate;
+}
+
+double SyntheticSimulator::sampleRuntime(boost::random::mt19937 &gen) const {
+    switch (settings_synthetic_.runtime_distribution) {
+        case Synthetic::Uniform:
+            return random_double(gen, settings_synthetic_.runtime_min, settings_synthetic_.runtime_max);
+        case Synthetic::LogNormal: {
+            if (settings_synthetic_.runtime_mean <= 0) return 0.0;
+            double sigma = settings_synthetic_.runtime_sigma;
+            double mu = std::log(settings_synthetic_.runtime_mean) - sigma * sigma / 2.0; // Mean of the runtime is runtime_mean
+            return std::exp(random_normal_distribution(gen, mu, sigma, 1));
+        }
+        default:
+            return settings_synthetic_.runtime_mean;
+    }
+}
+
+bool SyntheticSimulator::sleep(double seconds) const {
+    auto end = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(seconds));
+    while (std::chrono::steady_clock::now() < end) {
+        if (cancellation_check_ && cancellation_check_()) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+            end - std::chrono::steady_clock::now(), std::chrono::milliseconds(100)));
+    }
+    return true;
+}
+
+void SyntheticSimulator::setResults() {
+    double f = FunctionValue();
+    double oil = settings_synthetic_.volume / (1.0 + f);
+    double water = settings_synthetic_.volume - oil;
+    double end_time = report_times_.back();
+    std::vector<double> fopt, fwpt, zeros;
+    for (double t : report_times_) {
+        fopt.push_back(oil * t / end_time);
+        fwpt.push_back(water * t / end_time);
+        zeros.push_back(0.0);
+    }
+    auto results = dynamic_cast<Results::SyntheticResults *>(results_);
+    results->SetValueVectors({
+        {Results::Results::Time, report_times_},
+        {Results::Results::CumulativeOilProduction, fopt},
+        {Results::Results::CumulativeWaterProduction, fwpt},
+        {Results::Results::CumulativeGasProduction, zeros},
+        {Results::Results::CumulativeWaterInjection, zeros},
+        {Results::Results::CumulativeGasInjection, zeros}
+    });
+}
+
+}
@@ -0,0 +1,89 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef SYNTHETIC_SIMULATOR_H
+#define SYNTHETIC_SIMULATOR_H
+
+#include "simulator.h"
+#include "Simulation/results/synthetic_results.h"
+#include <boost/random/mersenne_twister.hpp>
+
+namespace Simulation {
+
+/*!
+ * \brief The SyntheticSimulator class evaluates an analytic function of the model
+ * variables in-process instead of running a reservoir simulator.
+ *
+ * It is meant for exercising the runners, optimizers, bookkeeping, constraints and
+ * logging without a simulator installed, e.g. to benchmark orchestration throughput.
+ * The response, synthetic runtime and failure rate are configured in the Synthetic
+ * section of the simulator settings (see Settings::Simulator::Synthetic).
+ *
+ * A failed evaluation returns false from Evaluate(timeout), like a simulation that
+ * timed out. The unmonitored Evaluate(), used for the base case, never fails.
+ */
+class SyntheticSimulator : public Simulator
+{
+ public:
+  SyntheticSimulator(Settings::Settings *settings, Model::Model *model);
+
+  void Evaluate() override;
+  bool Evaluate(int timeout, int threads=1) override;
+  bool Evaluate(const Settings::Ensemble::Realization &realization, int timeout, int threads=1) override;
+  void WriteDriverFilesOnly() override;
+  void CleanUp() override;
+
+  /*!
+   * \brief Get the value of the configured test function at the current model variables.
+   */
+  double FunctionValue() const;
+
+  /*!
+   * \brief Get the runtime, in seconds, drawn for the current model variables.
+   */
+  double Runtime() const;
+
+  /*!
+   * \brief Check whether the evaluation fails for the current model variables.
+   */
+  bool Fails() const;
+
+ protected:
+  void UpdateFilePaths() override;
+
+ private:
+  Settings::Simulator::Synthetic settings_synthetic_;
+  std::vector<double> report_times_; //!< Report times in days.
+
+  std::vector<double> scaledVariables() const; //!< Continuous variables sorted by name, scaled by Center and Width.
+  boost::random::mt19937 caseGenerator() const; //!< Random stream for the current variable values.
+  double sampleRuntime(boost::random::mt19937 &gen) const;
+  void draw(double &runtime, bool &failed) const; //!< Draw the runtime and failure for the current variables.
+
+  /*!
+   * \brief Sleep for the given number of seconds, polling the cancellation check.
+   * \return False if the evaluation was cancelled.
+   */
+  bool sleep(double seconds) const;
+
+  void setResults(); //!< Compute the production from the function value.
+};
+
+}
+
+#endif // SYNTHETIC_SIMULATOR_H
@@ -0,0 +1,131 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include <atomic>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+#include <boost/filesystem.hpp>
+#include <Utilities/printer.hpp>
+#include <Utilities/verbosity.h>
+#include "work_dir_manager.h"
+
+namespace Simulation {
+
+namespace fs = boost::filesystem;
+using LinkMode = Settings::Simulator::WorkDirectories::LinkMode;
+
+namespace {
+std::atomic<int> next_case_dir(0); //!< Shared by all managers in the process, which may use the same root.
+}
+
+WorkDirManager::WorkDirManager(const std::string &deck_dir,
+                               const std::string &case_root,
+                               LinkMode link) {
+    deck_dir_ = fs::canonical(deck_dir).string();
+    link_ = link;
+    fs::create_directories(case_root);
+    case_root_ = fs::canonical(case_root).string();
+}
+
+std::string WorkDirManager::Materialize() {
+    std::string case_dir = case_root_ + "/case_" + std::to_string(next_case_dir++);
+    std::string work_dir = case_dir + "/" + fs::path(deck_dir_).filename().string();
+    fs::create_directories(work_dir);
+    if (!aux_dir_.empty()) {
+        fs::create_directory_symlink(fs::absolute(aux_dir_), case_dir + "/" + fs::path(aux_dir_).filename().string());
+    }
+
+    for (fs::recursive_directory_iterator it(deck_dir_), end; it != end; ++it) {
+        std::string relative = it->path().string().substr(deck_dir_.size() + 1);
+        std::string destination = work_dir + "/" + relative;
+        if (fs::is_directory(it->status())) {
+            fs::create_directories(destination);
+            continue;
+        }
+        if (!output_stem_.empty() && it->path().stem().string() == output_stem_
+            && it->path().extension().string() != ".DATA") {
+            continue; // Output from earlier runs in the input directory
+        }
+        bool fresh = std::find(fresh_files_.begin(), fresh_files_.end(), relative) != fresh_files_.end();
+        materializeFile(it->path().string(), destination, fresh);
+    }
+
+    if (VERB_SIM >= 2) {
+        Printer::ext_info("Materialized case directory " + work_dir, "Simulation", "WorkDirManager");
+    }
+    return work_dir;
+}
+
+void WorkDirManager::Release(const std::string &work_dir) {
+    fs::path case_dir = fs::path(work_dir).parent_path();
+    if (!fs::exists(case_dir) || fs::canonical(case_dir.parent_path()) != fs::path(case_root_)) {
+        throw std::runtime_error("Not a case directory: " + work_dir);
+    }
+    // remove_all does not follow the symlinks, so the input files are left untouched.
+    fs::remove_all(case_dir);
+    if (VERB_SIM >= 2) {
+        Printer::ext_info("Released case directory " + case_dir.string(), "Simulation", "WorkDirManager");
+    }
+}
+
+void WorkDirManager::materializeFile(const std::string &source, const std::string &destination, bool fresh) {
+    if (fresh || link_ == LinkMode::Copy) {
+        fs::copy_file(source, destination);
+        return;
+    }
+    boost::system::error_code ec;
+    switch (link_) {
+        case LinkMode::Hardlink:
+            fs::create_hard_link(source, destination, ec);
+            if (!ec) return;
+            break; // E.g. a case root on another file system; fall back to a symlink
+        case LinkMode::Reflink:
+            if (reflink(source, destination)) return;
+            fs::copy_file(source, destination);
+            return;
+        default:
+            break;
+    }
+    fs::create_symlink(source, destination);
+}
+
+bool WorkDirManager::reflink(const std::string &source, const std::string &destination) {
+#ifdef FICLONE
+    int src = open(source.c_str(), O_RDONLY);
+    if (src < 0) return false;
+    int dst = open(destination.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (dst < 0) {
+        close(src);
+        return false;
+    }
+    bool success = ioctl(dst, FICLONE, src) == 0;
+    close(src);
+    close(dst);
+    if (!success) unlink(destination.c_str());
+    return success;
+#else
+    return false;
+#endif
+}
+
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+   Copyright (C) 2015-2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#ifndef WORK_DIR_MANAGER_H
+#define WORK_DIR_MANAGER_H
+
+#include <string>
+#include <vector>
+#include "Settings/simulator.h"
+
+namespace Simulation {
+
+/*!
+ * \brief The WorkDirManager class creates a separate simulation directory for
+ * each case without copying the input deck.
+ *
+ * A case directory is created below the case root for each call to Materialize:
+ *
+ * \code
+ *  <case root>/case_<n>/<deck dir>/   Files of the deck directory, linked.
+ *  <case root>/case_<n>/<aux dir>     Symlink to the shared aux. directory, if any.
+ * \endcode
+ *
+ * so that relative paths in the deck resolve as in the shared work directory.
+ * Input files are linked according to the LinkMode. Files written by FieldOpt
+ * (the fresh files) are always copied, so that writing them does not modify the
+ * input deck through a hard link, and files the simulator writes (named after
+ * the deck) are not materialised at all.
+ */
+class WorkDirManager
+{
+ public:
+  /*!
+   * @param deck_dir The input deck directory.
+   * @param case_root Directory to create case directories in.
+   * @param link How to materialise the input files.
+   */
+  WorkDirManager(const std::string &deck_dir,
+                 const std::string &case_root,
+                 Settings::Simulator::WorkDirectories::LinkMode link);
+
+  /*!
+   * @brief Set the files, relative to the deck directory, that FieldOpt writes
+   * before each simulation.
+   */
+  void SetFreshFiles(const std::vector<std::string> &fresh_files) { fresh_files_ = fresh_files; }
+
+  /*!
+   * @brief Set the deck name (without .DATA). Files named <deck>.* other than the
+   * deck itself are simulator output and are not materialised.
+   */
+  void SetOutputStem(const std::string &stem) { output_stem_ = stem; }
+
+  /*!
+   * @brief Set a directory to be symlinked next to the deck directory in each
+   * case directory (the simulation aux. directory).
+   */
+  void SetAuxDirectory(const std::string &aux_dir) { aux_dir_ = aux_dir; }
+
+  /*!
+   * @brief Create a new case directory.
+   * @return Path to the deck directory within the new case directory.
+   */
+  std::string Materialize();
+
+  /*!
+   * @brief Delete the case directory containing a work directory returned by Materialize.
+   */
+  void Release(const std::string &work_dir);
+
+  std::string case_root() const { return case_root_; }
+
+ private:
+  std::string deck_dir_;
+  std::string case_root_;
+  std::string aux_dir_;
+  std::string output_stem_;
+  std::vector<std::string> fresh_files_;
+  Settings::Simulator::WorkDirectories::LinkMode link_;
+
+  void materializeFile(const std::string &source, const std::string &destination, bool fresh);
+  bool reflink(const std::string &source, const std::string &destination);
+};
+
+}
+
+#endif // WORK_DIR_MANAGER_H
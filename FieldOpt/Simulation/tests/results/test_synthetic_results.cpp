@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "Simulation/results/synthetic_results.h"
+
+using namespace Simulation::Results;
+
+namespace {
+
+    class SyntheticResultsTest : public ::testing::Test {
+    protected:
+        SyntheticResultsTest() {
+            results_ = new SyntheticResults();
+        }
+
+        virtual ~SyntheticResultsTest() {
+            delete results_;
+        }
+
+        SyntheticResults *results_;
+    };
+
+    TEST_F(SyntheticResultsTest, DumpingAndAvailability) {
+        EXPECT_FALSE(results_->isAvailable());
+        EXPECT_THROW(results_->ReadResults("a"), std::runtime_error);
+
+        results_->SetValueVectors({
+            {Results::Property::Time, {0, 100, 200}},
+            {Results::Property::CumulativeOilProduction, {0, 50, 100}}
+        });
+        EXPECT_TRUE(results_->isAvailable());
+
+        results_->DumpResults();
+        EXPECT_FALSE(results_->isAvailable());
+        EXPECT_THROW(results_->GetValue(Results::Property::Time), ResultsNotAvailableException);
+    }
+
+    TEST_F(SyntheticResultsTest, FieldVariables) {
+        results_->SetValueVectors({
+            {Results::Property::Time, {0, 100, 200}},
+            {Results::Property::CumulativeOilProduction, {0, 50, 100}}
+        });
+        EXPECT_DOUBLE_EQ(100, results_->GetValue(Results::Property::CumulativeOilProduction));
+        EXPECT_DOUBLE_EQ(50, results_->GetValue(Results::Property::CumulativeOilProduction, 1));
+        EXPECT_THROW(results_->GetValue(Results::Property::CumulativeOilProduction, 3), std::runtime_error);
+        EXPECT_EQ(3, results_->GetValueVector(Results::Property::Time).size());
+        EXPECT_THROW(results_->GetValue(Results::Property::CumulativeOilProduction, "PROD"), std::runtime_error);
+    }
+
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "Simulation/simulator_interfaces/driver_file_writers/driver_parts/ecl_driver_parts/schedule_fragment_cache.h"
+
+using namespace ::Simulation::ECLDriverParts;
+
+namespace {
+
+class ScheduleFragmentCacheTest : public ::testing::Test {
+protected:
+    ScheduleFragmentCacheTest() {}
+
+    QByteArray controlsKey(int ts, double bhp) {
+        QByteArray key;
+        ScheduleFragmentCache::AppendToKey(key, ts);
+        ScheduleFragmentCache::AppendToKey(key, bhp);
+        return key;
+    }
+};
+
+TEST_F(ScheduleFragmentCacheTest, ReuseAndEviction) {
+    ScheduleFragmentCache cache;
+    int builds = 0;
+    auto build = [&]() { builds++; return QString("fragment"); };
+
+    cache.BeginSchedule();
+    cache.Get(controlsKey(0, 100.0), build);
+    cache.Get(controlsKey(1, 100.0), build);
+    cache.EndSchedule();
+    EXPECT_EQ(2, builds);
+
+    cache.BeginSchedule();
+    cache.Get(controlsKey(0, 100.0), build);
+    cache.Get(controlsKey(1, 150.0), build);
+    cache.EndSchedule();
+    EXPECT_EQ(3, builds);
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(2, cache.size()); // The fragment for (1, 100) was not used and is dropped
+
+    cache.Get(QByteArray(), build); // Empty keys are never cached
+    cache.Get(QByteArray(), build);
+    EXPECT_EQ(5, builds);
+}
+
+}
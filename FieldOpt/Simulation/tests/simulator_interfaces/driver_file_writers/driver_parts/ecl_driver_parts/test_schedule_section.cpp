@@ -22,4 +22,25 @@ TEST_F(DriverPartScheduleTest, Constructor) {
 //    std::cout << schedule_->GetPartString().toStdString() << std::endl;
 }
 
+TEST_F(DriverPartScheduleTest, FragmentCache) {
+    ScheduleFragmentCache cache;
+    auto cold = Schedule(model_->wells(), settings_model_->control_times(), insets_, cache);
+    EXPECT_EQ(schedule_->GetPartString(), cold.GetPartString());
+    EXPECT_EQ(schedule_->GetTimeEntryStrings(), cold.GetTimeEntryStrings());
+
+    auto warm = Schedule(model_->wells(), settings_model_->control_times(), insets_, cache);
+    EXPECT_EQ(cold.GetPartString(), warm.GetPartString());
+    EXPECT_GT(cache.hits(), 0);
+
+    // A changed control must be picked up, rebuilding only the entry for that well
+    auto control = model_->wells()->first()->controls()->first();
+    control->setBhp(control->bhp() + 10.0);
+    int misses = cache.misses();
+    auto changed = Schedule(model_->wells(), settings_model_->control_times(), insets_, cache);
+    EXPECT_EQ(misses + 1, cache.misses());
+    auto uncached = Schedule(model_->wells(), settings_model_->control_times(), insets_);
+    EXPECT_NE(cold.GetPartString(), changed.GetPartString());
+    EXPECT_EQ(uncached.GetPartString(), changed.GetPartString());
+}
+
 }
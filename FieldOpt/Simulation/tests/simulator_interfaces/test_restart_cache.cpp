@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include "Simulation/simulator_interfaces/restart_cache.h"
+
+using namespace Simulation;
+namespace {
+
+class RestartCacheTest : public testing::Test {
+protected:
+    RestartCacheTest() {}
+};
+
+TEST_F(RestartCacheTest, PrefixHashes) {
+    auto base = RestartCache::PrefixHashes({"CTRL 1\n", "CTRL 2\n", "CTRL 3\n"}, "DECK");
+    auto tail = RestartCache::PrefixHashes({"CTRL 1\n", "CTRL 2\n", "CTRL 4\n"}, "DECK");
+    auto head = RestartCache::PrefixHashes({"CTRL 0\n", "CTRL 2\n", "CTRL 3\n"}, "DECK");
+    auto other_deck = RestartCache::PrefixHashes({"CTRL 1\n", "CTRL 2\n", "CTRL 3\n"}, "OTHER");
+    EXPECT_EQ(3, base.size());
+
+    // Hashes are shared up to the first differing control time, and never after it
+    EXPECT_EQ(base[0], tail[0]);
+    EXPECT_EQ(base[1], tail[1]);
+    EXPECT_NE(base[2], tail[2]);
+    for (int k = 0; k < 3; ++k) {
+        EXPECT_NE(base[k], head[k]);
+        EXPECT_NE(base[k], other_deck[k]);
+    }
+}
+
+TEST_F(RestartCacheTest, Lookup) {
+    QTemporaryDir dir;
+    QString work_dir = dir.path();
+    auto cache = RestartCache(work_dir, 2);
+    auto base = RestartCache::PrefixHashes({"CTRL 1\n", "CTRL 2\n", "CTRL 3\n"}, "DECK");
+    EXPECT_FALSE(cache.Lookup(base, work_dir).found);
+
+    // Nothing is cached when the simulation files do not exist
+    cache.Store(base, work_dir + "/MISSING");
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.Lookup(base, work_dir).found);
+}
+
+TEST_F(RestartCacheTest, RestartDeck) {
+    QStringList deck = {"RUNSPEC", "UNIFOUT", "GRID", "INCLUDE", " 'grid.inc' /",
+                        "SOLUTION -- Initial state", "EQUIL", " 2000 200 2100 0 1000 0 /",
+                        "SUMMARY", "FOPT", "SCHEDULE", "INCLUDE", " 'sch.inc' /", "END"};
+    auto restart_deck = RestartCache::RestartDeck(deck, "restart_cache/0/BASE", 2);
+    EXPECT_FALSE(restart_deck.contains("EQUIL"));
+    int restart = restart_deck.indexOf("RESTART");
+    EXPECT_GT(restart, restart_deck.indexOf("SOLUTION -- Initial state"));
+    EXPECT_EQ(" 'restart_cache/0/BASE' 2 /", restart_deck[restart + 1]);
+    EXPECT_EQ(restart_deck.indexOf("SCHEDULE") + 1, restart_deck.indexOf("SKIPREST"));
+    EXPECT_TRUE(restart_deck.contains("FOPT"));
+    EXPECT_TRUE(restart_deck.contains(" 'sch.inc' /"));
+
+    deck.removeAll("SCHEDULE");
+    EXPECT_TRUE(RestartCache::RestartDeck(deck, "restart_cache/0/BASE", 2).empty());
+}
+
+}
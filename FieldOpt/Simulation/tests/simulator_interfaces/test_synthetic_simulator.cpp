@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "Simulation/tests/test_resource_synthetic_simulator.h"
+
+using namespace Simulation;
+using namespace TestResources;
+
+namespace {
+
+class SyntheticSimulatorTest : public testing::Test, public TestResourceSyntheticSimulator {
+ protected:
+  SyntheticSimulatorTest() {
+      n_vars_ = model_->variables()->GetContinousVariables()->size();
+  }
+  int n_vars_;
+};
+
+TEST_F(SyntheticSimulatorTest, FunctionValue) {
+    ASSERT_GT(n_vars_, 1);
+    auto sphere = CreateSyntheticSimulator(QJsonObject{{"Function", "Sphere"}, {"Center", 10.0}, {"Width", 5.0}});
+    auto rosenbrock = CreateSyntheticSimulator(QJsonObject{{"Function", "Rosenbrock"}, {"Center", 10.0}, {"Width", 5.0}});
+
+    // Both functions have their optimum at the center
+    SetContinuousVariables(10.0);
+    EXPECT_DOUBLE_EQ(0.0, sphere->FunctionValue());
+    EXPECT_DOUBLE_EQ(0.0, rosenbrock->FunctionValue());
+
+    // All scaled variables equal to 1
+    SetContinuousVariables(15.0);
+    EXPECT_DOUBLE_EQ(n_vars_, sphere->FunctionValue());
+    EXPECT_DOUBLE_EQ(401.0 * (n_vars_ - 1), rosenbrock->FunctionValue());
+}
+
+TEST_F(SyntheticSimulatorTest, DeterministicDraws) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{
+        {"FailureRate", 0.5}, {"Runtime", QJsonObject{{"Distribution", "LogNormal"}, {"Mean", 10.0}}}
+    });
+    SetContinuousVariables(1.0);
+    double runtime = simulator->Runtime();
+    bool fails = simulator->Fails();
+
+    // Draws only depend on the variable values
+    int n_failed = 0;
+    for (int i = 0; i < 20; ++i) {
+        SetContinuousVariables(2.0 + i);
+        EXPECT_NE(runtime, simulator->Runtime());
+        if (simulator->Fails()) n_failed++;
+    }
+    EXPECT_GT(n_failed, 0);
+    EXPECT_LT(n_failed, 20);
+
+    SetContinuousVariables(1.0);
+    EXPECT_DOUBLE_EQ(runtime, simulator->Runtime());
+    EXPECT_EQ(fails, simulator->Fails());
+    EXPECT_DOUBLE_EQ(runtime, CreateSyntheticSimulator(QJsonObject{
+        {"FailureRate", 0.5}, {"Runtime", QJsonObject{{"Distribution", "LogNormal"}, {"Mean", 10.0}}}
+    })->Runtime());
+}
+
+TEST_F(SyntheticSimulatorTest, Failures) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"FailureRate", 0.5}});
+    bool found_failed = false, found_ok = false;
+    for (int i = 0; i < 20; ++i) {
+        SetContinuousVariables(i);
+        if (simulator->Fails()) {
+            EXPECT_FALSE(simulator->Evaluate(10));
+            EXPECT_FALSE(simulator->results()->isAvailable());
+            found_failed = true;
+        }
+        else {
+            EXPECT_TRUE(simulator->Evaluate(10));
+            EXPECT_TRUE(simulator->results()->isAvailable());
+            found_ok = true;
+        }
+    }
+    EXPECT_TRUE(found_failed);
+    EXPECT_TRUE(found_ok);
+}
+
+TEST_F(SyntheticSimulatorTest, Cancellation) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{
+        {"Runtime", QJsonObject{{"Distribution", "Constant"}, {"Mean", 60.0}}}
+    });
+    auto start = std::chrono::steady_clock::now();
+    simulator->SetCancellationCheck([start]() {
+      return std::chrono::steady_clock::now() - start > std::chrono::milliseconds(200);
+    });
+    EXPECT_FALSE(simulator->Evaluate(100));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(SyntheticSimulatorTest, Results) {
+    auto simulator = CreateSyntheticSimulator(QJsonObject{{"Volume", 1000.0}});
+    SetContinuousVariables(1.0);
+    double f = simulator->FunctionValue();
+    ASSERT_TRUE(simulator->Evaluate(10));
+    auto results = simulator->results();
+    EXPECT_DOUBLE_EQ(1000.0 / (1.0 + f), results->GetValue(Results::Results::CumulativeOilProduction));
+    EXPECT_DOUBLE_EQ(1000.0 - 1000.0 / (1.0 + f), results->GetValue(Results::Results::CumulativeWaterProduction));
+}
+
+}
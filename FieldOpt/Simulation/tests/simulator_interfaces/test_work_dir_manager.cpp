@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <QTemporaryDir>
+#include <boost/filesystem.hpp>
+#include "Simulation/simulator_interfaces/work_dir_manager.h"
+#include "Utilities/filehandling.hpp"
+
+using namespace Simulation;
+using namespace Utilities::FileHandling;
+namespace fs = boost::filesystem;
+namespace {
+
+class WorkDirManagerTest : public testing::Test {
+protected:
+    WorkDirManagerTest() {
+        fs::create_directories(deck_dir_ + "/include");
+        WriteStringToFile("RUNSPEC\n", QString::fromStdString(deck_dir_ + "/DECK.DATA"));
+        WriteStringToFile("-- Grid\n", QString::fromStdString(deck_dir_ + "/include/grid.inc"));
+        WriteStringToFile("-- Schedule\n", QString::fromStdString(deck_dir_ + "/include/sch.inc"));
+        WriteStringToFile("old output", QString::fromStdString(deck_dir_ + "/DECK.UNSMRY"));
+    }
+    QTemporaryDir dir_;
+    std::string root_ = dir_.path().toStdString();
+    std::string deck_dir_ = root_ + "/input/DECK";
+};
+
+TEST_F(WorkDirManagerTest, MaterializeAndRelease) {
+    auto manager = WorkDirManager(deck_dir_, root_ + "/cases", Settings::Simulator::WorkDirectories::Hardlink);
+    manager.SetFreshFiles({"include/sch.inc"});
+    manager.SetOutputStem("DECK");
+
+    std::string first = manager.Materialize();
+    std::string second = manager.Materialize();
+    EXPECT_NE(first, second);
+    EXPECT_EQ("DECK", fs::path(first).filename().string());
+    EXPECT_TRUE(FileExists(first + "/DECK.DATA"));
+    EXPECT_TRUE(FileExists(first + "/include/grid.inc"));
+    EXPECT_FALSE(FileExists(first + "/DECK.UNSMRY"));
+
+    // Writing the schedule in one case must neither affect the input deck nor other cases
+    WriteStringToFile("-- Case schedule\n", QString::fromStdString(first + "/include/sch.inc"));
+    EXPECT_EQ("-- Schedule", ReadFileToStringList(QString::fromStdString(deck_dir_ + "/include/sch.inc"))->first());
+    EXPECT_EQ("-- Schedule", ReadFileToStringList(QString::fromStdString(second + "/include/sch.inc"))->first());
+
+    manager.Release(first);
+    EXPECT_FALSE(DirectoryExists(first));
+    EXPECT_TRUE(DirectoryExists(second));
+    EXPECT_TRUE(FileExists(deck_dir_ + "/include/grid.inc"));
+    EXPECT_THROW(manager.Release(deck_dir_), std::runtime_error);
+}
+
+}
@@ -0,0 +1,61 @@
+#ifndef FIELDOPT_TEST_RESOURCE_SYNTHETIC_SIMULATOR_H
+#define FIELDOPT_TEST_RESOURCE_SYNTHETIC_SIMULATOR_H
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include "Model/tests/test_resource_model.h"
+#include "Simulation/simulator_interfaces/synthetic_simulator.h"
+
+namespace TestResources {
+
+/*!
+ * @brief Creates synthetic simulators for the test model. The settings are read from
+ * a copy of the example driver file with its Simulator section replaced, written to
+ * a temporary directory.
+ */
+class TestResourceSyntheticSimulator : public TestResourceModel {
+ protected:
+  /*!
+   * @brief Create a synthetic simulator with the given Synthetic section.
+   */
+  Simulation::SyntheticSimulator *CreateSyntheticSimulator(QJsonObject json_synthetic) {
+      QFile example(QString::fromStdString(ExampleFilePaths::driver_example_));
+      example.open(QIODevice::ReadOnly);
+      QJsonObject json_driver = QJsonDocument::fromJson(example.readAll()).object();
+      example.close();
+      QJsonObject json_simulator;
+      json_simulator["Type"] = "Synthetic";
+      json_simulator["Synthetic"] = json_synthetic;
+      json_driver["Simulator"] = json_simulator;
+
+      QString driver_path = synthetic_dir_.path() + "/driver.json";
+      QFile driver(driver_path);
+      driver.open(QIODevice::WriteOnly | QIODevice::Truncate);
+      driver.write(QJsonDocument(json_driver).toJson());
+      driver.close();
+
+      Paths paths;
+      paths.SetPath(Paths::DRIVER_FILE, driver_path.toStdString());
+      paths.SetPath(Paths::OUTPUT_DIR, synthetic_dir_.path().toStdString());
+      paths.SetPath(Paths::GRID_FILE, ExampleFilePaths::grid_5spot_);
+      auto settings = new Settings::Settings(paths);
+      return new Simulation::SyntheticSimulator(settings, model_);
+  }
+
+  /*!
+   * @brief Set all continuous variables of the test model to the same value.
+   */
+  void SetContinuousVariables(double value) {
+      for (auto var : model_->variables()->GetContinousVariables()->values()) {
+          var->setValue(value);
+      }
+  }
+
+  QTemporaryDir synthetic_dir_;
+};
+
+}
+
+#endif //FIELDOPT_TEST_RESOURCE_SYNTHETIC_SIMULATOR_H
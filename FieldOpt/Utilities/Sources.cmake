@@ -7,6 +7,7 @@ SET(UTILITIES_HEADERS
 	printer.hpp
 	stringhelpers.hpp
 	time.hpp
+	trace.hpp
 	random.hpp
 	system.hpp
 	verbosity.h
@@ -21,5 +22,6 @@ SET(UTILITIES_TESTS
 	tests/test_math.cpp
 	tests/test_printer.cpp
 	tests/test_time.cpp
+	tests/test_trace.cpp
 	tests/test_random.cpp
 )
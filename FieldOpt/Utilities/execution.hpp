@@ -24,7 +24,10 @@
 #include "Utilities/filehandling.hpp"
 #include "Utilities/verbosity.h"
 #include "Utilities/printer.hpp"
+#include "Utilities/trace.hpp"
 #include <iostream>
+#include <algorithm>
+#include <functional>
 #include <unistd.h>
 #include <sys/wait.h>
 #include <assert.h>
@@ -71,6 +74,7 @@ inline void ExecShellScript(QString script_path, QStringList args)
     if (!Utilities::FileHandling::FileExists(script_path))
         throw std::runtime_error("File not found: " + script_path.toStdString());
     QString command = script_path + " " + args.join(" ");
+    Utilities::Trace::Span span("sim.run");
     system(command.toLatin1().constData());
 }
 
@@ -141,15 +145,18 @@ inline void terminate_process(int pid)
  * @brief ExecShellScriptTimeout execututes a shell script with the given set of parameters, and
  * terminates the process after a set time has passed if it has not returned by then.
  *
- * \todo In this function, in the else block, we can also, at a later stage, monitor the output files
- * of a simulation and use them to decide whether we should abort.
+ * The output of a running simulation can be monitored through the cancelled check, e.g. to
+ * abort simulations that can no longer improve on the best case.
  *
  * @param script_path Absolute path to the shell script.
  * @param args Arguments to be passed to the script.
  * @param timeout Seconds before the execution will be terminated.
- * @return True if the script returned _before_ the timeout, otherwise false.
+ * @param cancelled Optional check polled about once a second while the script runs; the
+ * execution is terminated when it returns true.
+ * @return True if the script returned _before_ the timeout (and was not cancelled), otherwise false.
  */
-inline bool ExecShellScriptTimeout(QString script_path, QStringList args, int timeout)
+inline bool ExecShellScriptTimeout(QString script_path, QStringList args, int timeout,
+                                   std::function<bool()> cancelled = nullptr)
 {
     if (!Utilities::FileHandling::FileExists(script_path))
         throw std::runtime_error("File not found: " + script_path.toStdString());
@@ -176,8 +183,13 @@ inline bool ExecShellScriptTimeout(QString script_path, QStringList args, int ti
         return false;
     }
 
+    Utilities::Trace::Span run_span("sim.run");
+    Utilities::Trace::Span launch_span("sim.launch");
     pid  = helpers::fork_child(script_path, args);
-    to.tv_sec = timeout;
+    launch_span.End();
+    int remaining = timeout;
+    int slice = cancelled ? 1 : timeout; // Wake up regularly to check for cancellation
+    to.tv_sec = std::min(slice, remaining);
     to.tv_nsec = 0;
 
 
@@ -202,6 +214,18 @@ inline bool ExecShellScriptTimeout(QString script_path, QStringList args, int ti
                 return false;
             }
             else if (errno == EAGAIN) {
+                remaining -= to.tv_sec;
+                if (cancelled && helpers::is_pid_running(pid)) {
+                    if (cancelled()) {
+                        Printer::ext_warn("Cancelled, killing child " + Printer::num2str(pid), "Utilities", "Execution");
+                        kill(pid, SIGKILL);
+                        return false;
+                    }
+                    if (remaining > 0) {
+                        to.tv_sec = std::min(slice, remaining);
+                        continue;
+                    }
+                }
                 Printer::ext_warn("Timeout, killing child " + Printer::num2str(pid), "Utilities", "Execution");
                 if (helpers::is_pid_running(pid)) { // Ensure that child still exists
                     kill(pid, SIGKILL);
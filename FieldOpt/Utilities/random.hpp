@@ -23,6 +23,9 @@
 #define FIELDOPT_RANDOM_H
 
 #include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include <Eigen/Core>
@@ -252,4 +255,136 @@ inline double random_normal_distribution(boost::random::mt19937 &gen, const doub
 }
 
 
+/*!
+ * @brief Fill a vector with random doubles in the range [min, max). Draws the same sequence as
+ * random_doubles_eigen, but writes into an existing buffer.
+ * @param gen Random number generator.
+ * @param out Buffer to fill. Its size determines the number of draws.
+ */
+inline void fill_uniform(boost::random::mt19937 &gen, Eigen::Ref<Eigen::VectorXd> out,
+                         const double min, const double max) {
+    boost::random::uniform_real_distribution<> dist(min, max);
+    for (int i = 0; i < out.size(); ++i) {
+        out(i) = dist(gen);
+    }
+}
+
+/*!
+ * @brief Fill a vector with random doubles, element i in the range [lower(i), upper(i)).
+ * @param gen Random number generator.
+ * @param out Buffer to fill; must have the same size as lower and upper.
+ */
+inline void fill_uniform(boost::random::mt19937 &gen, Eigen::Ref<Eigen::VectorXd> out,
+                         const Eigen::VectorXd &lower, const Eigen::VectorXd &upper) {
+    typedef boost::random::uniform_real_distribution<> dist_t;
+    dist_t dist;
+    for (int i = 0; i < out.size(); ++i) {
+        out(i) = dist(gen, dist_t::param_type(lower(i), upper(i)));
+    }
+}
+
+/*!
+ * @brief Fill a vector with normally distributed doubles.
+ * @param gen Random number generator.
+ * @param out Buffer to fill.
+ */
+inline void fill_normal(boost::random::mt19937 &gen, Eigen::Ref<Eigen::VectorXd> out,
+                        const double mean = 0.0, const double std = 1.0) {
+    boost::random::normal_distribution<> dist(mean, std);
+    for (int i = 0; i < out.size(); ++i) {
+        out(i) = dist(gen);
+    }
+}
+
+/*!
+ * @brief The SplitMix64 mixing function. Used to derive well separated seeds
+ * from (seed, key, member) tuples.
+ */
+inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/*!
+ * @brief Get the seed of an independent random stream.
+ *
+ * Streams are identified by a base seed (e.g. drawn once from an optimizer's
+ * generator) and two keys, typically the iteration and the population member.
+ * The same tuple always gives the same stream, no matter which thread draws
+ * from it or in which order the streams are used.
+ */
+inline uint32_t random_stream_seed(const uint64_t seed, const uint64_t key, const uint64_t member) {
+    return (uint32_t)splitmix64(splitmix64(splitmix64(seed) ^ key) ^ member);
+}
+
+/*!
+ * @brief Get a generator for the stream (seed, key, member). See random_stream_seed.
+ */
+inline boost::random::mt19937 get_stream_generator(const uint64_t seed, const uint64_t key, const uint64_t member) {
+    return boost::random::mt19937(random_stream_seed(seed, key, member));
+}
+
+/*!
+ * @brief Fill the columns of a matrix from independent random streams, possibly in parallel.
+ *
+ * Column c is filled by calling fill(gen, column) with gen = get_stream_generator(seed, key, c),
+ * so the result only depends on (seed, key) and not on the number of threads.
+ * @param m Matrix to fill. It must already have the desired size.
+ * @param fill Callable taking (boost::random::mt19937 &, Eigen::Ref<Eigen::VectorXd>).
+ * @param n_threads Number of threads to use. 0 uses all hardware threads.
+ */
+template<typename Fill>
+inline void fill_columns_from_streams(Eigen::MatrixXd &m, const uint64_t seed, const uint64_t key,
+                                      Fill fill, int n_threads = 1) {
+    const int n_cols = (int)m.cols();
+    auto fill_range = [&m, &fill, seed, key, n_cols](int first, int stride) {
+        for (int c = first; c < n_cols; c += stride) {
+            auto gen = get_stream_generator(seed, key, c);
+            fill(gen, m.col(c));
+        }
+    };
+
+    if (n_threads <= 0) {
+        n_threads = (int)std::thread::hardware_concurrency();
+    }
+    n_threads = std::max(1, std::min(n_threads, n_cols));
+    if (n_threads == 1) {
+        fill_range(0, 1);
+        return;
+    }
+    std::vector<std::thread> workers;
+    for (int t = 1; t < n_threads; ++t) {
+        workers.emplace_back(fill_range, t, n_threads);
+    }
+    fill_range(0, n_threads);
+    for (auto &w : workers) {
+        w.join();
+    }
+}
+
+/*!
+ * @brief Fill a matrix with standard normal samples, one independent stream per column.
+ * See fill_columns_from_streams.
+ */
+inline void fill_normal_columns(Eigen::MatrixXd &m, const uint64_t seed, const uint64_t key, int n_threads = 1) {
+    fill_columns_from_streams(m, seed, key, [](boost::random::mt19937 &gen, Eigen::Ref<Eigen::VectorXd> col) {
+      fill_normal(gen, col);
+    }, n_threads);
+}
+
+/*!
+ * @brief Fill a matrix with uniform samples, row i in the range [lower(i), upper(i)),
+ * one independent stream per column. See fill_columns_from_streams.
+ */
+inline void fill_uniform_columns(Eigen::MatrixXd &m, const uint64_t seed, const uint64_t key,
+                                 const Eigen::VectorXd &lower, const Eigen::VectorXd &upper,
+                                 int n_threads = 1) {
+    fill_columns_from_streams(m, seed, key, [&lower, &upper](boost::random::mt19937 &gen, Eigen::Ref<Eigen::VectorXd> col) {
+      fill_uniform(gen, col, lower, upper);
+    }, n_threads);
+}
+
+
 #endif //FIELDOPT_RANDOM_H
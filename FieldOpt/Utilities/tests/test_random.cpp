@@ -185,4 +185,53 @@ TEST_F(RandomTest, SeededRandomDoublesEigen) {
     }
 }
 
+TEST_F(RandomTest, BulkFillMatchesSingleDraws) {
+    auto gen_A = get_random_generator(3);
+    auto gen_B = get_random_generator(3);
+    int N = 20;
+
+    Eigen::VectorXd singles = random_doubles_eigen(gen_A, 0, 10, N);
+    Eigen::VectorXd bulk(N);
+    fill_uniform(gen_B, bulk, 0, 10);
+    for (int i = 0; i < N; ++i) {
+        EXPECT_EQ(singles[i], bulk[i]);
+    }
+
+    Eigen::VectorXd lower = Eigen::VectorXd::LinSpaced(N, -5, 5);
+    Eigen::VectorXd upper = lower.array() + 1.0;
+    fill_uniform(gen_B, bulk, lower, upper);
+    for (int i = 0; i < N; ++i) {
+        EXPECT_EQ(random_double(gen_A, lower[i], upper[i]), bulk[i]);
+        EXPECT_GE(bulk[i], lower[i]);
+        EXPECT_LT(bulk[i], upper[i]);
+    }
+}
+
+TEST_F(RandomTest, StreamsAreIndependentOfThreadCount) {
+    Eigen::MatrixXd serial(50, 16), parallel(50, 16), other_key(50, 16);
+    fill_normal_columns(serial, 1234, 7, 1);
+    fill_normal_columns(parallel, 1234, 7, 4);
+    fill_normal_columns(other_key, 1234, 8, 4);
+    EXPECT_EQ(serial, parallel);
+    EXPECT_NE(serial, other_key);
+
+    // Column c is the stream (seed, key, c)
+    auto gen = get_stream_generator(1234, 7, 5);
+    Eigen::VectorXd column(50);
+    fill_normal(gen, column);
+    EXPECT_EQ(column, serial.col(5));
+
+    // Different members and keys give different seeds
+    EXPECT_NE(random_stream_seed(1234, 7, 0), random_stream_seed(1234, 7, 1));
+    EXPECT_NE(random_stream_seed(1234, 0, 7), random_stream_seed(1234, 7, 0));
+
+    Eigen::VectorXd lower = Eigen::VectorXd::Zero(50);
+    Eigen::VectorXd upper = Eigen::VectorXd::Constant(50, 2.0);
+    fill_uniform_columns(serial, 1, 2, lower, upper, 1);
+    fill_uniform_columns(parallel, 1, 2, lower, upper, 0);
+    EXPECT_EQ(serial, parallel);
+    EXPECT_GE(serial.minCoeff(), 0.0);
+    EXPECT_LT(serial.maxCoeff(), 2.0);
+}
+
 }
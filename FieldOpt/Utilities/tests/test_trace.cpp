@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <QTemporaryDir>
+#include "Utilities/trace.hpp"
+#include "Utilities/filehandling.hpp"
+
+using namespace Utilities::Trace;
+
+namespace {
+
+class TraceTest : public testing::Test {
+protected:
+    TraceTest() { Tracer::Instance().Reset(); }
+    virtual ~TraceTest() {
+        Tracer::Instance().EnableEvents(false);
+        Tracer::Instance().Reset();
+    }
+};
+
+TEST_F(TraceTest, Buckets) {
+    EXPECT_EQ(0, PhaseStats::Bucket(0));
+    EXPECT_EQ(1, PhaseStats::Bucket(1));
+    EXPECT_EQ(2, PhaseStats::Bucket(3));
+    EXPECT_EQ(11, PhaseStats::Bucket(1500));
+    EXPECT_EQ(PhaseStats::kBuckets - 1, PhaseStats::Bucket(1LL << 50));
+}
+
+TEST_F(TraceTest, SpansAndExport) {
+    Tracer::Instance().EnableEvents(true);
+    for (int i = 0; i < 3; ++i) {
+        Span span("test.sleep");
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    {
+        Span span("test.early");
+        span.End();
+        span.End(); // Only recorded once
+    }
+
+    auto stats = Tracer::Instance().Stats();
+    EXPECT_EQ(3, stats["test.sleep"].count);
+    EXPECT_GE(stats["test.sleep"].total_us, 6000);
+    EXPECT_GE(stats["test.sleep"].max_us, 2000);
+    EXPECT_EQ(1, stats["test.early"].count);
+    EXPECT_NE(std::string::npos, Tracer::Instance().SummaryTable().find("test.sleep"));
+
+    QTemporaryDir dir;
+    std::string path = dir.path().toStdString() + "/trace.json";
+    Tracer::Instance().WriteChromeTrace(path);
+    auto lines = Utilities::FileHandling::ReadFileToStringList(QString::fromStdString(path));
+    EXPECT_TRUE(lines->first().startsWith("{\"displayTimeUnit\""));
+    EXPECT_EQ(7, lines->size()); // Header, metadata, four events, footer
+    delete lines;
+}
+
+}
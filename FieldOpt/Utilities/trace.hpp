@@ -0,0 +1,225 @@
+/// This file contains a lightweight tracer for timing the phases of a run.
+#ifndef TRACE_FUNCTIONS_H
+#define TRACE_FUNCTIONS_H
+
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Utilities {
+namespace Trace {
+
+/*!
+ * @brief Aggregated timings for one phase. Durations are bucketed into a
+ * log2 histogram: bucket 0 holds spans shorter than 1 us, bucket k spans
+ * in [2^(k-1), 2^k) us.
+ */
+struct PhaseStats {
+  static const int kBuckets = 40;
+  long long count = 0;
+  long long total_us = 0;
+  long long max_us = 0;
+  std::array<long long, kBuckets> histogram{};
+
+  static int Bucket(long long us) {
+      int bucket = 0;
+      while (us > 0 && bucket < kBuckets - 1) {
+          us >>= 1;
+          bucket++;
+      }
+      return bucket;
+  }
+
+  void Add(long long us) {
+      count++;
+      total_us += us;
+      if (us > max_us) max_us = us;
+      histogram[Bucket(us)]++;
+  }
+};
+
+/*!
+ * @brief The Tracer collects the durations of named phases in this process.
+ *
+ * Aggregated statistics are always kept. Individual events, needed to export a
+ * Chrome/Perfetto trace, are only kept when enabled with EnableEvents, and at
+ * most max_events of them.
+ */
+class Tracer {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  static Tracer &Instance() {
+      static Tracer tracer;
+      return tracer;
+  }
+
+  /*!
+   * @brief Set the process id written to the trace (the MPI rank).
+   */
+  void SetProcessId(int pid) { pid_ = pid; }
+  int process_id() const { return pid_; }
+
+  void EnableEvents(bool enable, size_t max_events = 1000000) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      events_enabled_ = enable;
+      max_events_ = max_events;
+  }
+
+  void Record(const std::string &phase, Clock::time_point start, Clock::time_point end) {
+      long long us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_[phase].Add(us);
+      if (events_enabled_ && events_.size() < max_events_) {
+          Event event;
+          event.phase = phase;
+          event.start_us = std::chrono::duration_cast<std::chrono::microseconds>(start - origin_).count();
+          event.duration_us = us;
+          event.tid = threadIndex();
+          events_.push_back(event);
+      }
+  }
+
+  std::map<std::string, PhaseStats> Stats() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return stats_;
+  }
+
+  void Reset() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.clear();
+      events_.clear();
+  }
+
+  /*!
+   * @brief Get a markdown table with the statistics for all phases.
+   */
+  std::string SummaryTable() const {
+      std::stringstream table;
+      table << "| Phase                     | Count    | Total [s]  | Mean [ms]  | Max [ms]   | Histogram (upper bound: count) |\n";
+      table << "| ------------------------- | -------- | ---------- | ---------- | ---------- | ------------------------------ |\n";
+      table << std::fixed;
+      for (auto item : Stats()) {
+          const PhaseStats &s = item.second;
+          table << "| " << std::left << std::setw(25) << item.first
+                << " | " << std::right << std::setw(8) << s.count
+                << " | " << std::setw(10) << std::setprecision(3) << s.total_us / 1e6
+                << " | " << std::setw(10) << std::setprecision(3) << (s.count > 0 ? s.total_us / 1e3 / s.count : 0.0)
+                << " | " << std::setw(10) << std::setprecision(3) << s.max_us / 1e3
+                << " | " << histogramString(s) << " |\n";
+      }
+      return table.str();
+  }
+
+  /*!
+   * @brief Write the recorded events as a Chrome trace (JSON object format), which
+   * can be opened in chrome://tracing or Perfetto. Timestamps are microseconds
+   * since the epoch, so traces from several ranks can be loaded together.
+   */
+  void WriteChromeTrace(const std::string &path) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::ofstream out(path);
+      out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+      out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid_
+          << ",\"args\":{\"name\":\"rank " << pid_ << "\"}}";
+      for (auto &event : events_) {
+          out << ",\n{\"name\":\"" << event.phase << "\",\"cat\":\"fieldopt\",\"ph\":\"X\""
+              << ",\"ts\":" << epoch_us_ + event.start_us << ",\"dur\":" << event.duration_us
+              << ",\"pid\":" << pid_ << ",\"tid\":" << event.tid << "}";
+      }
+      out << "\n]}\n";
+  }
+
+ private:
+  Tracer() {
+      origin_ = Clock::now();
+      epoch_us_ = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::system_clock::now().time_since_epoch()).count();
+  }
+
+  struct Event {
+    std::string phase;
+    long long start_us;
+    long long duration_us;
+    int tid;
+  };
+
+  int threadIndex() {
+      auto id = std::this_thread::get_id();
+      auto it = thread_indices_.find(id);
+      if (it != thread_indices_.end()) return it->second;
+      int index = thread_indices_.size();
+      thread_indices_[id] = index;
+      return index;
+  }
+
+  static std::string histogramString(const PhaseStats &s) {
+      std::stringstream hist;
+      for (int k = 0; k < PhaseStats::kBuckets; ++k) {
+          if (s.histogram[k] == 0) continue;
+          long long bound = 1LL << k;
+          if (hist.tellp() > 0) hist << " ";
+          if (bound < 1000) hist << bound << "us";
+          else if (bound < 1000000) hist << bound / 1000 << "ms";
+          else hist << bound / 1000000 << "s";
+          hist << ":" << s.histogram[k];
+      }
+      return hist.str();
+  }
+
+  mutable std::mutex mutex_;
+  int pid_ = 0;
+  bool events_enabled_ = false;
+  size_t max_events_ = 0;
+  Clock::time_point origin_;
+  long long epoch_us_;
+  std::map<std::string, PhaseStats> stats_;
+  std::vector<Event> events_;
+  std::map<std::thread::id, int> thread_indices_;
+};
+
+/*!
+ * @brief Times the enclosing scope and records it under the given phase name.
+ *
+ * Usage:
+ * @code
+ *   {
+ *     Utilities::Trace::Span span("sim.run");
+ *     ...
+ *   }
+ * @endcode
+ */
+class Span {
+ public:
+  explicit Span(const std::string &phase) : phase_(phase), start_(Tracer::Clock::now()) {}
+  ~Span() { End(); }
+
+  /*!
+   * @brief Record the span now rather than at the end of the scope.
+   */
+  void End() {
+      if (ended_) return;
+      ended_ = true;
+      Tracer::Instance().Record(phase_, start_, Tracer::Clock::now());
+  }
+
+  Span(const Span &) = delete;
+  Span &operator=(const Span &) = delete;
+
+ private:
+  std::string phase_;
+  Tracer::Clock::time_point start_;
+  bool ended_ = false;
+};
+
+}
+}
+
+#endif // TRACE_FUNCTIONS_H
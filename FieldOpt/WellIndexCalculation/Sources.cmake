@@ -0,0 +1,19 @@
+SET(WELLINDEXCALCULATION_HEADERS
+	WellDefinition.h
+	intersected_cell.h
+	wicalc_batch.h
+	wicalc_rixx.h
+)
+
+SET(WELLINDEXCALCULATION_SOURCES
+	WellDefinition.cpp
+	intersected_cell.cpp
+	wicalc_batch.cpp
+	wicalc_rixx.cpp
+)
+
+SET(WELLINDEXCALCULATION_TESTS
+	tests/test_intersected_cells.cpp
+	tests/test_single_cell_wellindex.cpp
+	tests/test_wicalc_batch.cpp
+)
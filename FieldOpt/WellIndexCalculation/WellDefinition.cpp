@@ -0,0 +1,83 @@
+/******************************************************************************
+   Copyright (C) 2017 Einar J.M. Baumann <einar.baumann@gmail.com>
+
+   This file is part of the FieldOpt project.
+
+   FieldOpt is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   FieldOpt is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with FieldOpt.  If not, see <http://www.gnu.org/licenses/>.
+******************************************************************************/
+#include "WellDefinition.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <map>
+
+namespace Reservoir {
+namespace WellIndexCalculation {
+
+void WellDefinition::ReadWellsFromFile(string file_path,
+                                       vector<WellDefinition> &wells) {
+    ifstream in(file_path);
+    if (!in.is_open()) {
+        throw runtime_error("WellDefinition::ReadWellsFromFile: Unable to open " + file_path);
+    }
+
+    map<string, int> well_idx;
+    string line;
+    int line_no = 0;
+    while (getline(in, line)) {
+        line_no++;
+        auto comment = line.find('#');
+        if (comment != string::npos) {
+            line.erase(comment);
+        }
+
+        istringstream ls(line);
+        string name;
+        if (!(ls >> name)) {
+            continue; // Blank or comment-only line
+        }
+
+        double hx, hy, hz, tx, ty, tz, radius;
+        if (!(ls >> hx >> hy >> hz >> tx >> ty >> tz >> radius)) {
+            throw runtime_error("WellDefinition::ReadWellsFromFile: Unable to parse line "
+                                    + to_string(line_no) + " in " + file_path
+                                    + ". Expected: name hx hy hz tx ty tz radius [skin]");
+        }
+        double skin = 0.0;
+        ls >> skin;
+
+        if (well_idx.count(name) == 0) {
+            well_idx[name] = (int)wells.size();
+            wells.push_back(WellDefinition());
+            wells.back().wellname = name;
+        }
+        WellDefinition &well = wells[well_idx[name]];
+
+        Vector3d heel(hx, hy, hz);
+        Vector3d toe(tx, ty, tz);
+        double length = (toe - heel).norm();
+        double heel_md = well.toe_md.empty() ? 0.0 : well.toe_md.back();
+
+        well.heels.push_back(heel);
+        well.toes.push_back(toe);
+        well.heel_md.push_back(heel_md);
+        well.toe_md.push_back(heel_md + length);
+        well.well_length.push_back(length);
+        well.radii.push_back(radius);
+        well.skins.push_back(skin);
+    }
+}
+
+}
+}
@@ -25,6 +25,7 @@
 ******************************************************************************/
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "Reservoir/grid/grid.h"
 #include "Reservoir/grid/eclgrid.h"
 #include "WellIndexCalculation/wicalc_rixx.h"
@@ -217,6 +218,51 @@ TEST_F(IntersectedCellsTest, ProblematicPathB) {
   EXPECT_GT(cells.size(), 1);
 }
 
+TEST_F(IntersectedCellsTest, ConcurrentWells) {
+    // Compute a set of wells serially and concurrently with the same
+    // WIC object; the results should be identical.
+    vector<WellDefinition> wells;
+    for (int w = 0; w < 8; ++w) {
+        Eigen::Vector3d start_point = Eigen::Vector3d(12 + 24*w, 12, 1702);
+        Eigen::Vector3d end_point = Eigen::Vector3d(12 + 24*w, 1400, 1715);
+        WellDefinition well;
+        well.heels.push_back(start_point);
+        well.toes.push_back(end_point);
+        well.radii.push_back(0.190);
+        well.skins.push_back(0.0);
+        well.wellname = "testwell" + to_string(w);
+        well.heel_md.push_back(0.0);
+        well.toe_md.push_back((end_point - start_point).norm());
+        wells.push_back(well);
+    }
+
+    vector<vector<IntersectedCell>> serial_cells(wells.size());
+    for (int w = 0; w < wells.size(); ++w) {
+        wic_->ComputeWellBlocks(serial_cells[w], wells[w]);
+    }
+
+    vector<vector<IntersectedCell>> parallel_cells(wells.size());
+    vector<thread> threads;
+    for (int w = 0; w < wells.size(); ++w) {
+        threads.emplace_back([this, &parallel_cells, &wells, w]() {
+            wic_->ComputeWellBlocks(parallel_cells[w], wells[w]);
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    for (int w = 0; w < wells.size(); ++w) {
+        EXPECT_GT(serial_cells[w].size(), 0);
+        ASSERT_EQ(serial_cells[w].size(), parallel_cells[w].size());
+        for (int c = 0; c < serial_cells[w].size(); ++c) {
+            EXPECT_EQ(serial_cells[w][c].global_index(), parallel_cells[w][c].global_index());
+            EXPECT_DOUBLE_EQ(serial_cells[w][c].cell_well_index_matrix(),
+                             parallel_cells[w][c].cell_well_index_matrix());
+        }
+    }
+}
+
 //TEST_F(IntersectedCellsTest, ProblematicPathC) {
 //
 //  // Load grid and chose first cell (cell 1,1,1)
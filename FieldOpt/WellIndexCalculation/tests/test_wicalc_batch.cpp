@@ -0,0 +1,121 @@
+/******************************************************************************
+   This file and the WellIndexCalculator as a whole is part of the
+   FieldOpt project. However, unlike the rest of FieldOpt, the
+   WellIndexCalculator is provided under the GNU Lesser General Public
+   License.
+
+   WellIndexCalculator is free software: you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation, either version 3 of
+   the License, or (at your option) any later version.
+
+   WellIndexCalculator is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with WellIndexCalculator.  If not, see
+   <http://www.gnu.org/licenses/>.
+******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <QTemporaryDir>
+#include "Reservoir/grid/eclgrid.h"
+#include "WellIndexCalculation/wicalc_batch.h"
+#include "Settings/tests/test_resource_example_file_paths.hpp"
+
+using namespace Reservoir::Grid;
+using namespace Reservoir::WellIndexCalculation;
+using namespace std;
+
+namespace {
+
+class WicalcBatchTest : public ::testing::Test {
+ protected:
+  WicalcBatchTest() {
+      grid_ = new ECLGrid(file_path_);
+  }
+
+  virtual ~WicalcBatchTest() {
+      delete grid_;
+  }
+
+  vector<WellDefinition> createWells(int n) {
+      vector<WellDefinition> wells;
+      for (int w = 0; w < n; ++w) {
+          Eigen::Vector3d start_point = Eigen::Vector3d(12 + 24*w, 12, 1702);
+          Eigen::Vector3d end_point = Eigen::Vector3d(12 + 24*w, 1400, 1715);
+          WellDefinition well;
+          well.heels.push_back(start_point);
+          well.toes.push_back(end_point);
+          well.radii.push_back(0.190);
+          well.skins.push_back(0.0);
+          well.wellname = "testwell" + to_string(w);
+          well.heel_md.push_back(0.0);
+          well.toe_md.push_back((end_point - start_point).norm());
+          wells.push_back(well);
+      }
+      return wells;
+  }
+
+  Grid *grid_;
+  string file_path_ = TestResources::ExampleFilePaths::grid_5spot_;
+};
+
+TEST_F(WicalcBatchTest, MatchesSerialComputation) {
+    auto wells = createWells(8);
+
+    wicalc_rixx wic(grid_);
+    wicalc_batch batch(grid_);
+    auto results = batch.ComputeWellIndices(wells, 4);
+    ASSERT_EQ(wells.size(), results.size());
+
+    for (int w = 0; w < wells.size(); ++w) {
+        vector<IntersectedCell> cells;
+        wic.ComputeWellBlocks(cells, wells[w]);
+
+        EXPECT_TRUE(results[w].ok);
+        EXPECT_EQ(wells[w].wellname, results[w].wellname);
+        ASSERT_EQ(cells.size(), results[w].num_blocks());
+        for (int c = 0; c < cells.size(); ++c) {
+            EXPECT_EQ(cells[c].global_index(), results[w].global_index[c]);
+            EXPECT_EQ(cells[c].ijk_index().i(), results[w].i[c]);
+            EXPECT_DOUBLE_EQ(cells[c].cell_well_index_matrix(), results[w].wi[c]);
+            EXPECT_DOUBLE_EQ(cells[c].get_segment_entry_md(0), results[w].entry_md[c]);
+        }
+        EXPECT_GT(results[w].CompletedLength(), 0.0);
+        EXPECT_LE(results[w].CompletedLength(), results[w].well_length + 1e-6);
+    }
+}
+
+TEST_F(WicalcBatchTest, ReadWellsFromFile) {
+    QTemporaryDir dir;
+    string path = dir.path().toStdString() + "/wells.txt";
+    ofstream out(path);
+    out << "# name hx hy hz tx ty tz radius [skin]" << endl;
+    out << "PROD 12 12 1712 60 12 1712 0.25" << endl;
+    out << "INJ  12 24 1712 12 72 1712 0.19 0.5" << endl;
+    out << "PROD 60 12 1712 60 60 1712 0.25" << endl;
+    out.close();
+
+    vector<WellDefinition> wells;
+    WellDefinition::ReadWellsFromFile(path, wells);
+    ASSERT_EQ(2, wells.size());
+    EXPECT_EQ("PROD", wells[0].wellname);
+    ASSERT_EQ(2, wells[0].heels.size());
+    EXPECT_DOUBLE_EQ(48.0, wells[0].toe_md[0]);
+    EXPECT_DOUBLE_EQ(48.0, wells[0].heel_md[1]);
+    EXPECT_DOUBLE_EQ(96.0, wells[0].toe_md[1]);
+    EXPECT_DOUBLE_EQ(0.5, wells[1].skins[0]);
+
+    wicalc_batch batch(grid_);
+    auto results = batch.ComputeWellIndices(wells);
+    for (auto &r : results) {
+        EXPECT_TRUE(r.ok);
+        EXPECT_GT(r.num_blocks(), 0);
+    }
+}
+
+}
@@ -0,0 +1,137 @@
+/***********************************************************
+ Copyright (C) 2017
+ Mathias C. Bellout <mathias.bellout@ntnu.no>
+
+ This file is part of the FieldOpt project.
+
+ FieldOpt is free software: you can redistribute it
+ and/or modify it under the terms of the GNU General
+ Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at
+ your option) any later version.
+
+ FieldOpt is distributed in the hope that it will be
+ useful, but WITHOUT ANY WARRANTY; without even the
+ implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE.  See the GNU General Public
+ License for more details.
+
+ You should have received a copy of the GNU
+ General Public License along with FieldOpt.
+ If not, see <http://www.gnu.org/licenses/>.
+***********************************************************/
+
+// ---------------------------------------------------------
+#include "wicalc_batch.h"
+
+// ---------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+// ---------------------------------------------------------
+namespace Reservoir {
+namespace WellIndexCalculation {
+
+// ---------------------------------------------------------
+double WellIndexResult::CompletedLength() const {
+  double length = 0.0;
+  for (int b = 0; b < num_blocks(); ++b) {
+    length += exit_md[b] - entry_md[b];
+  }
+  return length;
+}
+
+// =========================================================
+wicalc_batch::wicalc_batch(Grid::Grid *grid)
+    : wic_(grid) {
+  if (grid == nullptr) {
+    throw std::runtime_error("wicalc_batch: A grid must be provided.");
+  }
+}
+
+// ---------------------------------------------------------
+vector<WellIndexResult>
+wicalc_batch::ComputeWellIndices(const vector<WellDefinition> &wells,
+                                 int n_threads) {
+  vector<WellIndexResult> results(wells.size());
+  if (wells.empty()) {
+    return results;
+  }
+
+  if (n_threads < 1) {
+    n_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  n_threads = std::min(n_threads, (int)wells.size());
+
+  std::atomic<int> next(0);
+  auto worker = [&]() {
+    int w;
+    while ((w = next++) < (int)wells.size()) {
+      results[w] = computeSingle(wells[w]);
+    }
+  };
+
+  if (n_threads == 1) {
+    worker();
+  } else {
+    vector<std::thread> pool;
+    pool.reserve(n_threads);
+    for (int t = 0; t < n_threads; ++t) {
+      pool.emplace_back(worker);
+    }
+    for (auto &th : pool) {
+      th.join();
+    }
+  }
+  return results;
+}
+
+// ---------------------------------------------------------
+WellIndexResult wicalc_batch::computeSingle(const WellDefinition &well) {
+  WellIndexResult result;
+  result.wellname = well.wellname;
+  for (int seg = 0; seg < well.heel_md.size(); ++seg) {
+    result.well_length += well.toe_md[seg] - well.heel_md[seg];
+  }
+
+  try {
+    // ComputeWellBlocks takes a non-const definition; work on a copy
+    // so the caller's definitions are never touched from worker threads.
+    WellDefinition def = well;
+    vector<IntersectedCell> cells;
+    wic_.ComputeWellBlocks(cells, def, &result.n_inactive_cells);
+
+    int n = 0;
+    for (auto &cell : cells) {
+      n += cell.num_segments();
+    }
+    result.global_index.reserve(n);
+    result.i.reserve(n); result.j.reserve(n); result.k.reserve(n);
+    result.wi.reserve(n);
+    result.entry_md.reserve(n);
+    result.exit_md.reserve(n);
+
+    for (auto &cell : cells) {
+      for (int s = 0; s < cell.num_segments(); ++s) {
+        result.global_index.push_back(cell.global_index());
+        result.i.push_back(cell.ijk_index().i());
+        result.j.push_back(cell.ijk_index().j());
+        result.k.push_back(cell.ijk_index().k());
+        result.wi.push_back(cell.cell_well_index_matrix());
+        result.entry_md.push_back(cell.get_segment_entry_md(s));
+        result.exit_md.push_back(cell.get_segment_exit_md(s));
+      }
+    }
+    result.ok = true;
+  }
+  catch (const std::exception &e) {
+    result.ok = false;
+    result.error = e.what();
+  }
+  return result;
+}
+
+}
+}
@@ -0,0 +1,109 @@
+/***********************************************************
+ Copyright (C) 2017
+ Mathias C. Bellout <mathias.bellout@ntnu.no>
+
+ This file is part of the FieldOpt project.
+
+ FieldOpt is free software: you can redistribute it
+ and/or modify it under the terms of the GNU General
+ Public License as published by the Free Software
+ Foundation, either version 3 of the License, or (at
+ your option) any later version.
+
+ FieldOpt is distributed in the hope that it will be
+ useful, but WITHOUT ANY WARRANTY; without even the
+ implied warranty of MERCHANTABILITY or FITNESS FOR
+ A PARTICULAR PURPOSE.  See the GNU General Public
+ License for more details.
+
+ You should have received a copy of the GNU
+ General Public License along with FieldOpt.
+ If not, see <http://www.gnu.org/licenses/>.
+***********************************************************/
+
+// ---------------------------------------------------------
+#ifndef FIELDOPT_WICALC_BATCH_H
+#define FIELDOPT_WICALC_BATCH_H
+
+// ---------------------------------------------------------
+#include "wicalc_rixx.h"
+
+// ---------------------------------------------------------
+namespace Reservoir {
+namespace WellIndexCalculation {
+
+// ---------------------------------------------------------
+using std::string;
+using std::vector;
+
+/*!
+ * @brief Compact well index result for a single trajectory.
+ *
+ * Per-block data is stored as parallel arrays (one entry per
+ * completed, active cell, in the order they are traversed),
+ * which is all that is needed to screen a trajectory without
+ * carrying the full IntersectedCell objects around.
+ */
+struct WellIndexResult {
+  string wellname;
+  bool ok = false;     //!< False if the computation threw.
+  string error;        //!< Error message when ok is false.
+
+  vector<int> global_index;
+  vector<int> i, j, k; //!< Zero-based (ERT) cell indices.
+  vector<double> wi;   //!< Matrix well index (transmissibility).
+  vector<double> entry_md;
+  vector<double> exit_md;
+
+  size_t n_inactive_cells = 0; //!< Intersected cells skipped because they are inactive.
+  double well_length = 0.0;    //!< Total MD length of the trajectory definition.
+
+  int num_blocks() const { return (int)global_index.size(); }
+
+  /*!
+   * @brief Sum of the MD lengths of the completed (active) blocks.
+   * If this is notably shorter than well_length the trajectory
+   * leaves the grid or passes through inactive cells.
+   */
+  double CompletedLength() const;
+};
+
+/*!
+ * @brief Compute well indices for many trajectories against
+ * a single grid.
+ *
+ * The grid is read (and its search tree built) once. The
+ * trajectories are then distributed over a pool of threads,
+ * each running wicalc_rixx::ComputeWellBlocks on the shared,
+ * read-only grid data. Failures are reported per trajectory
+ * and do not abort the batch.
+ */
+class wicalc_batch
+{
+ public:
+  /*!
+   * @param grid Grid to compute well indices in. Must outlive
+   * the wicalc_batch object.
+   */
+  wicalc_batch(Grid::Grid *grid);
+
+  /*!
+   * @brief Compute well indices for all wells.
+   * @param wells Well definitions to evaluate.
+   * @param n_threads Number of worker threads. Values < 1 use
+   * std::thread::hardware_concurrency().
+   * @return One result per well, in the same order as wells.
+   */
+  vector<WellIndexResult> ComputeWellIndices(const vector<WellDefinition> &wells,
+                                             int n_threads = 0);
+
+ private:
+  wicalc_rixx wic_;
+
+  WellIndexResult computeSingle(const WellDefinition &well);
+};
+
+}
+}
+
+#endif //FIELDOPT_WICALC_BATCH_H
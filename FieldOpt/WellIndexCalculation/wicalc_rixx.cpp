@@ -62,6 +62,7 @@ wicalc_rixx::wicalc_rixx(Grid::Grid *grid,
   else {
     grid_ = nullptr;
     ricasedata_ = nullptr;
+    activeCellInfo_ = nullptr;
   }
 
 }
@@ -102,12 +103,6 @@ void wicalc_rixx::AddGrid(Grid::Grid *grid) {
     ricasedata->mainGrid()->computeCachedData();
 
     dict_casedata_.insert(pair<string, cvf::ref<RICaseData>>(grid->GetGridFilePath(), ricasedata));
-
-
-    vector<double> intersections;
-    intersections.resize(ricasedata->mainGrid()->globalCellArray().size());
-    fill(intersections.begin(), intersections.end(), HUGE_VAL);
-    dict_intersections_.insert(pair<string, vector<double>>(grid->GetGridFilePath(), intersections));
   }
 }
 
@@ -118,12 +113,13 @@ void wicalc_rixx::SetGridActive(Grid::Grid *grid) {
   assert(HasGrid(grid->GetGridFilePath()));
   ricasedata_ = dict_casedata_[grid->GetGridFilePath()];
   grid_ = dict_grids_[grid->GetGridFilePath()];
-  intersections_ = dict_intersections_[grid->GetGridFilePath()];
+  activeCellInfo_ = ricasedata_->activeCellInfo(MATRIX_MODEL);
+  //fractureActiveCellInfo_ = ricasedata_->activeCellInfo(FRACTURE_MODEL);
 }
 
 // -----------------------------------------------------------------
 void wicalc_rixx::calculateWellPathIntersections(const WellPath& wellPath,
-                                                 vector<double> &isc_values) {
+                                                 vector<size_t> &isc_cells) {
 
   vector<cvf::HexIntersectionInfo> intersections =
       WellPath::findRawHexCellIntersections(ricasedata_->mainGrid(),
@@ -134,26 +130,29 @@ void wicalc_rixx::calculateWellPathIntersections(const WellPath& wellPath,
     Printer::info("Found " + Printer::num2str(intersections.size()) + " intersections.");
   }
 
+  isc_cells.reserve(isc_cells.size() + intersections.size());
   for (auto &intersection : intersections) {
 
     str.str("");
     str << "intersection.m_hexIndex = "
-        << intersection.m_hexIndex
-        << " -- values[intersection.m_hexIndex] = "
-        << isc_values[intersection.m_hexIndex];
+        << intersection.m_hexIndex;
      print_dbg_msg_wic_ri(__func__, str.str(), 0.0, 0);
-    isc_values[intersection.m_hexIndex] = CompletionType::WELL_PATH;
+    isc_cells.push_back(intersection.m_hexIndex);
   }
 }
 
 // -----------------------------------------------------------------
 void
 wicalc_rixx::collectIntersectedCells(vector<IntersectedCell> &isc_cells,
-                                     vector<WellPathCellIntersectionInfo> isc_info,
-                                     WellDefinition well,
-                                     WellPath& wellPath) {
+                                     const vector<WellPathCellIntersectionInfo> &isc_info,
+                                     const WellDefinition &well,
+                                     WellPath& wellPath,
+                                     size_t *n_inactive_cells) {
 
   vector<RICompData> completionData;
+  if (n_inactive_cells != nullptr) {
+    *n_inactive_cells = 0;
+  }
 
   for (auto& cell : isc_info) {
 
@@ -167,6 +166,9 @@ wicalc_rixx::collectIntersectedCells(vector<IntersectedCell> &isc_cells,
     //bool cellIsActiveF = fractureActiveCellInfo_->isActive(cell.globCellIndex);
     if (!cellIsActive) {
       // cout << "Cell is not active" << endl;
+      if (n_inactive_cells != nullptr) {
+        ++*n_inactive_cells;
+      }
       continue;
     }
 
@@ -238,7 +240,8 @@ wicalc_rixx::collectIntersectedCells(vector<IntersectedCell> &isc_cells,
 void
 wicalc_rixx::ComputeWellBlocks(
     vector<IntersectedCell> &well_indices,
-    WellDefinition &well) {
+    WellDefinition &well,
+    size_t *n_inactive_cells) {
 
   // -------------------------------------------------------
   stringstream str;
@@ -246,8 +249,10 @@ wicalc_rixx::ComputeWellBlocks(
   cvf::ref<RIExtractor> extractor = nullptr;
 
   // -------------------------------------------------------------
-  // Intersected cells for well
+  // Intersected cells for well. All scratch data is local to this
+  // call so that wells can be computed concurrently.
   vector<IntersectedCell> intersected_cells;
+  vector<size_t> isc_hex_cells;
 
   // -------------------------------------------------------------
   // Loop through well segments
@@ -290,7 +295,7 @@ wicalc_rixx::ComputeWellBlocks(
 
   // -----------------------------------------------------------
   // Calculate cells intersected by well path
-  calculateWellPathIntersections(*wellPath, intersections_);
+  calculateWellPathIntersections(*wellPath, isc_hex_cells);
   // cout << "[mod]wicalc_rixx-05.--------- calculateWellPathIntersections" << endl;
 
   // -----------------------------------------------------------
@@ -299,11 +304,6 @@ wicalc_rixx::ComputeWellBlocks(
   extractor = new RIECLExtractor(ricasedata_.p(), *wellPath);
   // cout << "[mod]wicalc_rixx-06.--------- cvf::ref<RIExtractor> extractor" << endl;
 
-  // -----------------------------------------------------------
-  activeCellInfo_ = ricasedata_->activeCellInfo(MATRIX_MODEL);
-  //fractureActiveCellInfo_ = ricasedata_->activeCellInfo(FRACTURE_MODEL);
-  // cout << "[mod]wicalc_rixx-07.--------- activeCellInfo_" << endl;
-
   // -----------------------------------------------------------
   vector<WellPathCellIntersectionInfo>
       intersectedCellInfo = extractor->cellIntersectionInfosAlongWellPath();
@@ -327,7 +327,8 @@ wicalc_rixx::ComputeWellBlocks(
   collectIntersectedCells(intersected_cells,
                           intersectedCellInfo,
                           well,
-                          *wellPath);
+                          *wellPath,
+                          n_inactive_cells);
 
   if (VERB_WIC >= 2) {
     Printer::ext_info("Found " + Printer::num2str(intersected_cells.size())
@@ -336,7 +337,7 @@ wicalc_rixx::ComputeWellBlocks(
 
 
   // Assign intersected cells to well
-  well_indices = intersected_cells;
+  well_indices.swap(intersected_cells);
 
 }
 // -----------------------------------------------------------------
@@ -55,7 +55,6 @@ class wicalc_rixx
 
   // -------------------------------------------------------
   Settings::Model::Well well_settings_;
-  vector<double> intersections_;
   Grid::Grid* grid_;
 
   // -------------------------------------------------------
@@ -73,22 +72,45 @@ class wicalc_rixx
 
   // ---------------------------------------------------------------
   // WellPath *wellPath_;
+  //!< Matrix active cell info for the active grid. Set by SetGridActive
+  //!< and only read while computing well blocks.
   const RIActiveCellInfo* activeCellInfo_;
   //const RIActiveCellInfo* fractureActiveCellInfo_;
 
   // ---------------------------------------------------------------
   void collectIntersectedCells(vector<IntersectedCell> &isc_cells,
-                               vector<WellPathCellIntersectionInfo> isc_info,
-                               WellDefinition well,
-                               WellPath& wellPath);
+                               const vector<WellPathCellIntersectionInfo> &isc_info,
+                               const WellDefinition &well,
+                               WellPath& wellPath,
+                               size_t *n_inactive_cells = nullptr);
 
   // ---------------------------------------------------------------
+  /*!
+   * @brief Find the raw hex cell intersections of a well path.
+   * @param wellPath Well path to intersect with the active grid.
+   * @param isc_cells Global indices of the intersected cells. Filled
+   * by this function; it should be local to the caller so that
+   * several wells can be computed concurrently.
+   */
   void calculateWellPathIntersections(const WellPath& wellPath,
-                                      vector<double> &isc_values);
+                                      vector<size_t> &isc_cells);
 
   // ---------------------------------------------------------------
+  /*!
+   * @brief Compute the intersected cells and well indices for a well.
+   *
+   * This only reads the active grid and its search tree; all scratch
+   * data is local to the call. Multiple wells may therefore be
+   * computed concurrently with the same wicalc_rixx object, provided
+   * that the active grid is not changed (SetGridActive/AddGrid) while
+   * a computation is running.
+   *
+   * @param n_inactive_cells Optional; if set, it receives the number
+   * of intersected cells that were skipped because they are inactive.
+   */
   void ComputeWellBlocks(vector<IntersectedCell> &well_indices,
-                         WellDefinition &well);
+                         WellDefinition &well,
+                         size_t *n_inactive_cells = nullptr);
 
   /*!
    * @brief Check if a grid has been read into an RICaseData object.
@@ -123,7 +145,6 @@ class wicalc_rixx
  private:
   map<string, cvf::ref<RICaseData>> dict_casedata_;
   map<string, Grid::Grid*> dict_grids_;
-  map<string, vector<double>> dict_intersections_;
 
 };
 